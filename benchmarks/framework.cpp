@@ -0,0 +1,208 @@
+#include "framework.h"
+
+#include <GameEngineFramework/Timer/Clock.h>
+#include <GameEngineFramework/MemoryAllocation/FrameArena.h>
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <cmath>
+
+#ifndef BENCHMARK_PROJECT_VERSION
+  #define BENCHMARK_PROJECT_VERSION  "unknown"
+#endif
+
+
+BenchmarkFramework::BenchmarkFramework() : 
+    numberOfSamples(50),
+    numberOfWarmupSamples(5),
+    filter("")
+{}
+
+void BenchmarkFramework::Initiate(void) {
+    std::cout << "Running benchmarks\n\n";
+    std::cout << std::left << std::setw(36) << "Benchmark" << std::right 
+              << std::setw(12) << "mean" 
+              << std::setw(12) << "median" 
+              << std::setw(12) << "p95" 
+              << std::setw(12) << "min" 
+              << std::setw(12) << "max" << "  ns/op\n";
+}
+
+void BenchmarkFramework::Complete(void) {
+    std::cout << "\nComplete\n\n";
+}
+
+void BenchmarkFramework::AddBenchmark(void(BenchmarkFramework::*benchmarkFunction)()) {
+    mBenchmarkList.push_back(benchmarkFunction);
+}
+
+void BenchmarkFramework::RunBenchmarkSuite(void) {
+    for (unsigned int i=0; i < mBenchmarkList.size(); i++) {
+        void(BenchmarkFramework::*functionPtr)() = mBenchmarkList[i];
+        (*this.*functionPtr)();
+    }
+}
+
+bool BenchmarkFramework::CheckIsSelected(std::string& name) {
+    if (filter.empty()) 
+        return true;
+    return name.find(filter) != std::string::npos;
+}
+
+void BenchmarkFramework::Measure(std::string name, unsigned int operationsPerSample, std::function<void()> operation) {
+    Measure(name, operationsPerSample, nullptr, operation, nullptr);
+}
+
+void BenchmarkFramework::Measure(std::string name, unsigned int operationsPerSample, std::function<void()> setup, std::function<void()> operation, std::function<void()> teardown) {
+    
+    if (!CheckIsSelected(name)) 
+        return;
+        
+    if (operationsPerSample == 0) 
+        operationsPerSample = 1;
+        
+    std::vector<double> samples;
+    samples.reserve(numberOfSamples);
+    
+    for (unsigned int s=0; s < numberOfWarmupSamples + numberOfSamples; s++) {
+        
+        if (setup) 
+            setup();
+            
+        unsigned long long int begin = Clock::GetTime();
+        
+        for (unsigned int i=0; i < operationsPerSample; i++) 
+            operation();
+            
+        unsigned long long int end = Clock::GetTime();
+        
+        if (teardown) 
+            teardown();
+            
+        // Release the temporaries as the game loop does every frame
+        FrameArena::GetThreadArena().Reset();
+        
+        if (s < numberOfWarmupSamples) 
+            continue;
+            
+        samples.push_back( (double)(end - begin) / operationsPerSample );
+    }
+    
+    BenchmarkResult result = Summarize(name, operationsPerSample, samples);
+    
+    mResults.push_back(result);
+    
+    std::cout << std::left << std::setw(36) << result.name << std::right << std::fixed << std::setprecision(1) 
+              << std::setw(12) << result.mean 
+              << std::setw(12) << result.median 
+              << std::setw(12) << result.percentile95 
+              << std::setw(12) << result.min 
+              << std::setw(12) << result.max << "\n";
+              
+    return;
+}
+
+BenchmarkResult BenchmarkFramework::Summarize(std::string& name, unsigned int operationsPerSample, std::vector<double>& samples) {
+    
+    BenchmarkResult result;
+    
+    result.name                = name;
+    result.numberOfSamples     = samples.size();
+    result.operationsPerSample = operationsPerSample;
+    
+    result.min = result.max = result.mean = result.median = result.percentile95 = result.standardDeviation = 0.0;
+    
+    if (samples.size() == 0) 
+        return result;
+        
+    std::sort(samples.begin(), samples.end());
+    
+    unsigned int numberOfValues = samples.size();
+    
+    double sum = 0.0;
+    for (unsigned int i=0; i < numberOfValues; i++) 
+        sum += samples[i];
+        
+    result.mean = sum / numberOfValues;
+    
+    double variance = 0.0;
+    for (unsigned int i=0; i < numberOfValues; i++) 
+        variance += (samples[i] - result.mean) * (samples[i] - result.mean);
+        
+    result.standardDeviation = std::sqrt(variance / numberOfValues);
+    
+    result.min = samples[0];
+    result.max = samples[numberOfValues - 1];
+    
+    if (numberOfValues % 2 == 0) {
+        result.median = (samples[numberOfValues / 2 - 1] + samples[numberOfValues / 2]) * 0.5;
+    } else {
+        result.median = samples[numberOfValues / 2];
+    }
+    
+    // Nearest rank
+    unsigned int rank = (unsigned int)std::ceil(0.95 * numberOfValues);
+    if (rank < 1) rank = 1;
+    result.percentile95 = samples[rank - 1];
+    
+    return result;
+}
+
+std::vector<BenchmarkResult>& BenchmarkFramework::GetResults(void) {
+    return mResults;
+}
+
+std::string BenchmarkFramework::GetJSON(void) {
+    
+    std::stringstream stream;
+    stream << std::fixed << std::setprecision(3);
+    
+    stream << "{\n";
+    stream << "  \"version\": \"" << BENCHMARK_PROJECT_VERSION << "\",\n";
+    stream << "  \"clock\": \"" << ((Clock::GetSource() == Clock::Source::TSC) ? "tsc" : "system") << "\",\n";
+    stream << "  \"unit\": \"ns/op\",\n";
+    stream << "  \"warmup_samples\": " << numberOfWarmupSamples << ",\n";
+    stream << "  \"benchmarks\": [";
+    
+    for (unsigned int i=0; i < mResults.size(); i++) {
+        
+        BenchmarkResult& result = mResults[i];
+        
+        // Names are plain identifiers but keep the document valid regardless
+        std::string name;
+        for (unsigned int c=0; c < result.name.size(); c++) {
+            if ((result.name[c] == '"') | (result.name[c] == '\\')) 
+                name += '\\';
+            name += result.name[c];
+        }
+        
+        stream << ((i == 0) ? "\n" : ",\n");
+        stream << "    {\"name\": \"" << name << "\", "
+               << "\"samples\": " << result.numberOfSamples << ", "
+               << "\"operations_per_sample\": " << result.operationsPerSample << ", "
+               << "\"mean\": " << result.mean << ", "
+               << "\"median\": " << result.median << ", "
+               << "\"p95\": " << result.percentile95 << ", "
+               << "\"min\": " << result.min << ", "
+               << "\"max\": " << result.max << ", "
+               << "\"stddev\": " << result.standardDeviation << "}";
+    }
+    
+    stream << "\n  ]\n}\n";
+    
+    return stream.str();
+}
+
+bool BenchmarkFramework::WriteJSON(std::string filename) {
+    
+    std::ofstream file(filename);
+    
+    if (!file.is_open()) 
+        return false;
+        
+    file << GetJSON();
+    
+    return file.good();
+}
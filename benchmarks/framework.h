@@ -0,0 +1,103 @@
+//
+// Engine microbenchmarks
+//
+// Each benchmark times a number of samples after a few warm up samples
+// which are thrown away. A sample runs an operation a fixed number of
+// times so the timings sit well above the resolution of the clock. The
+// statistics are reported in nanoseconds per operation.
+//
+#ifndef ENGINE_MICROBENCHMARKS
+#define ENGINE_MICROBENCHMARKS
+
+#include <iostream>
+#include <functional>
+#include <string>
+#include <vector>
+
+
+struct BenchmarkResult {
+    
+    std::string name;
+    
+    unsigned int numberOfSamples;
+    unsigned int operationsPerSample;
+    
+    // Nanoseconds per operation
+    double min;
+    double max;
+    double mean;
+    double median;
+    double percentile95;
+    double standardDeviation;
+    
+};
+
+
+class BenchmarkFramework {
+
+public:
+    
+    /// Number of samples timed for each benchmark.
+    unsigned int numberOfSamples;
+    
+    /// Number of samples run and discarded before timing.
+    unsigned int numberOfWarmupSamples;
+    
+    /// Only benchmarks whose name contains the filter are run. Empty runs every benchmark.
+    std::string filter;
+    
+    BenchmarkFramework();
+    
+    /// Initiate the benchmark framework.
+    void Initiate(void);
+    /// Signal to complete after all benchmarks have run.
+    void Complete(void);
+    
+    /// Run the suite of benchmarks.
+    void RunBenchmarkSuite(void);
+    
+    /// Time an operation run the given number of times per sample.
+    void Measure(std::string name, unsigned int operationsPerSample, std::function<void()> operation);
+    
+    /// Time an operation with untimed setup and teardown run around every sample.
+    void Measure(std::string name, unsigned int operationsPerSample, std::function<void()> setup, std::function<void()> operation, std::function<void()> teardown);
+    
+    /// Return the results recorded so far.
+    std::vector<BenchmarkResult>& GetResults(void);
+    
+    /// Return the results as a JSON document.
+    std::string GetJSON(void);
+    
+    /// Write the results as a JSON document to a file.
+    bool WriteJSON(std::string filename);
+    
+    
+    //
+    // Benchmark suite
+    //
+    
+    void AddBenchmark(void(BenchmarkFramework::*benchmarkFunction)());
+    
+    void BenchmarkPoolAllocator(void);
+    void BenchmarkMesh(void);
+    void BenchmarkHeightField(void);
+    void BenchmarkRenderPasses(void);
+    void BenchmarkActorSystem(void);
+    void BenchmarkGenetics(void);
+    void BenchmarkString(void);
+    
+private:
+    
+    // Check the name against the filter
+    bool CheckIsSelected(std::string& name);
+    
+    // Summarize the samples of a benchmark
+    BenchmarkResult Summarize(std::string& name, unsigned int operationsPerSample, std::vector<double>& samples);
+    
+    std::vector<BenchmarkResult> mResults;
+    
+    std::vector<void(BenchmarkFramework::*)()> mBenchmarkList;
+    
+};
+
+#endif
@@ -0,0 +1,70 @@
+#include "../framework.h"
+#include <GameEngineFramework/ActorAI/ActorSystem.h>
+#include <GameEngineFramework/Math/Random.h>
+
+extern ActorSystem       AI;
+extern NumberGeneration  Random;
+
+#define BENCHMARK_ACTORS  1000
+
+
+void BenchmarkFramework::BenchmarkActorSystem(void) {
+    
+    std::vector<Actor*> actors;
+    
+    for (unsigned int i=0; i < BENCHMARK_ACTORS; i++) {
+        
+        Actor* actorPtr = AI.CreateActor();
+        
+        AI.genomes.Sheep(actorPtr);
+        
+        actorPtr->SetPosition( glm::vec3(Random.Range(-100, 100), 0, Random.Range(-100, 100)) );
+        
+        actors.push_back(actorPtr);
+    }
+    
+    AI.SetPlayerWorldPosition( glm::vec3(0) );
+    
+    // Each update processes the next batch of actors
+    Measure("ActorSystem::Update", 1, [&]() {
+        AI.Update();
+    });
+    
+    for (unsigned int i=0; i < actors.size(); i++) 
+        AI.DestroyActor( actors[i] );
+        
+    // Destruct the destroyed actors
+    AI.Update();
+    
+    return;
+}
+
+void BenchmarkFramework::BenchmarkGenetics(void) {
+    
+    Actor* sourceActor = AI.CreateActor();
+    Actor* targetActor = AI.CreateActor();
+    
+    AI.genomes.Sheep(sourceActor);
+    
+    std::string genome;
+    
+    Measure("GeneticPresets::ExtractGenome", 100, [&]() {
+        genome = AI.genomes.ExtractGenome(sourceActor);
+    });
+    
+    // Injecting appends the genes so clear them between samples
+    Measure("GeneticPresets::InjectGenome", 1, 
+            nullptr, 
+            [&]() {AI.genomes.InjectGenome(targetActor, genome);}, 
+            [&]() {
+                while (targetActor->GetNumberOfGenes() > 0) 
+                    targetActor->RemoveGene(0);
+            });
+            
+    AI.DestroyActor(sourceActor);
+    AI.DestroyActor(targetActor);
+    
+    AI.Update();
+    
+    return;
+}
@@ -0,0 +1,41 @@
+#include "../framework.h"
+#include <GameEngineFramework/Engine/Engine.h>
+
+extern EngineSystemManager  Engine;
+extern RenderSystem         Renderer;
+
+// Default chunk size of the chunk spawner
+#define BENCHMARK_HEIGHT_FIELD_SIZE  32
+
+
+void BenchmarkFramework::BenchmarkHeightField(void) {
+    
+    std::vector<float>     heightField(BENCHMARK_HEIGHT_FIELD_SIZE * BENCHMARK_HEIGHT_FIELD_SIZE);
+    std::vector<glm::vec3> colorField(BENCHMARK_HEIGHT_FIELD_SIZE * BENCHMARK_HEIGHT_FIELD_SIZE);
+    
+    int offset = 0;
+    
+    Measure("Engine::AddHeightFieldFromPerlinNoise", 1, 
+            [&]() {std::fill(heightField.begin(), heightField.end(), 0.0f);}, 
+            [&]() {
+                Engine.AddHeightFieldFromPerlinNoise(heightField.data(), BENCHMARK_HEIGHT_FIELD_SIZE, BENCHMARK_HEIGHT_FIELD_SIZE, 
+                                                     0.01f, 0.01f, 40.0f, offset, offset, 100);
+                offset += BENCHMARK_HEIGHT_FIELD_SIZE;
+            }, 
+            nullptr);
+            
+    std::fill(colorField.begin(), colorField.end(), glm::vec3(0.5f));
+    
+    Mesh* meshPtr = Renderer.CreateMesh();
+    
+    Measure("Engine::AddHeightFieldToMesh", 1, 
+            nullptr, 
+            [&]() {
+                Engine.AddHeightFieldToMesh(meshPtr, heightField.data(), colorField.data(), BENCHMARK_HEIGHT_FIELD_SIZE, BENCHMARK_HEIGHT_FIELD_SIZE, 0, 0, 1, 1);
+            }, 
+            [&]() {meshPtr->ClearSubMeshes();});
+            
+    Renderer.DestroyMesh(meshPtr);
+    
+    return;
+}
@@ -0,0 +1,52 @@
+#include "../framework.h"
+#include <GameEngineFramework/Renderer/RenderSystem.h>
+extern RenderSystem Renderer;
+
+#define BENCHMARK_SUB_MESHES  100
+
+
+void BenchmarkFramework::BenchmarkMesh(void) {
+    
+    Mesh* meshPtr = Renderer.CreateMesh();
+    
+    // Quad sub mesh
+    std::vector<Vertex> vertexBuffer;
+    vertexBuffer.push_back( Vertex(0, 0, 0,  1, 1, 1,  0, 1, 0,  0, 0) );
+    vertexBuffer.push_back( Vertex(1, 0, 0,  1, 1, 1,  0, 1, 0,  1, 0) );
+    vertexBuffer.push_back( Vertex(1, 0, 1,  1, 1, 1,  0, 1, 0,  1, 1) );
+    vertexBuffer.push_back( Vertex(0, 0, 1,  1, 1, 1,  0, 1, 0,  0, 1) );
+    
+    std::vector<Index> indexBuffer;
+    indexBuffer.push_back(0);
+    indexBuffer.push_back(2);
+    indexBuffer.push_back(1);
+    indexBuffer.push_back(0);
+    indexBuffer.push_back(3);
+    indexBuffer.push_back(2);
+    
+    unsigned int count = 0;
+    
+    Measure("Mesh::AddSubMesh", BENCHMARK_SUB_MESHES, 
+            nullptr, 
+            [&]() {
+                meshPtr->AddSubMesh(count, 0, 0, vertexBuffer, indexBuffer, false);
+                count++;
+            }, 
+            [&]() {
+                meshPtr->ClearSubMeshes();
+                count = 0;
+            });
+            
+    // Remove from the front so the remaining sub meshes are shifted down
+    Measure("Mesh::RemoveSubMesh", BENCHMARK_SUB_MESHES, 
+            [&]() {
+                for (unsigned int i=0; i < BENCHMARK_SUB_MESHES; i++) 
+                    meshPtr->AddSubMesh(i, 0, 0, vertexBuffer, indexBuffer, false);
+            }, 
+            [&]() {meshPtr->RemoveSubMesh(0);}, 
+            [&]() {meshPtr->ClearSubMeshes();});
+            
+    Renderer.DestroyMesh(meshPtr);
+    
+    return;
+}
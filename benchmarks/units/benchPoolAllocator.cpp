@@ -0,0 +1,37 @@
+#include "../framework.h"
+#include <GameEngineFramework/MemoryAllocation/PoolAllocator.h>
+#include <GameEngineFramework/Transform/Transform.h>
+
+#define BENCHMARK_POOL_OBJECTS  1000
+
+
+void BenchmarkFramework::BenchmarkPoolAllocator(void) {
+    
+    PoolAllocator<Transform> allocator(BENCHMARK_POOL_OBJECTS, 1);
+    
+    std::vector<Transform*> objects;
+    objects.reserve(BENCHMARK_POOL_OBJECTS);
+    
+    Measure("PoolAllocator::Create", BENCHMARK_POOL_OBJECTS, 
+            nullptr, 
+            [&]() {objects.push_back( allocator.Create() );}, 
+            [&]() {
+                for (unsigned int i=0; i < objects.size(); i++) 
+                    allocator.Destroy( objects[i] );
+                objects.clear();
+            });
+            
+    // Destroy in creation order
+    unsigned int index = 0;
+    
+    Measure("PoolAllocator::Destroy", BENCHMARK_POOL_OBJECTS, 
+            [&]() {
+                for (unsigned int i=0; i < BENCHMARK_POOL_OBJECTS; i++) 
+                    objects.push_back( allocator.Create() );
+                index = 0;
+            }, 
+            [&]() {allocator.Destroy( objects[index++] );}, 
+            [&]() {objects.clear();});
+            
+    return;
+}
@@ -0,0 +1,121 @@
+#include "../framework.h"
+#include <GameEngineFramework/Renderer/RenderSystem.h>
+#include <GameEngineFramework/Math/Random.h>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+extern RenderSystem      Renderer;
+extern NumberGeneration  Random;
+
+#define BENCHMARK_RENDERERS  1000
+
+
+void BenchmarkFramework::BenchmarkRenderPasses(void) {
+    
+    // Unit cube corners shared by every renderer
+    Mesh* meshPtr = Renderer.CreateMesh();
+    
+    std::vector<Vertex> vertexBuffer;
+    std::vector<Index>  indexBuffer;
+    
+    for (unsigned int i=0; i < 8; i++) {
+        vertexBuffer.push_back( Vertex((i & 1) ? 0.5f : -0.5f, (i & 2) ? 0.5f : -0.5f, (i & 4) ? 0.5f : -0.5f,  1, 1, 1,  0, 1, 0,  0, 0) );
+        indexBuffer.push_back(i);
+    }
+    
+    meshPtr->AddSubMesh(0, 0, 0, vertexBuffer, indexBuffer);
+    
+    std::vector<MeshRenderer*> renderQueue;
+    
+    for (unsigned int i=0; i < BENCHMARK_RENDERERS; i++) {
+        
+        MeshRenderer* meshRenderer = Renderer.CreateMeshRenderer();
+        
+        meshRenderer->mesh = meshPtr;
+        
+        meshRenderer->transform.position = glm::vec3(Random.Range(-500, 500), Random.Range(-50, 50), Random.Range(-500, 500));
+        meshRenderer->transform.matrix   = glm::translate(glm::mat4(1), meshRenderer->transform.position);
+        
+        meshRenderer->UpdateBounds();
+        
+        renderQueue.push_back(meshRenderer);
+    }
+    
+    glm::vec3 eye(0);
+    
+    // Move the eye each sample so the queue has to be sorted again
+    Measure("RenderSystem::SortingPass", 1, [&]() {
+        Renderer.SortingPass(eye, renderQueue.data(), renderQueue.size(), RENDER_QUEUE_GEOMETRY - RENDER_QUEUE_SKY);
+        eye.x += 1.0f;
+    });
+    
+    // Look down a diagonal from above so about a quarter of the renderers are visible
+    glm::mat4 projection = glm::perspective(glm::radians(60.0f), 1.33f, 0.1f, 1000.0f);
+    glm::mat4 view       = glm::lookAt(glm::vec3(0, 20, 0), glm::vec3(1, 19.5f, 1), glm::vec3(0, 1, 0));
+    
+    Renderer.mFrustum.SetViewProjection(projection * view);
+    
+    unsigned int index = 0;
+    
+    volatile unsigned int numberOfVisible = 0;
+    
+    Measure("RenderSystem::CullingPass", BENCHMARK_RENDERERS, [&]() {
+        
+        if (!Renderer.CullingPass(renderQueue[index])) 
+            numberOfVisible = numberOfVisible + 1;
+            
+        index = (index + 1) % BENCHMARK_RENDERERS;
+        
+    });
+    
+    // The same boxes tested as a batch
+    std::vector<float> boundsMin[3];
+    std::vector<float> boundsMax[3];
+    
+    for (unsigned int i=0; i < renderQueue.size(); i++) {
+        
+        for (unsigned int a=0; a < 3; a++) {
+            boundsMin[a].push_back( renderQueue[i]->GetBoundingBoxMin()[a] );
+            boundsMax[a].push_back( renderQueue[i]->GetBoundingBoxMax()[a] );
+        }
+        
+    }
+    
+    Frustum::BoxArrays boxes;
+    boxes.minX = boundsMin[0].data();
+    boxes.minY = boundsMin[1].data();
+    boxes.minZ = boundsMin[2].data();
+    boxes.maxX = boundsMax[0].data();
+    boxes.maxY = boundsMax[1].data();
+    boxes.maxZ = boundsMax[2].data();
+    
+    std::vector<unsigned char> visible( renderQueue.size() );
+    
+    // One operation tests the whole batch
+    Measure("Frustum::CheckBoxes", 1, [&]() {
+        Renderer.mFrustum.CheckBoxes(boxes, visible.size(), visible.data());
+    });
+    
+    // The same renderers held in a tree
+    BoundingVolumeHierarchy tree;
+    
+    for (unsigned int i=0; i < renderQueue.size(); i++) 
+        tree.Insert( renderQueue[i] );
+        
+    Measure("BoundingVolumeHierarchy::Cull", 1, [&]() {
+        FrameVector<MeshRenderer*> visibleRenderers;
+        tree.Cull(Renderer.mFrustum, visibleRenderers);
+    });
+    
+    tree.Clear();
+    
+    // Detached so the shared mesh is destroyed once
+    for (unsigned int i=0; i < renderQueue.size(); i++) {
+        renderQueue[i]->mesh = nullptr;
+        Renderer.DestroyMeshRenderer( renderQueue[i] );
+    }
+    
+    Renderer.DestroyMesh(meshPtr);
+    
+    return;
+}
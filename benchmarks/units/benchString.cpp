@@ -0,0 +1,31 @@
+#include "../framework.h"
+#include <GameEngineFramework/Types/Types.h>
+
+extern StringType  String;
+extern IntType     Int;
+
+#define BENCHMARK_STRING_TOKENS  100
+
+
+void BenchmarkFramework::BenchmarkString(void) {
+    
+    // Comma separated record like the ones written by the serializer
+    std::string record;
+    
+    for (unsigned int i=0; i < BENCHMARK_STRING_TOKENS; i++) {
+        
+        if (i > 0) 
+            record += ",";
+            
+        record += "token" + Int.ToString((int)i);
+    }
+    
+    volatile unsigned int numberOfTokens = 0;
+    
+    Measure("StringType::Explode", 100, [&]() {
+        std::vector<std::string> tokens = String.Explode(record, ',');
+        numberOfTokens = tokens.size();
+    });
+    
+    return;
+}
@@ -5,10 +5,11 @@
 #include <GameEngineFramework/ActorAI/GeneticPresets.h>
 
 #include <GameEngineFramework/MemoryAllocation/PoolAllocator.h>
+#include <GameEngineFramework/MemoryAllocation/ConcurrentPoolAllocator.h>
 
 #include <GameEngineFramework/ActorAI/neurons/NeuralLayer.h>
 #include <GameEngineFramework/ActorAI/neurons/WeightedLayer.h>
-#include <GameEngineFramework/ActorAI/Genetics/Gene.h>
+#include <GameEngineFramework/ActorAI/genetics/Gene.h>
 
 #include <GameEngineFramework/ActorAI/components/actor.h>
 
@@ -23,10 +24,10 @@ public:
     
     ActorSystem();
     
-    /// Create an actor and return its pointer.
+    /// Create an actor and return its pointer. Safe to call from any thread.
     Actor* CreateActor(void);
     
-    /// Destroy an actor.
+    /// Destroy an actor. Safe to call from any thread. The actor is destructed on the next AI update.
     bool DestroyActor(Actor* actorPtr);
     
     /// Set the player position in the simulation.
@@ -41,9 +42,12 @@ public:
     /// Get an actor from the simulation by its index.
     Actor* GetActor(unsigned int index);
     
-    /// Signal to the AI thread to update the simulation.
+    /// Signal the job system to run an update cycle over the simulation.
     void UpdateSendSignal(void);
     
+    /// Release any actor pools which no longer hold any actors.
+    void ReleaseFreeMemory(void);
+    
     
     /// Set the update distance from the camera position.
     void SetActorUpdateDistance(float distance);
@@ -62,12 +66,14 @@ public:
     /// Shutdown the actor AI system. (called internally)
     void Shutdown(void);
     
-    /// Update the actors in the simulation. (called internally from another thread)
+    /// Update the actors in the simulation. (called internally from a job)
     void Update();
     
     /// Genetic entity definitions.
     GeneticPresets genomes;
     
+    friend class EngineSystemManager;
+    
 private:
     
     // Current position of the player in the world
@@ -79,12 +85,20 @@ private:
     // Distance beyond which the actors limbs wont be drawn
     float mActorDetailDistance;
     
+    // Queue a job to update the next batch of actors
+    void ScheduleUpdate(void);
+    
     // Threading
-    std::thread* mActorSystemThread;
     std::mutex   mux;
     
+    // Whether an update job is queued or running
+    bool mIsUpdateScheduled;
+    
+    // Release the free pools once the update job in flight finishes its batch
+    bool mDoReleaseFreeMemory;
+    
     // Object pools
-    PoolAllocator<Actor> mActors;
+    ConcurrentPoolAllocator<Actor> mActors;
     
 };
 
@@ -3,7 +3,7 @@
 
 #include <GameEngineFramework/ActorAI/ActorStates.h>
 
-#include <GameEngineFramework/ActorAI/Genetics/Gene.h>
+#include <GameEngineFramework/ActorAI/genetics/Gene.h>
 #include <GameEngineFramework/ActorAI/neurons/NeuralLayer.h>
 #include <GameEngineFramework/ActorAI/neurons/WeightedLayer.h>
 
@@ -3,7 +3,7 @@
 
 #include <GameEngineFramework/configuration.h>
 
-#include <GameEngineFramework/ActorAI/Genetics/Base.h>
+#include <GameEngineFramework/ActorAI/genetics/Base.h>
 
 
 
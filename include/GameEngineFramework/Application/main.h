@@ -1,19 +1,21 @@
-#include <GameEngineFrameWork/configuration.h>
+#include <GameEngineFramework/configuration.h>
 
-#include <GameEngineFrameWork/Input/InputSystem.h>
+#include <GameEngineFramework/Input/InputSystem.h>
 #include <GameEngineFramework/Audio/AudioSystem.h>
-#include <GameEngineFrameWork/Physics/PhysicsSystem.h>
-#include <GameEngineFrameWork/Renderer/RenderSystem.h>
-#include <GameEngineFrameWork/Resources/ResourceManager.h>
-#include <GameEngineFrameWork/Scripting/ScriptSystem.h>
-#include <GameEngineFrameWork/Serialization/Serialization.h>
-#include <GameEngineFrameWork/ActorAI/ActorSystem.h>
-#include <GameEngineFrameWork/Profiler/Profiler.h>
+#include <GameEngineFramework/Physics/PhysicsSystem.h>
+#include <GameEngineFramework/Renderer/RenderSystem.h>
+#include <GameEngineFramework/Resources/ResourceManager.h>
+#include <GameEngineFramework/Scripting/ScriptSystem.h>
+#include <GameEngineFramework/Serialization/Serialization.h>
+#include <GameEngineFramework/ActorAI/ActorSystem.h>
+#include <GameEngineFramework/Profiler/profiler.h>
 
 #include <GameEngineFramework/MemoryAllocation/PoolAllocator.h>
 #include <GameEngineFramework/Logging/Logging.h>
-#include <GameEngineFramework/Timer/timer.h>
+#include <GameEngineFramework/Timer/Timer.h>
+#include <GameEngineFramework/Timer/Clock.h>
+#include <GameEngineFramework/Timer/Scheduler.h>
 
-#include <GameEngineFrameWork/Application/Platform.h>
+#include <GameEngineFramework/Application/Platform.h>
 
-#include <GameEngineFrameWork/Engine/Engine.h>
+#include <GameEngineFramework/Engine/Engine.h>
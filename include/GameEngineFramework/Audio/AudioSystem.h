@@ -5,7 +5,7 @@
 #include <GameEngineFramework/Audio/components/sound.h>
 #include <GameEngineFramework/Audio/components/samplebuffer.h>
 
-#include <GameEngineFramework/MemoryAllocation/poolallocator.h>
+#include <GameEngineFramework/MemoryAllocation/PoolAllocator.h>
 #include <GameEngineFramework/Logging/Logging.h>
 #include <GameEngineFramework/Math/Random.h>
 #include <glm/glm.hpp>
@@ -58,8 +58,6 @@ private:
     PoolAllocator<Sound> mSounds;
     PoolAllocator<AudioSample> mSamples;
     
-    std::thread* audioThread;
-    
     ALCdevice* mDevice;
     ALCcontext* mContext;
     
@@ -10,11 +10,13 @@
 #include <GameEngineFramework/Engine/UI/text.h>
 #include <GameEngineFramework/Engine/UI/button.h>
 
-#include <GameEngineFramework/application/Platform.h>
+#include <GameEngineFramework/Engine/types/spatialgrid.h>
+
+#include <GameEngineFramework/Application/Platform.h>
 
 #include <GameEngineFramework/Resources/ResourceManager.h>
 #include <GameEngineFramework/Physics/PhysicsSystem.h>
-#include <GameEngineFramework/Profiler/Profiler.h>
+#include <GameEngineFramework/Profiler/profiler.h>
 #include <GameEngineFramework/Scripting/components/script.h>
 
 #include <GameEngineFramework/Renderer/components/meshrenderer.h>
@@ -22,17 +24,19 @@
 
 #include <GameEngineFramework/ActorAI/ActorSystem.h>
 #include <GameEngineFramework/ActorAI/components/actor.h>
-#include <GameEngineFramework/ActorAI/Genetics/Gene.h>
+#include <GameEngineFramework/ActorAI/genetics/Gene.h>
 
-#include <GameEngineFramework/Types/types.h>
+#include <GameEngineFramework/Types/Types.h>
 #include <GameEngineFramework/Logging/Logging.h>
-#include <GameEngineFramework/Timer/timer.h>
+#include <GameEngineFramework/Timer/Timer.h>
 
 #include <GameEngineFramework/Math/Math.h>
 #include <GameEngineFramework/Math/Random.h>
 
 #include <GameEngineFramework/Networking/NetworkSystem.h>
 
+#include <GameEngineFramework/JobSystem/JobSystem.h>
+
 #define  CONSOLE_NUMBER_OF_ELEMENTS   32
 #define  PROFILER_NUMBER_OF_ELEMENTS  24
 
@@ -47,11 +51,65 @@ typedef void(*ButtonCallBack)();
 
 #define COMPONENT_STREAM_BUFFER_SIZE   1024 * 64
 
+// Size of the cells the camera moves through before distance limited objects are re-evaluated
+#define COMPONENT_STREAM_CELL_SIZE     16.0f
+
+// Index of an object which is not in a stream list
+#define COMPONENT_STREAM_INDEX_NONE    0xffffffff
+
+// Time in microseconds the garbage collector may spend each update by default
+#define GARBAGE_COLLECTION_BUDGET             1000
+
+// Largest number of game objects purged between time checks
+#define GARBAGE_COLLECTION_BATCH_MAX          64
+
+// Bounds on the number of clean rigid bodies kept for reuse
+#define GARBAGE_FREE_RIGID_BODIES_MIN         16
+#define GARBAGE_FREE_RIGID_BODIES_MAX         4096
+
+// Rate at which the peak rigid body demand falls away each update
+#define GARBAGE_RIGID_BODY_DEMAND_DECAY       0.995f
+
 
 class ENGINE_API EngineSystemManager {
     
 public:
     
+    /// Work done by the garbage collector during an update.
+    struct GarbageCollectionStats {
+        
+        /// Game objects destroyed.
+        unsigned int objectsDestroyed;
+        
+        /// Rigid bodies cleaned and returned to the free list.
+        unsigned int rigidBodiesRecycled;
+        
+        /// Rigid bodies released back to the physics world.
+        unsigned int rigidBodiesDestroyed;
+        
+        /// Time spent collecting in microseconds.
+        float timeSpent;
+        
+        /// Game objects still waiting to be destroyed.
+        unsigned int gameObjectBacklog;
+        
+        /// Rigid bodies still waiting to be cleaned.
+        unsigned int rigidBodyBacklog;
+        
+        /// Number of clean rigid bodies which may be kept for reuse.
+        unsigned int freeRigidBodyCapacity;
+        
+        GarbageCollectionStats() : 
+            objectsDestroyed(0),
+            rigidBodiesRecycled(0),
+            rigidBodiesDestroyed(0),
+            timeSpent(0),
+            gameObjectBacklog(0),
+            rigidBodyBacklog(0),
+            freeRigidBodyCapacity(0)
+        {}
+    };
+    
     /// Main active rendering scene.
     Scene* sceneMain;
     
@@ -70,6 +128,21 @@ public:
     /// Return a pointer to a game object at the index position.
     GameObject* GetGameObject(unsigned int index);
     
+    /// Create a number of game objects in a single pass and return their pointers. Returns an empty list if the pools are full.
+    std::vector<GameObject*> CreateGameObjects(unsigned int count);
+    
+    /// Destroy a list of game objects and their components in a single pass.
+    void DestroyGameObjects(std::vector<GameObject*>& gameObjects);
+    
+    /// Queue a game object to have its activation state re-evaluated on the next update.
+    void MarkGameObjectDirty(GameObject* gameObject);
+    
+    /// Append the game objects within the radius of a position to the results. Returns the number of objects found.
+    unsigned int FindGameObjectsInRadius(glm::vec3 position, float radius, std::vector<GameObject*>& results);
+    
+    /// Append the game objects inside an axis aligned box to the results. Returns the number of objects found.
+    unsigned int FindGameObjectsInBox(glm::vec3 min, glm::vec3 max, std::vector<GameObject*>& results);
+    
     
     // Special components and game objects
     
@@ -88,6 +161,9 @@ public:
     /// Create an AI actor component and return its pointer.
     GameObject* CreateAIActor(glm::vec3 position);
     
+    /// Create an AI actor at each of the positions given and return their game objects.
+    std::vector<GameObject*> CreateAIActors(std::vector<glm::vec3>& positions);
+    
     
     // UI elements
     
@@ -297,6 +373,61 @@ public:
         return false;
     }
     
+    /// Create an object of the type specified and return a generational handle to it.
+    template <typename T> PoolHandle<T> CreateHandle(void) {
+        
+        return GetHandle<T>( Create<T>() );
+    }
+    
+    /// Destroy an object referenced by a handle. Stale handles are rejected.
+    template <typename T> bool Destroy(PoolHandle<T> handle) {
+        
+        T* objectPtr = Resolve<T>(handle);
+        
+        if (objectPtr == nullptr) 
+            return false;
+        
+        return Destroy<T>(objectPtr);
+    }
+    
+    /// Return a generational handle referencing an object of the type specified.
+    template <typename T> PoolHandle<T> GetHandle(T* objectPtr) {
+        
+        ConcurrentPoolAllocator<T>* concurrentAllocator = GetConcurrentAllocator<T>();
+        
+        if (concurrentAllocator != nullptr) 
+            return concurrentAllocator->GetHandle(objectPtr);
+        
+        PoolAllocator<T>* allocator = GetAllocator<T>();
+        
+        if (allocator == nullptr) 
+            return PoolHandle<T>();
+        
+        return allocator->GetHandle(objectPtr);
+    }
+    
+    /// Return the object referenced by a handle or a null pointer if the object has since been destroyed.
+    template <typename T> T* Resolve(PoolHandle<T> handle) {
+        
+        ConcurrentPoolAllocator<T>* concurrentAllocator = GetConcurrentAllocator<T>();
+        
+        if (concurrentAllocator != nullptr) 
+            return concurrentAllocator->Resolve(handle);
+        
+        PoolAllocator<T>* allocator = GetAllocator<T>();
+        
+        if (allocator == nullptr) 
+            return nullptr;
+        
+        return allocator->Resolve(handle);
+    }
+    
+    /// Return whether a handle still references a living object.
+    template <typename T> bool CheckIsValid(PoolHandle<T> handle) {
+        
+        return Resolve<T>(handle) != nullptr;
+    }
+    
     /// Create a component object containing the type specified.
     template <typename T> Component* CreateComponent(void) {
         
@@ -335,6 +466,21 @@ public:
     /// Render the physics debug lines / triangles.
     void UpdatePhysicsDebugRenderer(void);
     
+    /// Release any object pools across the engine, renderer and AI which no longer hold any objects.
+    void ReleaseFreeMemory(void);
+    
+    /// Set the time in microseconds the garbage collector may spend destroying objects each update.
+    void SetGarbageCollectionBudget(unsigned int microseconds);
+    
+    /// Return the time in microseconds the garbage collector may spend each update.
+    unsigned int GetGarbageCollectionBudget(void);
+    
+    /// Return the work done by the garbage collector during the last update.
+    GarbageCollectionStats GetGarbageCollectionStats(void);
+    
+    /// Destroy every object waiting to be garbage collected regardless of the time budget.
+    void CollectAllGarbage(void);
+    
     
 private:
     
@@ -347,9 +493,62 @@ private:
     // Destroy a game object.
     bool DestroyGameObject(GameObject* gameObjectPtr);
     
+    // Attach the actor and rigid body components to a game object.
+    void InitiateAIActor(GameObject* gameObject, glm::vec3 position);
+    
     // Process the objects marked as garbage
     void ProcessDeferredDeletion(void);
     
+    // Destroy the components and containers of a list of garbage game objects
+    void PurgeGameObjects(GameObject** gameObjects, unsigned int count);
+    
+    // Return the estimated cost of destroying a game object
+    unsigned int GetGarbageCost(GameObject* gameObject);
+    
+    // Stop the components of a game object from being simulated or rendered while it waits to be destroyed
+    void DisableGarbageComponents(GameObject* gameObject);
+    
+    // Strip a rigid body back to its default state before it is reused
+    void RecycleRigidBody(RigidBody* rigidBody);
+    
+    // Return the allocator which owns objects of the type specified.
+    template <typename T> PoolAllocator<T>* GetAllocator(void) {
+        
+        // Engine
+        if (std::is_same<T, GameObject>::value)    return (PoolAllocator<T>*)&mGameObjects;
+        if (std::is_same<T, Component>::value)     return (PoolAllocator<T>*)&mComponents;
+        if (std::is_same<T, Transform>::value)     return (PoolAllocator<T>*)&mTransforms;
+        if (std::is_same<T, Text>::value)          return (PoolAllocator<T>*)&mTextObjects;
+        if (std::is_same<T, Panel>::value)         return (PoolAllocator<T>*)&mPanelObjects;
+        if (std::is_same<T, Button>::value)        return (PoolAllocator<T>*)&mButtons;
+        
+        // Renderer
+        if (std::is_same<T, Mesh>::value)          return (PoolAllocator<T>*)&Renderer.mMesh;
+        if (std::is_same<T, Shader>::value)        return (PoolAllocator<T>*)&Renderer.mShader;
+        if (std::is_same<T, Scene>::value)         return (PoolAllocator<T>*)&Renderer.mScene;
+        if (std::is_same<T, Camera>::value)        return (PoolAllocator<T>*)&Renderer.mCamera;
+        if (std::is_same<T, Light>::value)         return (PoolAllocator<T>*)&Renderer.mLight;
+        if (std::is_same<T, MeshRenderer>::value)  return (PoolAllocator<T>*)&Renderer.mEntity;
+        if (std::is_same<T, Texture>::value)       return (PoolAllocator<T>*)&Renderer.mTexture;
+        if (std::is_same<T, FrameBuffer>::value)   return (PoolAllocator<T>*)&Renderer.mFrameBuffer;
+        
+        return nullptr;
+    }
+    
+    // Return the thread aware allocator which owns objects of the type specified.
+    template <typename T> ConcurrentPoolAllocator<T>* GetConcurrentAllocator(void) {
+        
+        extern ActorSystem AI;
+        
+        // Renderer
+        if (std::is_same<T, Material>::value)      return (ConcurrentPoolAllocator<T>*)&Renderer.mMaterial;
+        
+        // AI
+        if (std::is_same<T, Actor>::value)         return (ConcurrentPoolAllocator<T>*)&AI.mActors;
+        
+        return nullptr;
+    }
+    
     
     //
     // Profiler
@@ -398,7 +597,8 @@ private:
     
     
     // Batch update engine components
-    void UpdateTransformationChains(void);
+    JobHandle UpdateTransformationChains(const JobHandle& dependency);
+    void UpdateSpatialGrid(void);
     void UpdateUI(void);
     
     // Console
@@ -433,6 +633,25 @@ private:
     // Clean rigid bodies
     std::vector<RigidBody*>  mFreeRigidBodies;
     
+    // Time the collector may spend each update in microseconds
+    unsigned int mGarbageBudget;
+    
+    // Measured time in microseconds to destroy one unit of garbage cost
+    float mGarbageCostEstimate;
+    
+    // Rigid bodies requested since the last collection
+    unsigned int mRigidBodyRequests;
+    
+    // Decaying peak of the rigid bodies requested in a single update
+    float mRigidBodyDemand;
+    
+    // Number of clean rigid bodies kept for reuse
+    unsigned int mFreeRigidBodyCapacity;
+    
+    GarbageCollectionStats mGarbageStats;
+    
+    Timer mGarbageTimer;
+    
     // Component allocators
     PoolAllocator<GameObject> mGameObjects;
     PoolAllocator<Component>  mComponents;
@@ -450,6 +669,7 @@ private:
         Shader*  textureUnlit = nullptr;
         Shader*  color = nullptr;
         Shader*  colorUnlit = nullptr;
+        Shader*  colorInstanced = nullptr;
         Shader*  UI = nullptr;
         Shader*  shadowCaster = nullptr;
         Shader*  sky = nullptr;
@@ -488,10 +708,82 @@ private:
     
     void UpdateComponentStream(void);
     
-    unsigned int mDataStreamIndex;
-    unsigned int mObjectIndex;
+    // Re-evaluate the activation state of a game object and update its stream buffer entry
+    void UpdateGameObjectActivation(GameObject* gameObject);
+    
+    // Remove a game object from the stream buffer and the activation lists
+    void RemoveGameObjectFromStream(GameObject* gameObject);
+    
+    // Remove a game object from the list of distance limited objects
+    void RemoveGameObjectFromDistanceList(GameObject* gameObject);
+    
+    // Find the largest render distance in the list of distance limited objects
+    void UpdateStreamMaxRenderDistance(void);
+    
+    // Accumulate the position down the parent chain. The cached world values
+    // are only kept current for transforms in the stream
+    glm::vec3 GetStreamWorldPosition(Transform* transform);
+    
     unsigned int mStreamSize;
     
+    // Game objects waiting to have their activation re-evaluated
+    std::vector<GameObject*> mDirtyGameObjects;
+    
+    // Game objects turned away while the stream buffer was full
+    std::vector<GameObject*> mWaitingGameObjects;
+    
+    struct DistanceGameObject {
+        
+        GameObject* gameObject;
+        
+        // Render distance when last evaluated
+        float renderDistance;
+    };
+    
+    // Game objects limited by a render distance. These are re-evaluated
+    // when the camera or the object itself moves into a new cell
+    std::vector<DistanceGameObject> mDistanceGameObjects;
+    
+    // Distance limited objects which entered a new grid cell during the spatial grid pass
+    std::vector<GameObject*> mMovedGameObjects;
+    
+    glm::ivec3 mStreamCameraCell;
+    bool mHasStreamCameraCell;
+    
+    // Largest render distance in the distance list
+    float mStreamMaxRenderDistance;
+    
+    // The object with the largest render distance has left the list or moved closer
+    bool mIsStreamMaxRenderDistanceDirty;
+    
+    // Spatial index of the game objects by world position
+    SpatialGrid mSpatialGrid;
+    
+    //
+    // Transform hierarchy
+    //
+    
+    // Rebuild the transform update order from the stream and its parent chains
+    void UpdateTransformOrder(void);
+    
+    struct TransformOrderEntry {
+        // Transform to update
+        Transform* transform;
+        // Parent when the order was built
+        Transform* parent;
+        // Parents outside the stream only pass their values down
+        bool       isStreamed;
+    };
+    
+    // Transforms sorted by depth so every parent is updated before its children
+    std::vector<TransformOrderEntry> mTransformOrder;
+    
+    // Index of the first entry of each depth in the transform order
+    std::vector<unsigned int> mTransformLevels;
+    
+    // The stream has changed since the order was built
+    bool mIsTransformOrderDirty;
+    
     struct ComponentDataStreamBuffer {
         // Base object
         GameObject*    gameObject;
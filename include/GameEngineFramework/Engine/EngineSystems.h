@@ -23,6 +23,7 @@ ENGINE_API extern AudioPreset       Samples;
 ENGINE_API extern InputSystem       Input;
 ENGINE_API extern MathCore          Math;
 ENGINE_API extern ActorSystem       AI;
+ENGINE_API extern JobSystem         Jobs;
 
 ENGINE_API extern ProfilerTimer     Profiler;
 ENGINE_API extern PlatformLayer     Platform;
@@ -27,13 +27,19 @@ public:
     /// Object name.
     std::string name;
     
-    /// Should this game object be active in the scene.
-    bool isActive;
+    GameObject();
     
-    /// Distance within which this object will be updated.
-    float renderDistance;
+    /// Set whether this game object should be active in the scene.
+    void SetActive(bool state);
     
-    GameObject();
+    /// Return whether this game object is active in the scene.
+    bool GetActive(void);
+    
+    /// Set the distance from the camera within which this object will be updated. A distance of zero or less disables the check.
+    void SetRenderDistance(float distance);
+    
+    /// Return the distance from the camera within which this object will be updated.
+    float GetRenderDistance(void);
     
     //
     // Components
@@ -182,6 +188,24 @@ private:
     // Is this object marked for destruction by garbage collection.
     bool mIsGarbage;
     
+    // Should this game object be active in the scene.
+    bool mIsActive;
+    
+    // Distance within which this object will be updated.
+    float mRenderDistance;
+    
+    // Is this object waiting to have its activation re-evaluated.
+    bool mIsDirty;
+    
+    // Is this object waiting for a free slot in the component stream buffer.
+    bool mIsWaitingForStream;
+    
+    // Position of the object in the component stream buffer.
+    unsigned int mStreamIndex;
+    
+    // Position of the object in the list of distance limited objects.
+    unsigned int mDistanceIndex;
+    
     // List of attached components
     std::vector<Component*> mComponentList;
     
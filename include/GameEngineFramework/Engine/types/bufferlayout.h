@@ -39,4 +39,18 @@ struct ENGINE_API Index  {
 };
 
 
+struct ENGINE_API Instance {
+    
+    /// Model matrix
+    float model[16];
+    
+    /// Inverse transpose model matrix
+    float normal[9];
+    
+    /// Color
+    float r, g, b;
+    
+};
+
+
 #endif
@@ -0,0 +1,95 @@
+//
+// Uniform spatial hash grid
+//
+// Game objects are bucketed by the cell containing their world position.
+// Only occupied cells are stored, so the grid is unbounded and a query
+// only touches the cells overlapping the query volume.
+
+#ifndef _SPATIAL_GRID_TYPE__
+#define _SPATIAL_GRID_TYPE__
+
+#include <GameEngineFramework/configuration.h>
+#include <GameEngineFramework/MemoryAllocation/FrameArena.h>
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// Default width of a grid cell in world units
+#define  SPATIAL_GRID_CELL_SIZE   32.0f
+
+class GameObject;
+
+
+class ENGINE_API SpatialGrid {
+
+public:
+    
+    /// Add a game object to the grid or move it to a new position. Returns whether the object entered a different cell.
+    bool Update(GameObject* gameObject, glm::vec3 position);
+    
+    /// Remove a game object from the grid.
+    void Remove(GameObject* gameObject);
+    
+    /// Remove every game object from the grid.
+    void Clear(void);
+    
+    /// Append the game objects within the radius of a position to the results. Returns the number of objects found.
+    unsigned int QueryRadius(glm::vec3 position, float radius, std::vector<GameObject*>& results);
+    
+    /// Append the game objects inside an axis aligned box to the results. Returns the number of objects found.
+    unsigned int QueryBox(glm::vec3 min, glm::vec3 max, std::vector<GameObject*>& results);
+    
+    /// Return whether the game object is held by the grid.
+    bool CheckContains(GameObject* gameObject);
+    
+    /// Return the number of game objects in the grid.
+    unsigned int GetNumberOfObjects(void);
+    
+    /// Return the number of occupied cells.
+    unsigned int GetNumberOfCells(void);
+    
+    /// Return the width of a cell in world units.
+    float GetCellSize(void);
+    
+    SpatialGrid(float cellSize = SPATIAL_GRID_CELL_SIZE);
+    
+private:
+    
+    struct Item {
+        GameObject* gameObject;
+        glm::vec3   position;
+    };
+    
+    struct Location {
+        std::uint64_t cell;
+        unsigned int  slot;
+    };
+    
+    // Return the cell coordinate containing a position
+    glm::ivec3 GetCell(glm::vec3 position);
+    
+    // Pack a cell coordinate into a single hash key
+    static std::uint64_t GetCellKey(glm::ivec3 cell);
+    
+    // Remove the item at a slot by swapping the last item of the cell into its place
+    void RemoveFromCell(std::uint64_t cell, unsigned int slot);
+    
+    // Unpack a hash key back into a cell coordinate
+    static glm::ivec3 GetCellFromKey(std::uint64_t key);
+    
+    // Gather the occupied cells overlapping the box
+    void GatherCells(glm::vec3 min, glm::vec3 max, FrameVector<std::vector<Item>*>& cells);
+    
+    float mCellSize;
+    float mInverseCellSize;
+    
+    std::unordered_map<std::uint64_t, std::vector<Item>> mCells;
+    
+    std::unordered_map<GameObject*, Location> mLocations;
+    
+};
+
+#endif
@@ -0,0 +1,164 @@
+//
+// Work stealing job system
+//
+// Each worker thread owns a queue of jobs. Workers take work from the
+// back of their own queue and steal from the front of the others when
+// they run dry. Jobs may depend on other jobs and are only queued once
+// every job they depend on has finished. Jobs marked for the main thread
+// are held until the main thread runs them once per frame.
+
+#ifndef _JOB_SYSTEM__
+#define _JOB_SYSTEM__
+
+#include <GameEngineFramework/configuration.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Default number of elements processed by a single chunk
+#define  JOB_SYSTEM_GRAIN_SIZE   256
+
+// Upper limit on the number of chunks per thread a range is split into
+#define  JOB_SYSTEM_CHUNKS_PER_THREAD   4
+
+
+/// Function run by a job.
+typedef std::function<void()> JobFunction;
+
+/// Function called for each chunk with the first index and one past the last index.
+typedef std::function<void(unsigned int begin, unsigned int end)> JobRangeFunction;
+
+
+struct Job;
+
+
+/// Reference to a scheduled job. An empty handle counts as complete.
+class ENGINE_API JobHandle {
+
+public:
+    
+    /// Return whether the job has finished running.
+    bool CheckIsComplete(void) const;
+    
+    /// Return whether the handle refers to a job.
+    bool CheckIsValid(void) const;
+    
+    JobHandle();
+    JobHandle(const JobHandle& handle);
+    ~JobHandle();
+    
+    JobHandle& operator= (const JobHandle& handle);
+    
+    friend class JobSystem;
+    
+private:
+    
+    JobHandle(Job* job);
+    
+    Job* mJob;
+    
+};
+
+
+class ENGINE_API JobSystem {
+
+public:
+    
+    /// Start the worker threads. Zero workers selects one less than the number of hardware threads.
+    void Initiate(unsigned int numberOfWorkers = 0);
+    
+    /// Run every outstanding job then stop and join the worker threads.
+    void Shutdown(void);
+    
+    /// Queue a function to run on a worker thread.
+    JobHandle Schedule(const JobFunction& function);
+    
+    /// Queue a function to run on a worker thread once the dependency has finished.
+    JobHandle Schedule(const JobFunction& function, const JobHandle& dependency);
+    
+    /// Queue a function to run on a worker thread once every dependency has finished.
+    JobHandle Schedule(const JobFunction& function, const std::vector<JobHandle>& dependencies);
+    
+    /// Queue a function to run on the main thread during RunMainThreadJobs once the dependency has finished.
+    JobHandle ScheduleMainThread(const JobFunction& function, const JobHandle& dependency = JobHandle());
+    
+    /// Split a range into chunks run across the workers once the dependency has finished. The handle completes with the last chunk.
+    JobHandle ScheduleParallelFor(unsigned int count, unsigned int grainSize, const JobRangeFunction& function, const JobHandle& dependency = JobHandle());
+    
+    /// Split a range into chunks and run them across the workers. Blocks until every chunk has finished.
+    void ParallelFor(unsigned int count, unsigned int grainSize, const JobRangeFunction& function);
+    
+    /// Block until the job has finished. The calling thread runs other jobs while it waits.
+    void Wait(const JobHandle& handle);
+    
+    /// Run the jobs queued for the main thread. Called once per frame by the engine.
+    void RunMainThreadJobs(void);
+    
+    /// Return the number of worker threads, not counting the calling thread.
+    unsigned int GetNumberOfWorkers(void);
+    
+    /// Return whether the calling thread is one of the worker threads.
+    static bool CheckIsWorkerThread(void);
+    
+    JobSystem();
+    ~JobSystem();
+    
+private:
+    
+    struct WorkerQueue {
+        std::deque<Job*> jobs;
+        std::mutex mux;
+    };
+    
+    // Worker thread entry point
+    void WorkerMain(unsigned int index);
+    
+    // Create a job holding a reference for the scheduler
+    Job* CreateJob(const JobFunction& function, bool isMainThread);
+    
+    // Hold the job back until the dependency has finished
+    void AddDependency(Job* job, const JobHandle& dependency);
+    
+    // Release the guard placed on a new job and queue it if nothing else holds it back
+    void Submit(Job* job);
+    
+    // Queue a job which is ready to run
+    void Enqueue(Job* job);
+    
+    // Take a job from the queue of the calling thread or steal one from another
+    Job* FindJob(void);
+    
+    // Run a job, release the jobs waiting on it and drop the scheduler reference
+    void Execute(Job* job);
+    
+    std::vector<std::thread*> mWorkers;
+    
+    // One queue per worker plus a shared queue for jobs from other threads
+    std::vector<WorkerQueue*> mQueues;
+    WorkerQueue mSharedQueue;
+    
+    // Jobs which may only run on the main thread
+    std::vector<Job*> mMainThreadJobs;
+    std::mutex mMainThreadMux;
+    
+    std::thread::id mMainThreadID;
+    
+    bool mIsActive;
+    
+    // Number of jobs sitting in the worker and shared queues
+    std::atomic<int> mNumberOfQueuedJobs;
+    
+    // Position to start stealing from
+    std::atomic<unsigned int> mStealIndex;
+    
+    std::mutex mux;
+    std::condition_variable mWorkReady;
+    
+};
+
+#endif
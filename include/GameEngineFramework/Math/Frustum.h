@@ -0,0 +1,73 @@
+//
+// View frustum
+//
+// The six planes of a camera are extracted from its view projection
+// matrix with the normals facing inward. A box is culled when it lies
+// entirely behind any plane. Boxes held as separate component arrays are
+// tested four or eight at once with the widest instruction set the
+// processor supports.
+
+#ifndef _VIEW_FRUSTUM__
+#define _VIEW_FRUSTUM__
+
+#include <GameEngineFramework/configuration.h>
+
+#include <glm/glm.hpp>
+
+
+class ENGINE_API Frustum {
+
+public:
+    
+    /// Instruction sets a batch of boxes may be tested with.
+    enum class InstructionSet {
+        Scalar,
+        SSE,
+        AVX
+    };
+    
+    /// Component arrays of a batch of axis aligned boxes.
+    struct BoxArrays {
+        
+        const float* minX;
+        const float* minY;
+        const float* minZ;
+        
+        const float* maxX;
+        const float* maxY;
+        const float* maxZ;
+    };
+    
+    /// Planes as an inward normal and distance. Left, right, bottom, top, near then far.
+    glm::vec4 planes[6];
+    
+    /// Extract the planes from a view projection matrix.
+    void SetViewProjection(const glm::mat4& viewProjection);
+    
+    /// Return whether any part of an axis aligned box may be inside the frustum.
+    bool CheckBox(const glm::vec3& min, const glm::vec3& max) const;
+    
+    /// Return whether any part of an axis aligned box may be inside the planes selected by a mask. Planes the box lies entirely inside are cleared from the mask, so boxes within this one may skip them.
+    bool CheckBoxPlanes(const glm::vec3& min, const glm::vec3& max, unsigned int& planeMask) const;
+    
+    /// Return whether any part of a sphere may be inside the frustum.
+    bool CheckSphere(const glm::vec3& center, float radius) const;
+    
+    /// Test a batch of boxes. One is written for each box which may be inside the frustum and zero for each box which is not.
+    void CheckBoxes(const BoxArrays& boxes, unsigned int count, unsigned char* visible) const;
+    
+    
+    /// Return the instruction set batches are tested with.
+    static InstructionSet GetInstructionSet(void);
+    
+    /// Select the instruction set batches are tested with. Sets the processor does not support fall back to the widest supported set.
+    static void SetInstructionSet(InstructionSet instructionSet);
+    
+    /// Return the widest instruction set the processor supports.
+    static InstructionSet GetSupportedInstructionSet(void);
+    
+    Frustum();
+    
+};
+
+#endif
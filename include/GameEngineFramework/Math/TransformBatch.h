@@ -0,0 +1,88 @@
+//
+// Batched transform matrix composition
+//
+// Positions, rotations and scales are queued into separate arrays so the
+// model matrices of several transforms are composed at once. The normal
+// matrix of each transform is written in the same pass. The widest
+// instruction set the processor supports is picked on first use.
+
+#ifndef _TRANSFORM_BATCH__
+#define _TRANSFORM_BATCH__
+
+#include <GameEngineFramework/configuration.h>
+#include <GameEngineFramework/MemoryAllocation/FrameArena.h>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+
+class ENGINE_API TransformBatch {
+
+public:
+    
+    /// Instruction sets a batch may be composed with.
+    enum class InstructionSet {
+        Scalar,
+        SSE,
+        AVX2
+    };
+    
+    /// Queue a transform. Rotating the translation composes rotation * translation * scale rather than translation * rotation * scale.
+    void Add(glm::vec3 position, glm::quat rotation, glm::vec3 scale, bool rotateTranslation, glm::mat4* matrix, glm::mat3* normalMatrix);
+    
+    /// Compose the matrices and normal matrices of every queued transform then empty the batch.
+    void Compose(void);
+    
+    /// Reserve room for a number of transforms.
+    void Reserve(unsigned int count);
+    
+    /// Empty the batch without composing.
+    void Clear(void);
+    
+    /// Return the number of queued transforms.
+    unsigned int Size(void);
+    
+    
+    /// Compose a single matrix and its normal matrix.
+    static void ComposeMatrix(glm::vec3 position, glm::quat rotation, glm::vec3 scale, bool rotateTranslation, glm::mat4& matrix, glm::mat3& normalMatrix);
+    
+    /// Return the inverse transpose of the rotation and scale of a matrix.
+    static glm::mat3 CalculateNormalMatrix(const glm::mat4& matrix);
+    
+    /// Blend between two model matrices. Translation and scale are blended linearly and rotation spherically.
+    static glm::mat4 InterpolateMatrix(const glm::mat4& from, const glm::mat4& to, float factor);
+    
+    /// Return the instruction set batches are composed with.
+    static InstructionSet GetInstructionSet(void);
+    
+    /// Select the instruction set batches are composed with. Sets the processor does not support fall back to the widest supported set.
+    static void SetInstructionSet(InstructionSet instructionSet);
+    
+    /// Return the widest instruction set the processor supports.
+    static InstructionSet GetSupportedInstructionSet(void);
+    
+private:
+    
+    FrameVector<float> mPositionX;
+    FrameVector<float> mPositionY;
+    FrameVector<float> mPositionZ;
+    
+    FrameVector<float> mRotationX;
+    FrameVector<float> mRotationY;
+    FrameVector<float> mRotationZ;
+    FrameVector<float> mRotationW;
+    
+    FrameVector<float> mScaleX;
+    FrameVector<float> mScaleY;
+    FrameVector<float> mScaleZ;
+    
+    // One when the translation is rotated, otherwise zero
+    FrameVector<float> mRotateTranslation;
+    
+    // Destinations of the composed matrices
+    FrameVector<glm::mat4*> mMatrices;
+    FrameVector<glm::mat3*> mNormalMatrices;
+    
+};
+
+#endif
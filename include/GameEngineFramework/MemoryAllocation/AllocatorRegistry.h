@@ -0,0 +1,143 @@
+//
+// Allocator telemetry registry
+//
+// Every pool allocator registers itself on construction and is queried
+// for its current statistics on demand. The engine offers a sample every
+// frame, but create and destroy rates are only measured once at least
+// ALLOCATOR_SAMPLE_INTERVAL seconds have passed since the last sample.
+
+#ifndef _ALLOCATOR_REGISTRY_SUPPORT__
+#define _ALLOCATOR_REGISTRY_SUPPORT__
+
+#include <GameEngineFramework/configuration.h>
+
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Minimum time between rate samples in seconds
+#define  ALLOCATOR_SAMPLE_INTERVAL   1.0
+
+
+struct ENGINE_API AllocatorStatistics {
+    
+    /** Name of the type held by the allocator.*/
+    std::string name;
+    
+    /** Number of live objects.*/
+    unsigned int liveCount;
+    
+    /** Total number of object slots across all slabs.*/
+    unsigned int capacity;
+    
+    /** Number of allocated slabs.*/
+    unsigned int slabCount;
+    
+    /** Largest number of live objects at any one time.*/
+    unsigned int highWaterMark;
+    
+    /** Size of a single object in bytes.*/
+    std::size_t objectSize;
+    
+    /** Total memory held by the slabs in bytes.*/
+    std::size_t bytesReserved;
+    
+    /** Memory held by the slabs which is not occupied by live objects.
+        Includes unused slots, per slot bookkeeping and slab headers.*/
+    std::size_t bytesWasted;
+    
+    /** Number of objects created over the lifetime of the allocator.*/
+    unsigned long long totalCreated;
+    
+    /** Number of objects destroyed over the lifetime of the allocator.*/
+    unsigned long long totalDestroyed;
+    
+    /** Objects created per second over the last sample interval.*/
+    float createRate;
+    
+    /** Objects destroyed per second over the last sample interval.*/
+    float destroyRate;
+    
+    AllocatorStatistics() : 
+        liveCount(0),
+        capacity(0),
+        slabCount(0),
+        highWaterMark(0),
+        objectSize(0),
+        bytesReserved(0),
+        bytesWasted(0),
+        totalCreated(0),
+        totalDestroyed(0),
+        createRate(0),
+        destroyRate(0)
+    {}
+    
+};
+
+
+/// Fills in the statistics of the allocator passed in.
+typedef void(*AllocatorQueryFunction)(void* allocator, AllocatorStatistics& statistics);
+
+
+class ENGINE_API AllocatorRegistry {
+
+public:
+    
+    /// Register an allocator under the type name given.
+    void Register(void* allocator, const std::string& name, AllocatorQueryFunction query);
+    
+    /// Remove an allocator from the registry.
+    void Unregister(void* allocator);
+    
+    /// Rename a registered allocator to tell apart allocators of the same type.
+    void SetName(void* allocator, const std::string& name);
+    
+    /// Update the create and destroy rates. Rates are only recalculated once the sample interval has elapsed.
+    void Sample(void);
+    
+    /// Return the statistics of every registered allocator.
+    std::vector<AllocatorStatistics> GetStatistics(void);
+    
+    /// Return the number of registered allocators.
+    unsigned int GetNumberOfAllocators(void);
+    
+    /// Write the statistics of every registered allocator to a CSV file.
+    bool WriteCSV(const std::string& filename);
+    
+    /// Return a readable type name from the name given by typeid.
+    static std::string GetTypeName(const char* typeName);
+    
+    /// Return the registry shared by all allocators.
+    static AllocatorRegistry& Get(void);
+    
+    AllocatorRegistry();
+    
+private:
+    
+    struct Entry {
+        
+        void* allocator;
+        
+        std::string name;
+        
+        AllocatorQueryFunction query;
+        
+        unsigned long long lastCreated;
+        unsigned long long lastDestroyed;
+        
+        float createRate;
+        float destroyRate;
+        
+    };
+    
+    std::vector<Entry> mEntries;
+    
+    std::chrono::steady_clock::time_point mLastSample;
+    
+    std::mutex mux;
+    
+};
+
+#endif
@@ -0,0 +1,782 @@
+//
+// Thread aware allocator pool class
+//
+// Objects may be created and destroyed from any thread. Each thread
+// draws free slots from its own cache, refilled in batches from a
+// lock free depot shared by all threads. The lock is only taken when
+// the depot runs dry and a new slab must be allocated.
+//
+// The active list is owned by a single thread which must call
+// Synchronize() periodically. Created objects are published to the
+// active list and destroyed objects are destructed on synchronization.
+
+#ifndef _CONCURRENT_POOL_ALLOCATOR_SUPPORT__
+#define _CONCURRENT_POOL_ALLOCATOR_SUPPORT__
+
+#include <GameEngineFramework/MemoryAllocation/PoolAllocator.h>
+
+#include <atomic>
+#include <mutex>
+
+// Number of free slots each thread may hold
+#define  POOL_THREAD_CACHE_SIZE       32
+
+// Number of free slots in the shared depot. Must be a power of two
+#define  POOL_DEPOT_SIZE              1024
+
+// Slot offset bits in a handle index
+#define  POOL_SLAB_SHIFT              16
+
+// Maximum number of slabs
+#define  POOL_MAX_SLABS               1024
+
+// Slot states
+#define  POOL_SLOT_STATE_FREE         0
+#define  POOL_SLOT_STATE_ACTIVE       1
+#define  POOL_SLOT_STATE_RETIRED      2
+
+
+template<typename T> struct ConcurrentPoolSlot {
+    
+    /** Object storage. Must remain the first member so an object pointer is also its slot pointer.*/
+    alignas(T) unsigned char object[sizeof(T)];
+    
+    /** Next slot in the created list awaiting synchronization.*/
+    ConcurrentPoolSlot<T>* nextCreated;
+    
+    /** Next slot in the retired list awaiting synchronization.*/
+    ConcurrentPoolSlot<T>* nextRetired;
+    
+    /** Current state of the slot.*/
+    std::atomic<unsigned int> state;
+    
+    /** Generation matched against handles. Advanced every time the object is destroyed.*/
+    std::atomic<unsigned int> generation;
+    
+    /** Position of the object in the active list, or POOL_SLOT_FREE.*/
+    unsigned int activeIndex;
+    
+    /** Handle index of the slot encoding its slab and offset.*/
+    unsigned int handleIndex;
+    
+};
+
+
+template<typename T> class ENGINE_API ConcurrentPoolAllocator {
+    
+    struct Slab {
+        ConcurrentPoolSlot<T>* slots;
+        unsigned int size;
+    };
+    
+    struct SlabEntry {
+        std::atomic<Slab*> slab;
+        unsigned int generationBase;
+    };
+    
+    struct DepotCell {
+        std::atomic<std::size_t> sequence;
+        ConcurrentPoolSlot<T>* slot;
+    };
+    
+    struct ThreadCache {
+        const ConcurrentPoolAllocator<T>* allocator;
+        unsigned int serial;
+        unsigned int count;
+        ConcurrentPoolSlot<T>* slots[POOL_THREAD_CACHE_SIZE];
+    };
+    
+    // Slab table indexed by the upper bits of a handle index
+    SlabEntry m_slabs[POOL_MAX_SLABS];
+    std::atomic<unsigned int> m_slabCount;
+    
+    // Bounded lock free queue of free slots shared between threads
+    DepotCell* m_depot;
+    alignas(POOL_CACHE_LINE_SIZE) std::atomic<std::size_t> m_depotEnqueue;
+    alignas(POOL_CACHE_LINE_SIZE) std::atomic<std::size_t> m_depotDequeue;
+    
+    // Objects waiting to be published or destructed by the owning thread
+    alignas(POOL_CACHE_LINE_SIZE) std::atomic<ConcurrentPoolSlot<T>*> m_created;
+    alignas(POOL_CACHE_LINE_SIZE) std::atomic<ConcurrentPoolSlot<T>*> m_retired;
+    
+    std::atomic<unsigned int> m_liveCount;
+    std::atomic<unsigned int> m_capacity;
+    
+    // Guards slab growth and the overflow list
+    std::mutex m_growLock;
+    std::vector< ConcurrentPoolSlot<T>* > m_overflow;
+    
+    // Owned by the synchronizing thread
+    std::vector< T* > m_activeList;
+    
+    unsigned int m_serial;
+    
+    unsigned int m_poolSz;
+    unsigned int m_poolSzNext;
+    unsigned int m_poolSzMax;
+    
+    // Telemetry counters updated by the synchronizing thread
+    std::atomic<unsigned int>       m_highWaterMark;
+    std::atomic<unsigned long long> m_totalCreated;
+    std::atomic<unsigned long long> m_totalDestroyed;
+    
+    void construct(T& objectRef) {new (&objectRef) T();}
+    void destruct(T& objectRef) {
+        
+        objectRef.~T();
+        
+    }
+    
+    static unsigned int nextSerial(void) {
+        static std::atomic<unsigned int> serialCounter(0);
+        return ++serialCounter;
+    }
+    
+    ThreadCache* getThreadCache(void) {
+        
+        static thread_local std::vector<ThreadCache> threadCaches;
+        
+        unsigned int numberOfCaches = threadCaches.size();
+        for (unsigned int i=0; i < numberOfCaches; i++) 
+            if ((threadCaches[i].allocator == this) & (threadCaches[i].serial == m_serial)) 
+                return &threadCaches[i];
+                
+        ThreadCache cache;
+        cache.allocator = this;
+        cache.serial    = m_serial;
+        cache.count     = 0;
+        
+        threadCaches.push_back( cache );
+        
+        return &threadCaches[threadCaches.size() - 1];
+    }
+    
+    bool depotPush(ConcurrentPoolSlot<T>* slot) {
+        
+        std::size_t position = m_depotEnqueue.load(std::memory_order_relaxed);
+        
+        for (;;) {
+            
+            DepotCell* cell = &m_depot[position & (POOL_DEPOT_SIZE - 1)];
+            
+            std::size_t sequence = cell ->sequence.load(std::memory_order_acquire);
+            std::intptr_t difference = (std::intptr_t)sequence - (std::intptr_t)position;
+            
+            if (difference == 0) {
+                
+                if (m_depotEnqueue.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    
+                    cell ->slot = slot;
+                    cell ->sequence.store(position + 1, std::memory_order_release);
+                    
+                    return true;
+                }
+                
+                continue;
+            }
+            
+            // Depot is full
+            if (difference < 0) 
+                return false;
+                
+            position = m_depotEnqueue.load(std::memory_order_relaxed);
+        }
+        
+    }
+    
+    ConcurrentPoolSlot<T>* depotPop(void) {
+        
+        std::size_t position = m_depotDequeue.load(std::memory_order_relaxed);
+        
+        for (;;) {
+            
+            DepotCell* cell = &m_depot[position & (POOL_DEPOT_SIZE - 1)];
+            
+            std::size_t sequence = cell ->sequence.load(std::memory_order_acquire);
+            std::intptr_t difference = (std::intptr_t)sequence - (std::intptr_t)(position + 1);
+            
+            if (difference == 0) {
+                
+                if (m_depotDequeue.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    
+                    ConcurrentPoolSlot<T>* slot = cell ->slot;
+                    cell ->sequence.store(position + POOL_DEPOT_SIZE, std::memory_order_release);
+                    
+                    return slot;
+                }
+                
+                continue;
+            }
+            
+            // Depot is empty
+            if (difference < 0) 
+                return nullptr;
+                
+            position = m_depotDequeue.load(std::memory_order_relaxed);
+        }
+        
+    }
+    
+    // Returns a free slot to the depot or to the overflow list when the depot is full
+    void releaseSlot(ConcurrentPoolSlot<T>* slot) {
+        
+        if (depotPush(slot)) 
+            return;
+            
+        std::lock_guard<std::mutex> lock(m_growLock);
+        
+        m_overflow.push_back(slot);
+        
+        return;
+    }
+    
+    // Allocates a new slab. Must be called with the grow lock held
+    Slab* allocate(void) {
+        
+        // Find an unused entry in the slab table
+        unsigned int slabIndex = POOL_MAX_SLABS;
+        
+        unsigned int slabCount = m_slabCount.load(std::memory_order_relaxed);
+        for (unsigned int i=0; i < slabCount; i++) {
+            
+            if (m_slabs[i].slab.load(std::memory_order_relaxed) != nullptr) 
+                continue;
+                
+            slabIndex = i;
+            break;
+        }
+        
+        if (slabIndex == POOL_MAX_SLABS) {
+            
+            if (slabCount >= POOL_MAX_SLABS) 
+                return nullptr;
+                
+            slabIndex = slabCount;
+        }
+        
+        unsigned int size = m_poolSzNext;
+        
+        // Allocate the slab header followed by its slots aligned to a cache line
+        std::size_t headerSz = sizeof(Slab);
+        unsigned char* memory = (unsigned char*) malloc(headerSz + POOL_CACHE_LINE_SIZE + (size * sizeof(ConcurrentPoolSlot<T>)));
+        
+        if (memory == nullptr) return nullptr;
+        
+        std::uintptr_t slotAddress = (std::uintptr_t)(memory + headerSz);
+        slotAddress = (slotAddress + (POOL_CACHE_LINE_SIZE - 1)) & ~(std::uintptr_t)(POOL_CACHE_LINE_SIZE - 1);
+        
+        Slab* slab = (Slab*)memory;
+        slab ->slots = (ConcurrentPoolSlot<T>*)slotAddress;
+        slab ->size  = size;
+        
+        for (unsigned int i=0; i < size; i++) {
+            
+            ConcurrentPoolSlot<T>* slot = &slab ->slots[i];
+            
+            new (&slot ->state) std::atomic<unsigned int>(POOL_SLOT_STATE_FREE);
+            new (&slot ->generation) std::atomic<unsigned int>(m_slabs[slabIndex].generationBase);
+            
+            slot ->nextCreated = nullptr;
+            slot ->nextRetired = nullptr;
+            slot ->activeIndex = POOL_SLOT_FREE;
+            slot ->handleIndex = (slabIndex << POOL_SLAB_SHIFT) | i;
+        }
+        
+        m_slabs[slabIndex].slab.store(slab, std::memory_order_release);
+        
+        if (slabIndex == slabCount) 
+            m_slabCount.store(slabCount + 1, std::memory_order_release);
+            
+        m_capacity.fetch_add(size, std::memory_order_relaxed);
+        
+        // Grow the next slab geometrically
+        m_poolSzNext = size * 2;
+        if (m_poolSzNext > m_poolSzMax) 
+            m_poolSzNext = m_poolSzMax;
+            
+        return slab;
+    }
+    
+    // Refills the thread cache from the depot, the overflow list or a new slab
+    bool refill(ThreadCache* cache) {
+        
+        while (cache ->count < (POOL_THREAD_CACHE_SIZE / 2)) {
+            
+            ConcurrentPoolSlot<T>* slot = depotPop();
+            
+            if (slot == nullptr) 
+                break;
+                
+            cache ->slots[cache ->count++] = slot;
+        }
+        
+        if (cache ->count > 0) 
+            return true;
+            
+        std::lock_guard<std::mutex> lock(m_growLock);
+        
+        while ((m_overflow.size() > 0) & (cache ->count < (POOL_THREAD_CACHE_SIZE / 2))) {
+            
+            cache ->slots[cache ->count++] = m_overflow[m_overflow.size() - 1];
+            
+            m_overflow.pop_back();
+        }
+        
+        if (cache ->count > 0) 
+            return true;
+            
+        Slab* slab = allocate();
+        
+        if (slab == nullptr) 
+            return false;
+            
+        // Keep the first slots and hand the rest to the depot
+        unsigned int numberToKeep = POOL_THREAD_CACHE_SIZE / 2;
+        if (numberToKeep > slab ->size) 
+            numberToKeep = slab ->size;
+            
+        for (unsigned int i=0; i < slab ->size; i++) {
+            
+            ConcurrentPoolSlot<T>* slot = &slab ->slots[slab ->size - 1 - i];
+            
+            if (i >= slab ->size - numberToKeep) {
+                cache ->slots[cache ->count++] = slot;
+                continue;
+            }
+            
+            if (!depotPush(slot)) 
+                m_overflow.push_back(slot);
+                
+        }
+        
+        return true;
+    }
+    
+    ConcurrentPoolSlot<T>* getSlot(unsigned int handleIndex) {
+        
+        unsigned int slabIndex = handleIndex >> POOL_SLAB_SHIFT;
+        unsigned int offset    = handleIndex & ((1 << POOL_SLAB_SHIFT) - 1);
+        
+        if (slabIndex >= m_slabCount.load(std::memory_order_acquire)) 
+            return nullptr;
+            
+        Slab* slab = m_slabs[slabIndex].slab.load(std::memory_order_acquire);
+        
+        if (slab == nullptr) 
+            return nullptr;
+            
+        if (offset >= slab ->size) 
+            return nullptr;
+            
+        return &slab ->slots[offset];
+    }
+    
+    static void queryStatistics(void* allocator, AllocatorStatistics& statistics) {
+        
+        ConcurrentPoolAllocator<T>* pool = (ConcurrentPoolAllocator<T>*)allocator;
+        
+        unsigned int capacity  = pool ->GetCapacity();
+        unsigned int slabCount = pool ->GetPoolCount();
+        unsigned int liveCount = pool ->GetObjectCount();
+        
+        statistics.liveCount      = liveCount;
+        statistics.capacity       = capacity;
+        statistics.slabCount      = slabCount;
+        statistics.highWaterMark  = pool ->m_highWaterMark.load(std::memory_order_relaxed);
+        statistics.objectSize     = sizeof(T);
+        statistics.bytesReserved  = (capacity * sizeof(ConcurrentPoolSlot<T>)) + (slabCount * (sizeof(Slab) + POOL_CACHE_LINE_SIZE));
+        statistics.bytesWasted    = statistics.bytesReserved - (liveCount * sizeof(T));
+        statistics.totalCreated   = pool ->m_totalCreated.load(std::memory_order_relaxed);
+        statistics.totalDestroyed = pool ->m_totalDestroyed.load(std::memory_order_relaxed);
+        
+        return;
+    }
+    
+public:
+    
+    T* operator[] (unsigned int const i) {return m_activeList[i];}
+    
+    ConcurrentPoolAllocator(unsigned int poolSize=24) : 
+        m_slabCount(0),
+        m_depotEnqueue(0),
+        m_depotDequeue(0),
+        m_created(nullptr),
+        m_retired(nullptr),
+        m_liveCount(0),
+        m_capacity(0),
+        m_serial(nextSerial()),
+        m_highWaterMark(0),
+        m_totalCreated(0),
+        m_totalDestroyed(0)
+    {
+        
+        if (poolSize < 1) {poolSize=1;}
+        if (poolSize > (1 << POOL_SLAB_SHIFT)) {poolSize = (1 << POOL_SLAB_SHIFT);}
+        
+        m_poolSz     = poolSize;
+        m_poolSzNext = poolSize;
+        m_poolSzMax  = POOL_DEFAULT_MAX_POOL_SIZE;
+        
+        if (m_poolSzMax < m_poolSz) 
+            m_poolSzMax = m_poolSz;
+            
+        for (unsigned int i=0; i < POOL_MAX_SLABS; i++) {
+            m_slabs[i].slab.store(nullptr, std::memory_order_relaxed);
+            m_slabs[i].generationBase = 1;
+        }
+        
+        m_depot = new DepotCell[POOL_DEPOT_SIZE];
+        
+        for (std::size_t i=0; i < POOL_DEPOT_SIZE; i++) 
+            m_depot[i].sequence.store(i, std::memory_order_relaxed);
+            
+        AllocatorRegistry::Get().Register(this, AllocatorRegistry::GetTypeName( typeid(T).name() ), &ConcurrentPoolAllocator<T>::queryStatistics);
+        
+        return;
+    }
+    ~ConcurrentPoolAllocator() {
+        
+        AllocatorRegistry::Get().Unregister(this);
+        
+        unsigned int slabCount = m_slabCount.load();
+        for (unsigned int i=0; i < slabCount; i++) {
+            
+            Slab* slab = m_slabs[i].slab.load();
+            
+            if (slab == nullptr) 
+                continue;
+                
+#ifdef ENABLE_LEAK_DETECTION__
+    #ifdef ENABLE_CONSOLE_DEBUG__
+                
+            for (unsigned int f=0; f < slab ->size; f++) 
+                if (slab ->slots[f].state.load() != POOL_SLOT_STATE_FREE) 
+                    std::cout << " [Leak detected]  < " << (T*)slab ->slots[f].object << " >  pool #" << i << "\n";
+                    
+    #endif
+#endif
+                    
+            std::free(slab);
+        }
+        
+        delete[] m_depot;
+        
+        return;
+    }
+    
+    /** Reserves an object and returns its pointer. Safe to call from any thread.
+        The object appears in the active list after the next synchronization.*/
+    T* Create(void) {
+        
+        ThreadCache* cache = getThreadCache();
+        
+        if (cache ->count == 0) 
+            if (!refill(cache)) 
+                return nullptr;
+                
+        ConcurrentPoolSlot<T>* slot = cache ->slots[--cache ->count];
+        
+        T* objectPtr = (T*)slot ->object;
+        
+        // Call the constructor
+        construct(*objectPtr);
+        
+        slot ->state.store(POOL_SLOT_STATE_ACTIVE, std::memory_order_release);
+        
+        m_liveCount.fetch_add(1, std::memory_order_relaxed);
+        
+        // Publish the object to the owning thread
+        ConcurrentPoolSlot<T>* head = m_created.load(std::memory_order_relaxed);
+        do {
+            slot ->nextCreated = head;
+        } while (!m_created.compare_exchange_weak(head, slot, std::memory_order_release, std::memory_order_relaxed));
+        
+        return objectPtr;
+    }
+    
+    /** Frees an object. Safe to call from any thread.
+        The object is destructed and removed from the active list on the next synchronization.*/
+    bool Destroy(T* objectPtr) {
+        
+        if (objectPtr == nullptr) 
+            return false;
+            
+        ConcurrentPoolSlot<T>* slot = (ConcurrentPoolSlot<T>*)objectPtr;
+        
+        // Only one destroy may claim the object
+        unsigned int state = POOL_SLOT_STATE_ACTIVE;
+        if (!slot ->state.compare_exchange_strong(state, POOL_SLOT_STATE_RETIRED, std::memory_order_acq_rel)) 
+            return false;
+            
+        // Invalidate any outstanding handles to the object
+        unsigned int generation = slot ->generation.load(std::memory_order_relaxed) + 1;
+        if (generation == 0) 
+            generation = 1;
+        slot ->generation.store(generation, std::memory_order_release);
+        
+        m_liveCount.fetch_sub(1, std::memory_order_relaxed);
+        
+        ConcurrentPoolSlot<T>* head = m_retired.load(std::memory_order_relaxed);
+        do {
+            slot ->nextRetired = head;
+        } while (!m_retired.compare_exchange_weak(head, slot, std::memory_order_release, std::memory_order_relaxed));
+        
+        return true;
+    }
+    
+    /** Frees an object referenced by a handle. Stale handles are rejected.*/
+    bool Destroy(PoolHandle<T> handle) {
+        
+        T* objectPtr = Resolve(handle);
+        
+        if (objectPtr == nullptr) 
+            return false;
+            
+        return Destroy(objectPtr);
+    }
+    
+    /** Reserves an object and returns a handle to it.*/
+    PoolHandle<T> CreateHandle(void) {
+        
+        return GetHandle( Create() );
+    }
+    
+    /** Returns a handle to an active object.*/
+    PoolHandle<T> GetHandle(T* objectPtr) {
+        
+        if (objectPtr == nullptr) 
+            return PoolHandle<T>();
+            
+        ConcurrentPoolSlot<T>* slot = (ConcurrentPoolSlot<T>*)objectPtr;
+        
+        if (slot ->state.load(std::memory_order_acquire) != POOL_SLOT_STATE_ACTIVE) 
+            return PoolHandle<T>();
+            
+        return PoolHandle<T>(slot ->handleIndex, slot ->generation.load(std::memory_order_acquire));
+    }
+    
+    /** Returns the object referenced by a handle, or a null pointer if the object has been destroyed.*/
+    T* Resolve(PoolHandle<T> handle) {
+        
+        ConcurrentPoolSlot<T>* slot = getSlot(handle.index);
+        
+        if (slot == nullptr) 
+            return nullptr;
+            
+        if (slot ->generation.load(std::memory_order_acquire) != handle.generation) 
+            return nullptr;
+            
+        if (slot ->state.load(std::memory_order_acquire) != POOL_SLOT_STATE_ACTIVE) 
+            return nullptr;
+            
+        return (T*)slot ->object;
+    }
+    
+    /** Returns whether a handle still references an active object.*/
+    bool CheckIsValid(PoolHandle<T> handle) {
+        return Resolve(handle) != nullptr;
+    }
+    
+    /** Publishes created objects to the active list and destructs destroyed objects.
+        Must only be called from the thread which iterates the active list.*/
+    void Synchronize(void) {
+        
+        // Take the retired list first so every retired object
+        // is guaranteed to have been published beforehand
+        ConcurrentPoolSlot<T>* retired = m_retired.exchange(nullptr, std::memory_order_acquire);
+        ConcurrentPoolSlot<T>* created = m_created.exchange(nullptr, std::memory_order_acquire);
+        
+        // Reverse the created list to publish in creation order
+        ConcurrentPoolSlot<T>* ordered = nullptr;
+        while (created != nullptr) {
+            
+            ConcurrentPoolSlot<T>* next = created ->nextCreated;
+            
+            created ->nextCreated = ordered;
+            ordered = created;
+            
+            created = next;
+        }
+        
+        unsigned long long numberOfCreated   = 0;
+        unsigned long long numberOfDestroyed = 0;
+        
+        for (ConcurrentPoolSlot<T>* slot = ordered; slot != nullptr; slot = slot ->nextCreated) {
+            
+            slot ->activeIndex = m_activeList.size();
+            
+            m_activeList.push_back( (T*)slot ->object );
+            
+            numberOfCreated++;
+        }
+        
+        if (m_activeList.size() > m_highWaterMark.load(std::memory_order_relaxed)) 
+            m_highWaterMark.store(m_activeList.size(), std::memory_order_relaxed);
+            
+        while (retired != nullptr) {
+            
+            ConcurrentPoolSlot<T>* slot = retired;
+            retired = slot ->nextRetired;
+            
+            // Swap the last active object into the vacated position
+            T* lastObject = m_activeList[m_activeList.size() - 1];
+            
+            m_activeList[slot ->activeIndex] = lastObject;
+            ((ConcurrentPoolSlot<T>*)lastObject) ->activeIndex = slot ->activeIndex;
+            
+            m_activeList.pop_back();
+            
+            // Explicitly call the destructor
+            destruct(*((T*)slot ->object));
+            
+            slot ->activeIndex = POOL_SLOT_FREE;
+            slot ->state.store(POOL_SLOT_STATE_FREE, std::memory_order_release);
+            
+            releaseSlot(slot);
+            
+            numberOfDestroyed++;
+        }
+        
+        m_totalCreated.fetch_add(numberOfCreated, std::memory_order_relaxed);
+        m_totalDestroyed.fetch_add(numberOfDestroyed, std::memory_order_relaxed);
+        
+        return;
+    }
+    
+    /** Returns the free slots held by the calling thread to the shared depot.
+        Should be called by worker threads before they exit.*/
+    void FlushThreadCache(void) {
+        
+        ThreadCache* cache = getThreadCache();
+        
+        while (cache ->count > 0) 
+            releaseSlot( cache ->slots[--cache ->count] );
+            
+        return;
+    }
+    
+    /** Releases slabs whose slots are all free and held by the depot. At least one slab is kept.
+        Must not run while other threads resolve handles. Returns the number of slabs released.*/
+    unsigned int Shrink(void) {
+        
+        std::lock_guard<std::mutex> lock(m_growLock);
+        
+        // Drain the depot so free slots can be counted per slab
+        ConcurrentPoolSlot<T>* slot;
+        while ((slot = depotPop()) != nullptr) 
+            m_overflow.push_back(slot);
+            
+        unsigned int slabCount = m_slabCount.load(std::memory_order_relaxed);
+        
+        std::vector<unsigned int> freeCount(slabCount, 0);
+        for (unsigned int i=0; i < m_overflow.size(); i++) 
+            freeCount[ m_overflow[i] ->handleIndex >> POOL_SLAB_SHIFT ]++;
+            
+        unsigned int numberOfSlabs = 0;
+        for (unsigned int i=0; i < slabCount; i++) 
+            if (m_slabs[i].slab.load(std::memory_order_relaxed) != nullptr) 
+                numberOfSlabs++;
+                
+        std::vector<Slab*> released;
+        
+        for (unsigned int i=0; i < slabCount; i++) {
+            
+            Slab* slab = m_slabs[i].slab.load(std::memory_order_relaxed);
+            
+            if ((slab == nullptr) | (numberOfSlabs - released.size() <= 1)) 
+                continue;
+                
+            if (freeCount[i] != slab ->size) 
+                continue;
+                
+            // Handles into a reused entry must never match the released slots
+            unsigned int generationMax = m_slabs[i].generationBase;
+            for (unsigned int s=0; s < slab ->size; s++) 
+                if (slab ->slots[s].generation.load(std::memory_order_relaxed) > generationMax) 
+                    generationMax = slab ->slots[s].generation.load(std::memory_order_relaxed);
+                    
+            m_slabs[i].generationBase = generationMax + 1;
+            m_slabs[i].slab.store(nullptr, std::memory_order_release);
+            
+            m_capacity.fetch_sub(slab ->size, std::memory_order_relaxed);
+            
+            released.push_back(slab);
+        }
+        
+        if (released.size() == 0) {
+            
+            // Hand the drained slots back
+            while ((m_overflow.size() > 0) && depotPush(m_overflow[m_overflow.size() - 1])) 
+                m_overflow.pop_back();
+                
+            return 0;
+        }
+        
+        // Keep the slots of the remaining slabs
+        std::vector< ConcurrentPoolSlot<T>* > remaining;
+        for (unsigned int i=0; i < m_overflow.size(); i++) 
+            if (m_slabs[ m_overflow[i] ->handleIndex >> POOL_SLAB_SHIFT ].slab.load(std::memory_order_relaxed) != nullptr) 
+                remaining.push_back( m_overflow[i] );
+                
+        m_overflow.clear();
+        
+        for (unsigned int i=0; i < remaining.size(); i++) 
+            if (!depotPush(remaining[i])) 
+                m_overflow.push_back(remaining[i]);
+                
+        // Slab memory begins at the header which precedes its slots
+        for (unsigned int i=0; i < released.size(); i++) 
+            std::free(released[i]);
+            
+        m_poolSzNext = m_poolSz;
+        
+        return released.size();
+    }
+    
+    /** Set the maximum number of objects in a single slab.*/
+    void SetMaxPoolSize(unsigned int size) {
+        if (size < m_poolSz) size = m_poolSz;
+        if (size > (1 << POOL_SLAB_SHIFT)) size = (1 << POOL_SLAB_SHIFT);
+        m_poolSzMax = size;
+    }
+    
+    /** Returns the number of objects in the active list as of the last synchronization.*/
+    unsigned int Size(void) {
+        return m_activeList.size();
+    }
+    
+    /** Returns the number of live objects across all threads.*/
+    unsigned int GetObjectCount(void) {
+        return m_liveCount.load(std::memory_order_relaxed);
+    }
+    /** Returns the number of unused memory locations.*/
+    unsigned int GetFreeCount(void) {
+        return m_capacity.load(std::memory_order_relaxed) - m_liveCount.load(std::memory_order_relaxed);
+    }
+    /** Returns the total number of memory locations across all slabs.*/
+    unsigned int GetCapacity(void) {
+        return m_capacity.load(std::memory_order_relaxed);
+    }
+    /** Returns the largest number of objects in the active list at any synchronization.*/
+    unsigned int GetHighWaterMark(void) {
+        return m_highWaterMark.load(std::memory_order_relaxed);
+    }
+    
+    /** Set the name reported to the allocator registry.*/
+    void SetName(std::string name) {
+        AllocatorRegistry::Get().SetName(this, name);
+    }
+    
+    /** Returns the number of allocated slabs.*/
+    unsigned int GetPoolCount(void) {
+        unsigned int numberOfSlabs = 0;
+        unsigned int slabCount = m_slabCount.load(std::memory_order_acquire);
+        for (unsigned int i=0; i < slabCount; i++) 
+            if (m_slabs[i].slab.load(std::memory_order_relaxed) != nullptr) 
+                numberOfSlabs++;
+        return numberOfSlabs;
+    }
+    
+};
+
+#endif
@@ -0,0 +1,140 @@
+//
+// Linear frame arena allocator
+//
+// Allocations are bumped from a block of memory and released all at
+// once when the arena is reset at the end of a frame. Each thread owns
+// its own arena which must only be reset by that thread.
+
+#ifndef _FRAME_ARENA_ALLOCATOR__
+#define _FRAME_ARENA_ALLOCATOR__
+
+#include <GameEngineFramework/configuration.h>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Default size of an arena block in bytes
+#define  FRAME_ARENA_BLOCK_SIZE   (256 * 1024)
+
+
+struct ENGINE_API FrameArenaMarker {
+    
+    /** Index of the block at the time of the marker.*/
+    unsigned int block;
+    
+    /** Offset into the block at the time of the marker.*/
+    std::size_t offset;
+    
+};
+
+
+class ENGINE_API FrameArena {
+
+public:
+    
+    /// Allocate memory from the arena. The memory remains valid until the arena is reset or rewound past it.
+    void* Allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+    
+    /// Release every allocation made since the last reset. Blocks are kept for the next frame.
+    void Reset(void);
+    
+    /// Return a marker to the current position in the arena.
+    FrameArenaMarker GetMarker(void);
+    
+    /// Release every allocation made since the marker was taken.
+    void Rewind(FrameArenaMarker marker);
+    
+    /// Return the number of bytes allocated since the last reset.
+    std::size_t GetBytesUsed(void);
+    
+    /// Return the total size of all blocks held by the arena.
+    std::size_t GetCapacity(void);
+    
+    /// Return the largest number of bytes used in a single frame.
+    std::size_t GetHighWaterMark(void);
+    
+    /// Return the number of blocks allocated from the heap over the lifetime of the arena.
+    unsigned int GetNumberOfBlockAllocations(void);
+    
+    /// Return the arena owned by the calling thread.
+    static FrameArena& GetThreadArena(void);
+    
+    FrameArena(std::size_t blockSize = FRAME_ARENA_BLOCK_SIZE);
+    ~FrameArena();
+    
+private:
+    
+    struct Block {
+        unsigned char* memory;
+        std::size_t    size;
+    };
+    
+    // Allocate a new block able to hold at least the size specified
+    bool AllocateBlock(std::size_t size);
+    
+    std::vector<Block> mBlocks;
+    
+    unsigned int mCurrentBlock;
+    std::size_t  mOffset;
+    
+    // Bytes held by the blocks before the current block
+    std::size_t  mBytesPrevious;
+    
+    std::size_t  mBlockSize;
+    std::size_t  mHighWaterMark;
+    
+    unsigned int mNumberOfBlockAllocations;
+    
+};
+
+
+/// STL compatible allocator drawing from a frame arena. Memory is never freed individually.
+template<typename T> class FrameAllocator {
+
+public:
+    
+    typedef T              value_type;
+    typedef T*             pointer;
+    typedef const T*       const_pointer;
+    typedef T&             reference;
+    typedef const T&       const_reference;
+    typedef std::size_t    size_type;
+    typedef std::ptrdiff_t difference_type;
+    
+    template<typename U> struct rebind {typedef FrameAllocator<U> other;};
+    
+    /// Arena the allocator draws from.
+    FrameArena* arena;
+    
+    FrameAllocator() : 
+        arena(&FrameArena::GetThreadArena())
+    {}
+    
+    FrameAllocator(FrameArena& frameArena) : 
+        arena(&frameArena)
+    {}
+    
+    template<typename U> FrameAllocator(const FrameAllocator<U>& allocator) : 
+        arena(allocator.arena)
+    {}
+    
+    T* allocate(std::size_t count) {
+        return (T*)arena->Allocate(count * sizeof(T), alignof(T));
+    }
+    
+    void deallocate(T*, std::size_t) {}
+    
+    template<typename U> bool operator== (const FrameAllocator<U>& allocator) const {return arena == allocator.arena;}
+    template<typename U> bool operator!= (const FrameAllocator<U>& allocator) const {return arena != allocator.arena;}
+    
+};
+
+
+/// Vector allocated from the frame arena of the calling thread.
+template<typename T> using FrameVector = std::vector<T, FrameAllocator<T>>;
+
+/// String allocated from the frame arena of the calling thread.
+typedef std::basic_string<char, std::char_traits<char>, FrameAllocator<char>> FrameString;
+
+#endif
@@ -7,8 +7,12 @@
 #define _POOL_ALLOCATOR_SUPPORT__
 
 #include <GameEngineFramework/configuration.h>
+#include <GameEngineFramework/MemoryAllocation/AllocatorRegistry.h>
 
+#include <cstdint>
 #include <cstdlib>
+#include <typeinfo>
+#include <utility>
 #include <vector>
 
 //
@@ -34,6 +38,14 @@
  #include <string>
 #endif
 
+// Slabs are aligned to the cache line size
+#define  POOL_CACHE_LINE_SIZE       64
+
+// Default slab growth
+#define  POOL_DEFAULT_GROWTH_FACTOR  2.0f
+#define  POOL_DEFAULT_MAX_POOL_SIZE  4096
+
+
 struct ENGINE_API CustomAllocator {
     
     /** Initial number of pools.*/
@@ -44,14 +56,111 @@ struct ENGINE_API CustomAllocator {
     
 };
 
+// Sentinel marking a slot which is not in the active list
+#define  POOL_SLOT_FREE   0xffffffff
+
+
+template<typename T> struct PoolSlab;
+
+
+template<typename T> struct PoolSlot {
+    
+    /** Object storage. Must remain the first member so an object pointer is also its slot pointer.*/
+    alignas(T) unsigned char object[sizeof(T)];
+    
+    /** Next slot in the slab free list, while the slot is not in use.*/
+    PoolSlot<T>* nextFree;
+    
+    /** Slab owning this slot.*/
+    PoolSlab<T>* slab;
+    
+    /** Position of the object in the active list, or POOL_SLOT_FREE.*/
+    unsigned int activeIndex;
+    
+    /** Index of the handle entry referencing this slot.*/
+    unsigned int handleIndex;
+    
+};
+
+
+template<typename T> struct PoolSlab {
+    
+    /** Slot array. Aligned to a cache line within the slab allocation.*/
+    PoolSlot<T>* slots;
+    
+    /** Head of the intrusive free list threaded through the unused slots of this slab.*/
+    PoolSlot<T>* freeList;
+    
+    /** Number of slots in the slab.*/
+    unsigned int size;
+    
+    /** Number of active objects in the slab.*/
+    unsigned int liveCount;
+    
+    /** Position of the slab in the partial slab list, or POOL_SLOT_FREE when the slab is full.*/
+    unsigned int partialIndex;
+    
+};
+
+
+template<typename T> struct PoolHandle {
+    
+    /** Index of the handle entry in the issuing allocator.*/
+    unsigned int index;
+    
+    /** Generation of the entry at the time the handle was issued.*/
+    unsigned int generation;
+    
+    bool operator== (const PoolHandle<T>& handle) const {return (index == handle.index) & (generation == handle.generation);}
+    bool operator!= (const PoolHandle<T>& handle) const {return !(*this == handle);}
+    
+    PoolHandle() : 
+        index(POOL_SLOT_FREE),
+        generation(0)
+    {}
+    
+    PoolHandle(unsigned int handleIndex, unsigned int handleGeneration) : 
+        index(handleIndex),
+        generation(handleGeneration)
+    {}
+    
+};
+
+
 template<typename T> class ENGINE_API PoolAllocator {
     
-    std::vector< std::pair<T*, std::vector<bool>> > m_pool;
+    std::vector< PoolSlab<T>* > m_pool;
     std::vector< T* > m_activeList;
     
+    // Slabs with at least one free slot. New objects are
+    // taken from the slab at the back of the list.
+    std::vector< PoolSlab<T>* > m_partialList;
+    
+    // Handle entries resolving a handle index to its slot. The generation
+    // is advanced every time the referenced object is destroyed.
+    struct HandleEntry {
+        PoolSlot<T>* slot;
+        unsigned int generation;
+    };
+    
+    std::vector<HandleEntry> m_handleTable;
+    
+    // Handle entries orphaned by released slabs, reused by new slots
+    std::vector<unsigned int> m_freeHandles;
+    
     int m_poolSz;
     int m_poolCount;
     
+    unsigned int m_poolSzNext;
+    unsigned int m_poolSzMax;
+    float        m_growthFactor;
+    unsigned int m_capacity;
+    
+    // Telemetry counters
+    unsigned int       m_highWaterMark;
+    unsigned long long m_totalCreated;
+    unsigned long long m_totalDestroyed;
+    
     void construct(T& objectRef) {new (&objectRef) T();}
     void destruct(T& objectRef) {
         
@@ -59,37 +168,198 @@ template<typename T> class ENGINE_API PoolAllocator {
         
     }
     
-    std::pair<T*, std::vector<bool>> allocate(void) {
+    PoolSlab<T>* allocateSlab(unsigned int size) {
+        
+        // Allocate the slab header followed by its slots with
+        // enough padding to align the slots to a cache line
+        std::size_t headerSz = sizeof(PoolSlab<T>);
+        std::size_t slabSz   = headerSz + POOL_CACHE_LINE_SIZE + (size * sizeof(PoolSlot<T>));
+        
+        unsigned char* memory = (unsigned char*) malloc(slabSz);
+        
+        // Check the slab allocation
+        if (memory == nullptr) return nullptr;
+        
+        std::uintptr_t slotAddress = (std::uintptr_t)(memory + headerSz);
+        slotAddress = (slotAddress + (POOL_CACHE_LINE_SIZE - 1)) & ~(std::uintptr_t)(POOL_CACHE_LINE_SIZE - 1);
+        
+        PoolSlab<T>* slab = (PoolSlab<T>*)memory;
+        
+        slab ->slots        = (PoolSlot<T>*)slotAddress;
+        slab ->freeList     = nullptr;
+        slab ->size         = size;
+        slab ->liveCount    = 0;
+        slab ->partialIndex = POOL_SLOT_FREE;
+        
+        return slab;
+    }
+    
+    void issueHandle(PoolSlot<T>* slot) {
+        
+        // Reuse an orphaned handle entry keeping its generation
+        if (m_freeHandles.size() > 0) {
+            
+            unsigned int handleIndex = m_freeHandles[m_freeHandles.size() - 1];
+            m_freeHandles.pop_back();
+            
+            m_handleTable[handleIndex].slot = slot;
+            slot ->handleIndex = handleIndex;
+            
+            return;
+        }
+        
+        HandleEntry entry;
+        entry.slot       = slot;
+        entry.generation = 1;
+        
+        slot ->handleIndex = m_handleTable.size();
+        
+        m_handleTable.push_back( entry );
+        
+        return;
+    }
+    
+    void orphanHandle(PoolSlot<T>* slot) {
         
-        // Allocate a pool and a state list pair
-        T*    poolPtr = (T*)   malloc(m_poolSz * sizeof(T));
-        std::vector<bool> boolList;
+        m_handleTable[slot ->handleIndex].slot = nullptr;
         
-        // Check the pool allocation
-        if (poolPtr == nullptr) return std::make_pair(nullptr, boolList);
+        m_freeHandles.push_back( slot ->handleIndex );
         
-        // Initiate all objects as inactive
-        boolList.resize(m_poolSz);
-        for (int i=0; i < m_poolSz; i++) boolList.push_back(false);
+        return;
+    }
+    
+    // Threads the slots from the given index onward onto the slab free list
+    void threadSlots(PoolSlab<T>* slab, unsigned int first) {
         
-        // Add the pair to the list
-        std::pair<T*, std::vector<bool>> poolPair = std::make_pair(poolPtr, boolList);
-        m_pool.push_back( poolPair );
+        // Thread in reverse so the first slot in the slab is handed out first
+        for (int i=(int)slab ->size - 1; i >= (int)first; i--) {
+            
+            PoolSlot<T>* slot = &slab ->slots[i];
+            
+            slot ->activeIndex = POOL_SLOT_FREE;
+            slot ->slab        = slab;
+            slot ->nextFree    = slab ->freeList;
+            
+            issueHandle( slot );
+            
+            slab ->freeList = slot;
+        }
         
+        if ((slab ->freeList != nullptr) & (slab ->partialIndex == POOL_SLOT_FREE)) 
+            addPartial( slab );
+            
+        return;
+    }
+    
+    void addPartial(PoolSlab<T>* slab) {
+        
+        slab ->partialIndex = m_partialList.size();
+        
+        m_partialList.push_back( slab );
+        
+        return;
+    }
+    
+    void removePartial(PoolSlab<T>* slab) {
+        
+        // Swap the last partial slab into the vacated position
+        PoolSlab<T>* lastSlab = m_partialList[m_partialList.size() - 1];
+        
+        m_partialList[slab ->partialIndex] = lastSlab;
+        lastSlab ->partialIndex = slab ->partialIndex;
+        
+        m_partialList.pop_back();
+        
+        slab ->partialIndex = POOL_SLOT_FREE;
+        
+        return;
+    }
+    
+    PoolSlab<T>* allocate(unsigned int size) {
+        
+        PoolSlab<T>* slab = allocateSlab(size);
+        
+        if (slab == nullptr) return nullptr;
+        
+        threadSlots(slab, 0);
+        
+        m_pool.push_back( slab );
+        
+        m_capacity += size;
         m_poolCount++;
         
-        return poolPair;
+        return slab;
+    }
+    
+    PoolSlab<T>* allocate(void) {
+        
+        unsigned int size = m_poolSzNext;
+        
+        PoolSlab<T>* slab = allocate(size);
+        
+        if (slab == nullptr) return nullptr;
+        
+        // Grow the next slab geometrically
+        float nextSize = (float)size * m_growthFactor;
+        
+        if (nextSize > (float)m_poolSzMax) 
+            nextSize = (float)m_poolSzMax;
+            
+        if ((unsigned int)nextSize > size) 
+            m_poolSzNext = (unsigned int)nextSize;
+            
+        return slab;
+    }
+    
+    void initiate(unsigned int poolSize, unsigned int poolCount) {
+        
+        if (poolSize < 1) {poolSize=1;}
+        if (poolCount < 1) {poolCount=1;}
+        
+        m_poolSz       = poolSize;
+        m_poolCount    = 0;
+        m_poolSzNext   = poolSize;
+        m_poolSzMax    = POOL_DEFAULT_MAX_POOL_SIZE;
+        m_growthFactor = POOL_DEFAULT_GROWTH_FACTOR;
+        m_capacity     = 0;
+        
+        m_highWaterMark  = 0;
+        m_totalCreated   = 0;
+        m_totalDestroyed = 0;
+        
+        if (m_poolSzMax < poolSize) 
+            m_poolSzMax = poolSize;
+            
+        // Initial pools are allocated at the requested size
+        for (unsigned int i=0; i < poolCount; i++) {
+            
+            m_poolSzNext = poolSize;
+            
+            this ->allocate();
+        }
+        
+        AllocatorRegistry::Get().Register(this, AllocatorRegistry::GetTypeName( typeid(T).name() ), &PoolAllocator<T>::queryStatistics);
+        
+        return;
     }
-    void deallocate(void) {
+    
+    static void queryStatistics(void* allocator, AllocatorStatistics& statistics) {
         
-        // Deallocate the last pool pair
-        std::pair<T*, std::vector<bool>>& lastPoolPair = *m_pool.end();
-        std::free(lastPoolPair.first);
+        PoolAllocator<T>* pool = (PoolAllocator<T>*)allocator;
         
-        // Remove the pair from the list
-        m_pool.erase( m_pool.end() );
+        std::size_t slabOverhead = sizeof(PoolSlab<T>) + POOL_CACHE_LINE_SIZE;
         
-        m_poolCount--;
+        statistics.liveCount      = pool ->m_activeList.size();
+        statistics.capacity       = pool ->m_capacity;
+        statistics.slabCount      = pool ->m_pool.size();
+        statistics.highWaterMark  = pool ->m_highWaterMark;
+        statistics.objectSize     = sizeof(T);
+        statistics.bytesReserved  = (pool ->m_capacity * sizeof(PoolSlot<T>)) + (pool ->m_pool.size() * slabOverhead);
+        statistics.bytesWasted    = statistics.bytesReserved - (statistics.liveCount * sizeof(T));
+        statistics.totalCreated   = pool ->m_totalCreated;
+        statistics.totalDestroyed = pool ->m_totalDestroyed;
+        
+        return;
     }
     
 public:
@@ -98,55 +368,43 @@ public:
     
     PoolAllocator() {
         
-        m_poolSz           = 24;
-        m_poolCount        = 1;
-        
-        this ->allocate();
+        initiate(24, 1);
         return;
     }
     PoolAllocator(CustomAllocator customAllocator) {
         
-        m_poolSz           = customAllocator.poolSize;
-        m_poolCount        = 0;
-        
+        if (customAllocator.poolSize < 1) {customAllocator.poolSize=1;}
         if (customAllocator.poolCount < 1) {customAllocator.poolCount=1;}
         
-        for (int i=0; i < customAllocator.poolCount; i++) 
-            this ->allocate();
+        initiate(customAllocator.poolSize, customAllocator.poolCount);
         return;
     }
     PoolAllocator(unsigned int poolSize, unsigned int poolCount) {
         
-        m_poolSz           = poolSize;
-        m_poolCount        = poolCount;
-        
-        for (int i=0; i < poolCount; i++) 
-            this ->allocate();
+        initiate(poolSize, poolCount);
         return;
     }
     ~PoolAllocator() {
         
+        AllocatorRegistry::Get().Unregister(this);
+        
         // Iterate the pool list
         int poolListSz = m_pool.size();
         for (int i=0; i < poolListSz; i++) {
             
-            // Get the next pair
-            std::pair<T*, std::vector<bool>>* poolPair = &m_pool[i];
-            T*    poolPtr = poolPair ->first;
-            std::vector<bool> boolPtr = poolPair ->second;
+            PoolSlab<T>* slab = m_pool[i];
             
 #ifdef ENABLE_LEAK_DETECTION__
     #ifdef ENABLE_CONSOLE_DEBUG__
             
             // Iterate the pool
-            int poolSz = this ->m_poolSz;
-            for (int f=0; f < poolSz; f++) {
+            unsigned int poolSz = slab ->size;
+            for (unsigned int f=0; f < poolSz; f++) {
                 
-                if (boolPtr[f]) {
-                    T& poolRef = *poolPair ->first;
+                if (slab ->slots[f].activeIndex != POOL_SLOT_FREE) {
                     
-                    std::cout << " [Leak detected]  < " << &poolPtr[f] << " >  pool #" << i << "  pool *";
-                    std::cout << &poolRef << "\n";
+                    std::cout << " [Leak detected]  < " << (T*)slab ->slots[f].object << " >  pool #" << i << "  pool *";
+                    std::cout << slab ->slots << "\n";
                 }
                 
             }
@@ -154,8 +412,8 @@ public:
     #endif
 #endif
             
-            // Deallocate the pool pair
-            std::free(poolPtr);
+            // Deallocate the pool
+            std::free(slab);
             
         }
         
@@ -165,192 +423,379 @@ public:
     /** Reserves an object and returns its pointer.*/
     T* Create(void) {
         
-        T* objectPtr = nullptr;
+        // All pools are full, allocate a new pool
+        if (m_partialList.size() == 0) 
+            if (this ->allocate() == nullptr) 
+                return nullptr;
+                
+        // Pop the next free slot from the most recent partial slab
+        PoolSlab<T>* slab = m_partialList[m_partialList.size() - 1];
+        
+        PoolSlot<T>* slot = slab ->freeList;
+        slab ->freeList = slot ->nextFree;
+        slab ->liveCount++;
         
-        // Iterate the pool list
-        int poolListSz = m_pool.size();
-        for (int i=0; i < poolListSz; i++) {
-            
-            // Get the next pool and free list
-            T*    poolPtr = m_pool[i].first;
-            std::vector<bool>& boolPtr = m_pool[i].second;
+        if (slab ->freeList == nullptr) 
+            removePartial( slab );
             
-            // Iterate the pool objects
-            int poolSz = this ->m_poolSz;
-            for (int f=0; f < poolSz; f++) {
-                
-                // Check if the object is available
-                if (!boolPtr[f]) {
-                    
+        T* objectPtr = (T*)slot ->object;
+        
 #ifdef ENABLE_CONSOLE_DEBUG__
     #ifdef ENABLE_DEBUG_ON_CONSTRUCT__
-                    
-                    std::cout << "  Constructed :: " << &poolPtr[f] << "   Pool * " << &poolPtr[0] << "\n";
-                    
+        
+        std::cout << "  Constructed :: " << objectPtr << "\n";
+        
     #endif
 #endif
-                    
-                    // Call the constructor
-                    T& objectRef = poolPtr[f];
-                    construct(objectRef);
-                    
-                    // Mark the object as active
-                    boolPtr[f] = true;
-                    
-                    m_activeList.push_back(&poolPtr[f]);
-                    
-                    return &poolPtr[f];
-                }
-                
-            }
-            
-        }
         
-        // All pools are full, allocate a new pool
-        if (objectPtr == nullptr) {
+        // Call the constructor
+        construct(*objectPtr);
+        
+        // Mark the object as active
+        slot ->nextFree    = nullptr;
+        slot ->activeIndex = m_activeList.size();
+        
+        m_activeList.push_back(objectPtr);
+        
+        m_totalCreated++;
+        if (m_activeList.size() > m_highWaterMark) 
+            m_highWaterMark = m_activeList.size();
             
-            this ->allocate();
+        return objectPtr;
+    }
+    
+    /** Frees an object.*/
+    bool Destroy(T* objectPtr) {
+        
+        if (objectPtr == nullptr) 
+            return false;
             
-            std::pair<T*, std::vector<bool>>& poolPair = m_pool[m_pool.size()-1];
+        // The object storage is the first member of its slot
+        PoolSlot<T>* slot = (PoolSlot<T>*)objectPtr;
+        
+        // Check if the object is active
+        unsigned int activeIndex = slot ->activeIndex;
+        
+        if (activeIndex >= m_activeList.size()) 
+            return false;
             
-            T& poolPtr = *poolPair.first;
-            std::vector<bool>& boolPtr = poolPair.second;
+        if (m_activeList[activeIndex] != objectPtr) 
+            return false;
             
 #ifdef ENABLE_CONSOLE_DEBUG__
-    #ifdef ENABLE_DEBUG_ON_CONSTRUCT__
-            
-            std::cout << "  Constructed :: " << &poolPtr << "   Pool * " << &poolPtr << "\n";
+    #ifdef ENABLE_DEBUG_ON_DESTRUCT__
             
+        std::cout << "  Destructed :: " << objectPtr << "\n";
+        
     #endif
 #endif
+        
+        // Explicitly call the destructor
+        destruct(*objectPtr);
+        
+        // Swap the last active object into the vacated position
+        T* lastObject = m_activeList[m_activeList.size() - 1];
+        
+        m_activeList[activeIndex] = lastObject;
+        ((PoolSlot<T>*)lastObject) ->activeIndex = activeIndex;
+        
+        m_activeList.pop_back();
+        
+        // Invalidate any outstanding handles to the object
+        HandleEntry& entry = m_handleTable[slot ->handleIndex];
+        entry.generation++;
+        if (entry.generation == 0) 
+            entry.generation = 1;
             
-            // Call the constructor
-            new (&poolPtr) T();
+        // Return the slot to its slab free list
+        PoolSlab<T>* slab = slot ->slab;
+        
+        slot ->activeIndex = POOL_SLOT_FREE;
+        slot ->nextFree    = slab ->freeList;
+        
+        slab ->freeList = slot;
+        slab ->liveCount--;
+        
+        if (slab ->partialIndex == POOL_SLOT_FREE) 
+            addPartial( slab );
             
-            // Mark the first object as active
-            boolPtr[0] = true;
+        m_totalDestroyed++;
+        
+        return true;
+    }
+    
+    /** Ensures at least the given number of objects can be created without allocating.
+        Any shortfall is allocated as a single pool so the objects are contiguous.*/
+    bool Reserve(unsigned int count) {
+        
+        unsigned int freeCount = m_capacity - m_activeList.size();
+        
+        if (count > freeCount) {
             
-            m_activeList.push_back(&poolPtr);
+            unsigned int size = count - freeCount;
+            if (size < m_poolSzNext) 
+                size = m_poolSzNext;
+                
+            if (this ->allocate(size) == nullptr) 
+                return false;
+                
+        }
+        
+        // Grow the active list geometrically so repeated small batches do not copy it every time
+        unsigned int required = m_activeList.size() + count;
+        
+        if (required > m_activeList.capacity()) {
+            
+            unsigned int doubled = m_activeList.capacity() * 2;
             
-            objectPtr = &poolPtr;
+            m_activeList.reserve( (required > doubled) ? required : doubled );
         }
         
-        return objectPtr;
+        return true;
     }
     
-    /** Frees an object.*/
-    bool Destroy(T* objectPtr) {
+    /** Reserves a number of objects in one pass and writes their pointers into the array given.
+        Returns the number of objects created.*/
+    unsigned int CreateBatch(T** objects, unsigned int count) {
         
-        // Iterate the list of pools
-        int poolListSz = m_pool.size();
-        for (int i=0; i < poolListSz; i++) {
+        if (!Reserve(count)) 
+            return 0;
             
-            // Get the next pool and state list
-            T*    poolPtr = m_pool[i].first;
-            std::vector<bool>& boolPtr = m_pool[i].second;
+        for (unsigned int i=0; i < count; i++) 
+            objects[i] = Create();
             
-            // Iterate the pool its self
-            int poolSz = this ->m_poolSz;
-            for (int f=0; f < poolSz; f++) {
-                
-                // Check matching pointers
-                if (objectPtr == &poolPtr[f]) {
-                    
-                    // Check if the object is active
-                    if (boolPtr[f]) {
-                        
-#ifdef ENABLE_CONSOLE_DEBUG__
-    #ifdef ENABLE_DEBUG_ON_DESTRUCT__
-                        T& poolRef = *poolPtr;
-                        
-                        std::cout << "  Destructed :: " << &poolPtr[f] << "   Pool * " << &poolRef << "\n";
-                        
-    #endif
-#endif
-                        
-                        // Explicitly call the destructor
-                        destruct(poolPtr[f]);
-                        
-                        // Mark the object as inactive
-                        boolPtr[f] = false;
-                        
-                        // Object is active, add to list
-                        int ListSize = m_activeList.size();
-                        for (int a=0; a < ListSize; a++) {
-                            
-                            if (m_activeList[a] == objectPtr) {m_activeList.erase( m_activeList.begin() + a ); break;}
-                            
-                        }
-                        
-                        return true;
-                    } else return false;
-                    
-                }
+        return count;
+    }
+    
+    /** Frees a number of objects in one pass. Returns the number of objects destroyed.*/
+    unsigned int DestroyBatch(T* const* objects, unsigned int count) {
+        
+        unsigned int numberOfDestroyed = 0;
+        
+        for (unsigned int i=0; i < count; i++) 
+            if (Destroy( objects[i] )) 
+                numberOfDestroyed++;
                 
-            }
+        return numberOfDestroyed;
+    }
+    
+    /** Frees an object referenced by a handle. Stale handles are rejected.*/
+    bool Destroy(PoolHandle<T> handle) {
+        
+        T* objectPtr = Resolve(handle);
+        
+        if (objectPtr == nullptr) 
+            return false;
             
-        }
+        return Destroy(objectPtr);
+    }
+    
+    /** Reserves an object and returns a handle to it.*/
+    PoolHandle<T> CreateHandle(void) {
         
-        return false;
+        return GetHandle( Create() );
     }
     
-    /** Returns the number of active objects.*/
-    unsigned int Size(void) {
-        return m_activeList.size();
+    /** Returns a handle to an active object. An invalid handle is returned if the object is not active in this pool.*/
+    PoolHandle<T> GetHandle(T* objectPtr) {
+        
+        if (objectPtr == nullptr) 
+            return PoolHandle<T>();
+            
+        PoolSlot<T>* slot = (PoolSlot<T>*)objectPtr;
+        
+        unsigned int activeIndex = slot ->activeIndex;
+        
+        if (activeIndex >= m_activeList.size()) 
+            return PoolHandle<T>();
+            
+        if (m_activeList[activeIndex] != objectPtr) 
+            return PoolHandle<T>();
+            
+        return PoolHandle<T>(slot ->handleIndex, m_handleTable[slot ->handleIndex].generation);
     }
     
+    /** Returns the object referenced by a handle, or a null pointer if the object has been destroyed.*/
+    T* Resolve(PoolHandle<T> handle) {
+        
+        if (handle.index >= m_handleTable.size()) 
+            return nullptr;
+            
+        HandleEntry& entry = m_handleTable[handle.index];
+        
+        if (entry.generation != handle.generation) 
+            return nullptr;
+            
+        if (entry.slot == nullptr) 
+            return nullptr;
+            
+        if (entry.slot ->activeIndex == POOL_SLOT_FREE) 
+            return nullptr;
+            
+        return (T*)entry.slot ->object;
+    }
     
-    /** Returns the number of used memory locations.*/
-    unsigned int GetObjectCount(void) {
+    /** Returns whether a handle still references an active object.*/
+    bool CheckIsValid(PoolHandle<T> handle) {
+        return Resolve(handle) != nullptr;
+    }
+    
+    /** Releases pools which contain no active objects. At least one pool is kept.
+        Objects are never moved so pointers and handles remain valid. Returns the number of pools released.*/
+    unsigned int Shrink(void) {
         
-        int ObjectCount = 0;
+        unsigned int numberOfReleased = 0;
         
-        // Iterate the pool list
-        int poolListSz = m_pool.size();
-        for (int i=0; i < poolListSz; i++) {
+        for (unsigned int i=0; i < m_pool.size(); i++) {
             
-            // Get the next pool and free list pair
-            //T*    poolPtr = m_pool[i].first;
-            std::vector<bool> boolPtr = m_pool[i].second;
+            if (m_pool.size() == 1) 
+                break;
+                
+            PoolSlab<T>* slab = m_pool[i];
             
-            // Iterate the pool its self
-            int poolSz = this ->m_poolSz;
-            for (int f=0; f < poolSz; f++) {
+            if (slab ->liveCount > 0) 
+                continue;
                 
-                // Check if the object is active
-                if (boolPtr[f]) ObjectCount++;
+            // Orphan the handle entries of the released slots
+            for (unsigned int s=0; s < slab ->size; s++) 
+                orphanHandle( &slab ->slots[s] );
                 
-            }
+            removePartial( slab );
+            
+            m_capacity -= slab ->size;
+            m_poolCount--;
             
+            // Swap the last pool into the vacated position
+            m_pool[i] = m_pool[m_pool.size() - 1];
+            m_pool.pop_back();
+            
+            std::free(slab);
+            
+            numberOfReleased++;
+            
+            i--;
         }
         
-        return ObjectCount;
+        // Restart growth from the size of the largest remaining pool
+        if (numberOfReleased > 0) {
+            
+            m_poolSzNext = m_poolSz;
+            
+            for (unsigned int i=0; i < m_pool.size(); i++) 
+                if (m_pool[i] ->size > m_poolSzNext) 
+                    m_poolSzNext = m_pool[i] ->size;
+                    
+        }
+        
+        return numberOfReleased;
     }
-    /** Returns the number of unused memory locations.*/
-    unsigned int GetFreeCount(void) {
+    
+    /** Moves every active object into a single tightly packed pool and releases the old pools.
+        Objects are relocated so any raw pointers into the pool become invalid. Handles remain valid.
+        Only use on pools which are referenced by handles. The type must be move constructible.*/
+    bool Compact(void) {
         
-        unsigned int FreeCount = 0;
+        unsigned int numberOfObjects = m_activeList.size();
         
-        // Iterate the pool list
-        unsigned int poolListSz = m_pool.size();
-        for (unsigned int i=0; i < poolListSz; i++) {
+        unsigned int size = numberOfObjects;
+        if (size < (unsigned int)m_poolSz) 
+            size = m_poolSz;
             
-            // Get the next pool and free list pair
-            //T*    poolPtr = m_pool[i].first;
-            std::vector<bool> boolPtr = m_pool[i].second;
+        PoolSlab<T>* newSlab = allocateSlab(size);
+        
+        if (newSlab == nullptr) 
+            return false;
             
-            // Iterate the pool its self
-            unsigned int poolSz = this ->m_poolSz;
-            for (unsigned int a=0; a < poolSz; a++) {
-                
-                // Check if the object is inactive
-                if (!boolPtr[a]) FreeCount++;
+        // Orphan the handle entries of the unused slots
+        for (unsigned int i=0; i < m_pool.size(); i++) 
+            for (PoolSlot<T>* slot = m_pool[i] ->freeList; slot != nullptr; slot = slot ->nextFree) 
+                orphanHandle( slot );
                 
-            }
+        // Relocate the active objects in active list order
+        for (unsigned int i=0; i < numberOfObjects; i++) {
+            
+            PoolSlot<T>* source = (PoolSlot<T>*)m_activeList[i];
+            PoolSlot<T>* dest   = &newSlab ->slots[i];
             
+            T* sourceObject = (T*)source ->object;
+            T* destObject   = (T*)dest ->object;
+            
+            new (destObject) T( std::move(*sourceObject) );
+            destruct(*sourceObject);
+            
+            dest ->nextFree    = nullptr;
+            dest ->slab        = newSlab;
+            dest ->activeIndex = i;
+            dest ->handleIndex = source ->handleIndex;
+            
+            m_handleTable[dest ->handleIndex].slot = dest;
+            
+            m_activeList[i] = destObject;
         }
         
-        return FreeCount;
+        newSlab ->liveCount = numberOfObjects;
+        
+        // Release the old pools
+        for (unsigned int i=0; i < m_pool.size(); i++) 
+            std::free(m_pool[i]);
+            
+        m_pool.clear();
+        m_partialList.clear();
+        
+        m_pool.push_back( newSlab );
+        
+        m_capacity   = size;
+        m_poolCount  = 1;
+        m_poolSzNext = size;
+        
+        threadSlots(newSlab, numberOfObjects);
+        
+        return true;
+    }
+    
+    /** Set the factor by which each new pool grows over the last. A factor of one keeps all pools the same size.*/
+    void SetGrowthFactor(float factor) {
+        if (factor < 1.0f) factor = 1.0f;
+        m_growthFactor = factor;
+    }
+    
+    /** Set the maximum number of objects in a single pool.*/
+    void SetMaxPoolSize(unsigned int size) {
+        if (size < (unsigned int)m_poolSz) size = m_poolSz;
+        m_poolSzMax = size;
+        if (m_poolSzNext > m_poolSzMax) m_poolSzNext = m_poolSzMax;
+    }
+    
+    /** Returns the number of active objects.*/
+    unsigned int Size(void) {
+        return m_activeList.size();
+    }
+    
+    
+    /** Returns the number of used memory locations.*/
+    unsigned int GetObjectCount(void) {
+        return m_activeList.size();
+    }
+    /** Returns the number of unused memory locations.*/
+    unsigned int GetFreeCount(void) {
+        return m_capacity - m_activeList.size();
+    }
+    /** Returns the total number of memory locations across all pools.*/
+    unsigned int GetCapacity(void) {
+        return m_capacity;
+    }
+    /** Returns the number of allocated pools.*/
+    unsigned int GetPoolCount(void) {
+        return m_pool.size();
+    }
+    /** Returns the largest number of active objects at any one time.*/
+    unsigned int GetHighWaterMark(void) {
+        return m_highWaterMark;
+    }
+    
+    /** Set the name reported to the allocator registry.*/
+    void SetName(std::string name) {
+        AllocatorRegistry::Get().SetName(this, name);
     }
     
     /** Debug output to console. Must #define ENABLE_CONSOLE_DEBUG__ */
@@ -368,17 +813,16 @@ public:
         unsigned int poolListSz = m_pool.size();
         for (unsigned int i=0; i < poolListSz; i++) {
             
-            // Get the next pool and free list
-            T*    poolPtr = m_pool[i].first;
-            std::vector<bool> boolPtr = m_pool[i].second;
+            // Get the next pool
+            PoolSlot<T>* poolPtr = m_pool[i] ->slots;
             
             // Iterate the pool objects
-            unsigned int poolSz = this ->m_poolSz;
+            unsigned int poolSz = m_pool[i] ->size;
             for (unsigned int f=0; f < poolSz; f++) {
                 
-                std::cout << "  " << &poolPtr[f];
+                std::cout << "  " << (T*)poolPtr[f].object;
                 
-                if (boolPtr[f]) std::cout << "         " << "Reserved";
+                if (poolPtr[f].activeIndex != POOL_SLOT_FREE) std::cout << "         " << "Reserved";
                 
                 std::cout << "\n";
                 
@@ -391,18 +835,18 @@ public:
         
         std::string spcStr = "  ";
         
-        std::cout << spcStr << this ->getObjectCount() << " - Used memory locations\n";
-        std::cout << spcStr << this ->getFreeCount() << " - Unused memory locations\n";
+        std::cout << spcStr << this ->GetObjectCount() << " - Used memory locations\n";
+        std::cout << spcStr << this ->GetFreeCount() << " - Unused memory locations\n";
         
         std::cout << "\n";
         
-        std::cout << spcStr << spcStr << m_poolSz << " - Pool size\n";
+        std::cout << spcStr << spcStr << m_poolSz << " - Initial pool size\n";
+        std::cout << spcStr << spcStr << m_poolSzNext << " - Next pool size\n";
         std::cout << spcStr << spcStr << m_poolCount << " - Total pools\n";
         
         std::cout << "\n";
         
-        std::cout << spcStr << spcStr << m_poolSz * sizeof(T) <<      " - Size of a pool in bytes\n";
-        std::cout << spcStr << spcStr << m_poolSz * sizeof(T) * m_poolCount << " - Total size of all pools in bytes\n";
+        std::cout << spcStr << spcStr << m_capacity * sizeof(PoolSlot<T>) << " - Total size of all pools in bytes\n";
         
         std::cout << "\n\n";
         
@@ -425,26 +869,23 @@ public:
         fDump << "  Allocation crash report\n";
         
         // Iterate the pool list
-        int poolListSz = m_pool.size();
+        unsigned int poolListSz = m_pool.size();
         for (unsigned int i=0; i < poolListSz; i++) {
             
-            // Get the next pair
-            std::pair<T*, std::vector<bool>>* poolPair = &m_pool[i];
-            T*    poolPtr = poolPair ->first;
-            std::vector<bool> boolPtr = poolPair ->second;
+            // Get the next pool
+            PoolSlot<T>* poolPtr = m_pool[i] ->slots;
             
             // Log the pool pointer
-            T& poolRef = *poolPair ->first;
-            fDump << "pool[" << i << "] " << poolPair ->first << "\n";
+            fDump << "pool[" << i << "] " << poolPtr << "\n";
             
             // Iterate the pool
-            int poolSz = this ->m_poolSz;
+            unsigned int poolSz = m_pool[i] ->size;
             for (unsigned int f=0; f < poolSz; f++) {
                 
-                if (boolPtr[f]) {
+                if (poolPtr[f].activeIndex != POOL_SLOT_FREE) {
                     
                     // Log the object pointer
-                    T* poolRef = &poolPtr[f];
+                    T* poolRef = (T*)poolPtr[f].object;
                     fDump << " " << f << " " << poolRef << "\n";
                     
                 }
@@ -462,4 +903,3 @@ public:
 };
 
 #endif
-
@@ -2,7 +2,16 @@
 #define _NETWORKING_SUPPORT__
 
 #include <GameEngineFramework/configuration.h>
-#include <WS2tcpip.h>
+
+#ifdef _WIN32
+  #include <WS2tcpip.h>
+#else
+  #include <sys/socket.h>
+  #include <netinet/in.h>
+  #include <arpa/inet.h>
+  
+  typedef int SOCKET;
+#endif
 
 #include <thread>
 #include <mutex>
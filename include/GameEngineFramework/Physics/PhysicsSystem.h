@@ -6,7 +6,7 @@
 #include <GameEngineFramework/Physics/components/meshcollider.h>
 #include <GameEngineFramework/Renderer/components/mesh.h>
 
-#include "../../../vendor/ReactPhysics3d/ReactPhysics3d.h"
+#include "../../../vendor/reactphysics3d/reactphysics3d.h"
 
 #include <cstdlib>
 
@@ -3,7 +3,7 @@
 
 #include <GameEngineFramework/configuration.h>
 
-#include <ReactPhysics3d/ReactPhysics3d.h>
+#include "../../../../vendor/reactphysics3d/reactphysics3d.h"
 #include <vector>
 
 
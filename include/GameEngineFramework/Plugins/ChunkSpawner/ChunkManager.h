@@ -234,7 +234,7 @@ Chunk* ChunkManager::CreateChunk(float chunkX, float chunkZ) {
     
     newChunk->gameObject = Engine.Create<GameObject>();
     
-    newChunk->gameObject->renderDistance = 10000;//renderDistanceStatic * (chunkSize / 2) * 2.0f;
+    newChunk->gameObject->SetRenderDistance( 10000 );//renderDistanceStatic * (chunkSize / 2) * 2.0f;
     
     newChunk->gameObject->AddComponent( Engine.CreateComponentMeshRenderer( Engine.Create<Mesh>(), Engine.Create<Material>() ) );
     
@@ -250,13 +250,13 @@ Chunk* ChunkManager::CreateChunk(float chunkX, float chunkZ) {
     
     baseRenderer->EnableFrustumCulling();
     
-    Engine.sceneMain->AddMeshRendererToSceneRoot( baseRenderer, RENDER_QUEUE_GEOMETRY );
+    Engine.sceneMain->AddStaticMeshRendererToSceneRoot( baseRenderer, RENDER_QUEUE_GEOMETRY );
     
     //
     // Static object container
     
     GameObject* staticObjectContainer = Engine.Create<GameObject>();
-    staticObjectContainer->renderDistance = 10000;//renderDistanceStatic * (chunkSize / 2) * 2.0f;
+    staticObjectContainer->SetRenderDistance( 10000 );//renderDistanceStatic * (chunkSize / 2) * 2.0f;
     
     Transform* transform = staticObjectContainer->GetComponent<Transform>();
     
@@ -284,7 +284,7 @@ Chunk* ChunkManager::CreateChunk(float chunkX, float chunkZ) {
     
     newChunk->staticObjects = staticObjectContainer;
     
-    Engine.sceneMain->AddMeshRendererToSceneRoot(staticRenderer, RENDER_QUEUE_GEOMETRY);
+    Engine.sceneMain->AddStaticMeshRendererToSceneRoot(staticRenderer, RENDER_QUEUE_GEOMETRY);
     
     
     
@@ -293,7 +293,7 @@ Chunk* ChunkManager::CreateChunk(float chunkX, float chunkZ) {
     //
     
     newChunk->waterObject = Engine.Create<GameObject>();
-    newChunk->waterObject->renderDistance = 10000;//(renderDistance * (chunkSize / 2)) * 2.0f;
+    newChunk->waterObject->SetRenderDistance( 10000 );//(renderDistance * (chunkSize / 2)) * 2.0f;
     
     newChunk->waterObject->AddComponent( Engine.CreateComponent<MeshRenderer>() );
     MeshRenderer* waterRenderer = newChunk->waterObject->GetComponent<MeshRenderer>();
@@ -343,7 +343,7 @@ Chunk* ChunkManager::CreateChunk(float chunkX, float chunkZ) {
     waterRenderer->material->diffuse.a = 0.2;
     waterRenderer->material->ambient.a = 0.2;
     
-    Engine.sceneMain->AddMeshRendererToSceneRoot( waterRenderer, RENDER_QUEUE_POSTGEOMETRY);
+    Engine.sceneMain->AddStaticMeshRendererToSceneRoot( waterRenderer, RENDER_QUEUE_POSTGEOMETRY);
     
     return newChunk;
 }
@@ -354,9 +354,9 @@ bool ChunkManager::DestroyChunk(Chunk* chunkPtr) {
     MeshRenderer* waterRenderer = chunkPtr->waterObject->GetComponent<MeshRenderer>();
     MeshRenderer* staticRenderer = chunkPtr->staticObjects->GetComponent<MeshRenderer>();
     
-    Engine.sceneMain->RemoveMeshRendererFromSceneRoot( chunkRenderer, RENDER_QUEUE_GEOMETRY );
-    Engine.sceneMain->RemoveMeshRendererFromSceneRoot( staticRenderer, RENDER_QUEUE_GEOMETRY );
-    Engine.sceneMain->RemoveMeshRendererFromSceneRoot( waterRenderer, RENDER_QUEUE_POSTGEOMETRY );
+    Engine.sceneMain->RemoveStaticMeshRendererFromSceneRoot( chunkRenderer, RENDER_QUEUE_GEOMETRY );
+    Engine.sceneMain->RemoveStaticMeshRendererFromSceneRoot( staticRenderer, RENDER_QUEUE_GEOMETRY );
+    Engine.sceneMain->RemoveStaticMeshRendererFromSceneRoot( waterRenderer, RENDER_QUEUE_POSTGEOMETRY );
     
     Engine.Destroy( chunkPtr->gameObject );
     Engine.Destroy( chunkPtr->staticObjects );
@@ -367,31 +367,9 @@ bool ChunkManager::DestroyChunk(Chunk* chunkPtr) {
     // Destroy physics collider
     Physics.DestroyHeightFieldMap( chunkPtr->collider );
     
-    // Destroy actors
-    
-    unsigned int numberOfActors = chunkPtr->actorList.size();
-    
-    for (unsigned int i=0; i < numberOfActors; i++) {
-        
-        GameObject* actorObject = chunkPtr->actorList[i];
-        
-        Actor* actorPtr = actorObject->GetComponent<Actor>();
-        
-        unsigned int numberOfRenderers = actorPtr->GetNumberOfMeshRenderers();
-        
-        for (unsigned int r=0; r < numberOfRenderers; r++) {
-            
-            MeshRenderer* actorRenderer = actorPtr->GetMeshRendererAtIndex(r);
-            
-            Engine.sceneMain->RemoveMeshRendererFromSceneRoot( actorRenderer, RENDER_QUEUE_GEOMETRY);
-            
-            Renderer.DestroyMeshRenderer(actorRenderer);
-            
-        }
-        
-        Engine.Destroy( actorPtr );
-        
-    }
+    // Queue the actors for garbage collection. Their genetic renderers
+    // are hidden now and destroyed along with the actor components
+    Engine.DestroyGameObjects( chunkPtr->actorList );
     
     chunkPtr->actorList.clear();
     
@@ -542,6 +520,8 @@ glm::vec2 cameraPosition;
 
 void ChunkManager::Update(void) {
     
+    PROFILE_ZONE("Chunk update");
+    
     if (generateWorldChunks) 
         GenerateChunks(cameraPosition);
     
@@ -686,6 +666,8 @@ void ChunkManager::Update(void) {
 
 void ChunkManager::GenerateChunks(glm::vec2 position) {
     
+    PROFILE_ZONE("Generate chunks");
+    
     float noiseWidth  = 0.01f;
     float noiseHeight = 0.01f;
     float heightMul   = 70;
@@ -704,8 +686,23 @@ void ChunkManager::GenerateChunks(glm::vec2 position) {
         cameraZ = Math.Round(position.y / chunkSize);
     }
     
-    float heightField [ chunkSize * chunkSize ];
-    glm::vec3 colorField  [ chunkSize * chunkSize ];
+    // Chunks picked for generation this update
+    struct ChunkCandidate {
+        
+        int chunkAbsX;
+        int chunkAbsZ;
+        
+        float chunkX;
+        float chunkZ;
+        
+        int chunkWorldX;
+        int chunkWorldZ;
+        
+        std::vector<float>     heightField;
+        std::vector<glm::vec3> colorField;
+    };
+    
+    std::vector<ChunkCandidate> candidates;
     
     // Repeat chunk generation
     for (unsigned int i=0; i < 8; i++) {
@@ -731,71 +728,129 @@ void ChunkManager::GenerateChunks(glm::vec2 position) {
         int x = currentChunkX;
         int z = currentChunkZ;
         
-        int chunkAbsX = (x + cameraX) * chunkSize;
-        int chunkAbsZ = (z + cameraZ) * chunkSize;
+        ChunkCandidate candidate;
         
-        float chunkX = chunkAbsX - (((generationDistance / 2) * chunkSize) + chunkSize / 2);
-        float chunkZ = chunkAbsZ - (((generationDistance / 2) * chunkSize) + chunkSize / 2);
+        candidate.chunkAbsX = (x + cameraX) * chunkSize;
+        candidate.chunkAbsZ = (z + cameraZ) * chunkSize;
         
-        int chunkWorldX = (chunkX / chunkSize) * (chunkSize - 1);
-        int chunkWorldZ = (chunkZ / chunkSize) * (chunkSize - 1);
+        candidate.chunkX = candidate.chunkAbsX - (((generationDistance / 2) * chunkSize) + chunkSize / 2);
+        candidate.chunkZ = candidate.chunkAbsZ - (((generationDistance / 2) * chunkSize) + chunkSize / 2);
         
-        Chunk* chunk = CheckChunk(glm::vec2(chunkAbsX, chunkAbsZ));
+        candidate.chunkWorldX = (candidate.chunkX / chunkSize) * (chunkSize - 1);
+        candidate.chunkWorldZ = (candidate.chunkZ / chunkSize) * (chunkSize - 1);
         
-        if (chunk != nullptr) 
+        if (CheckChunk(glm::vec2(candidate.chunkAbsX, candidate.chunkAbsZ)) != nullptr) 
             continue;
+            
+        // The counters may wrap back onto a chunk already picked
+        bool isPicked = false;
         
-        chunk = CreateChunk(chunkWorldX, chunkWorldZ);
-        
-        chunk->position = glm::vec2(chunkAbsX, chunkAbsZ);
-        
-        chunk->gameObject->SetPosition(chunkX, 0, chunkZ);
+        for (unsigned int c=0; c < candidates.size(); c++) {
+            
+            if ((candidates[c].chunkAbsX == candidate.chunkAbsX) & 
+                (candidates[c].chunkAbsZ == candidate.chunkAbsZ)) 
+                isPicked = true;
+        }
         
-        chunk->gameObject->SetUserData( (void*)chunk );
+        if (isPicked) 
+            continue;
+            
+        candidates.push_back(candidate);
+    }
+    
+    //
+    // Height and color fields
+    //
+    // Each candidate fills its own fields so they are generated in parallel.
+    
+    Jobs.ParallelFor(candidates.size(), 1, [&](unsigned int begin, unsigned int end) {
         
-        Engine.SetHeightFieldValues(heightField, chunkSize, chunkSize, 0);
-        Engine.SetColorFieldValues(colorField, chunkSize, chunkSize, Colors.white);
+        PROFILE_ZONE("Chunk fields");
         
-        Engine.GenerateColorFieldFromHeightField(colorField, heightField, chunkSize, chunkSize, colorLow, colorHigh, 0.024f);
+        for (unsigned int i=begin; i < end; i++) {
+            
+            ChunkCandidate& candidate = candidates[i];
+            
+            candidate.heightField.resize(chunkSize * chunkSize);
+            candidate.colorField.resize(chunkSize * chunkSize);
+            
+            float*     heightField = candidate.heightField.data();
+            glm::vec3* colorField  = candidate.colorField.data();
+            
+            Engine.SetHeightFieldValues(heightField, chunkSize, chunkSize, 0);
+            Engine.SetColorFieldValues(colorField, chunkSize, chunkSize, Colors.white);
+            
+            Engine.GenerateColorFieldFromHeightField(colorField, heightField, chunkSize, chunkSize, colorLow, colorHigh, 0.024f);
+            
+            
+            //
+            // Perlin noise layers
+            
+            // Chunk perlin
+            unsigned int numberOfLayers = mPerlinLayers.size();
+            for (unsigned int l=0; l < numberOfLayers; l++) {
+                
+                Perlin* perlinLayer = &mPerlinLayers[l];
+                
+                Engine.AddHeightFieldFromPerlinNoise(heightField, chunkSize, chunkSize, 
+                                                    perlinLayer->noiseWidth, 
+                                                    perlinLayer->noiseHeight, 
+                                                    perlinLayer->heightMultuplier, 
+                                                    candidate.chunkWorldX, candidate.chunkWorldZ, worldSeed);
+                                                    
+            }
+            
+            //
+            // Biome test
+            
+            //Engine.SetColorFieldFromPerlinNoise(colorField, chunkSize, chunkSize, 0.01, 0.01, 0.4, Colors.blue, Colors.red, chunkX, chunkZ);
+            
+            Engine.GenerateColorFieldFromHeightField(colorField, heightField, chunkSize, chunkSize, colorLow, colorHigh, 0.024f);
+            
+            //
+            // Snow cap
+            
+            Engine.AddColorFieldSnowCap(colorField, heightField, chunkSize, chunkSize, Colors.white, world.snowCapHeight, 7.0f);
+            
+            //
+            // Water table
+            
+            Engine.AddColorFieldWaterTable(colorField, heightField, chunkSize, chunkSize, world.waterColorHigh, world.waterLevel, 0.1f, world.waterLevel);
+        }
         
+    });
+    
+    //
+    // Chunk objects, meshes and physics are created on this thread
+    //
+    
+    for (unsigned int i=0; i < candidates.size(); i++) {
         
-        //
-        // Perlin noise layers
+        ChunkCandidate& candidate = candidates[i];
         
-        chunk->gameObject->SetPosition(chunkWorldX, 0, chunkWorldZ);
+        int chunkAbsX = candidate.chunkAbsX;
+        int chunkAbsZ = candidate.chunkAbsZ;
         
-        MeshRenderer* chunkRenderer = chunk->gameObject->GetComponent<MeshRenderer>();
+        float chunkX = candidate.chunkX;
+        float chunkZ = candidate.chunkZ;
         
-        // Chunk perlin
-        unsigned int numberOfLayers = mPerlinLayers.size();
-        for (unsigned int l=0; l < numberOfLayers; l++) {
-            
-            Perlin* perlinLayer = &mPerlinLayers[l];
-            
-            Engine.AddHeightFieldFromPerlinNoise(heightField, chunkSize, chunkSize, 
-                                                perlinLayer->noiseWidth, 
-                                                perlinLayer->noiseHeight, 
-                                                perlinLayer->heightMultuplier, 
-                                                chunkWorldX, chunkWorldZ, worldSeed);
-            
-        }
+        int chunkWorldX = candidate.chunkWorldX;
+        int chunkWorldZ = candidate.chunkWorldZ;
         
-        //
-        // Biome test
+        float*     heightField = candidate.heightField.data();
+        glm::vec3* colorField  = candidate.colorField.data();
         
-        //Engine.SetColorFieldFromPerlinNoise(colorField, chunkSize, chunkSize, 0.01, 0.01, 0.4, Colors.blue, Colors.red, chunkX, chunkZ);
+        Chunk* chunk = CreateChunk(chunkWorldX, chunkWorldZ);
         
-        Engine.GenerateColorFieldFromHeightField(colorField, heightField, chunkSize, chunkSize, colorLow, colorHigh, 0.024f);
+        chunk->position = glm::vec2(chunkAbsX, chunkAbsZ);
         
-        //
-        // Snow cap
+        chunk->gameObject->SetPosition(chunkX, 0, chunkZ);
         
-        Engine.AddColorFieldSnowCap(colorField, heightField, chunkSize, chunkSize, Colors.white, world.snowCapHeight, 7.0f);
+        chunk->gameObject->SetUserData( (void*)chunk );
         
-        //
-        // Water table
+        chunk->gameObject->SetPosition(chunkWorldX, 0, chunkWorldZ);
         
-        Engine.AddColorFieldWaterTable(colorField, heightField, chunkSize, chunkSize, world.waterColorHigh, world.waterLevel, 0.1f, world.waterLevel);
+        MeshRenderer* chunkRenderer = chunk->gameObject->GetComponent<MeshRenderer>();
         
         Transform* transformWater = chunk->waterObject->GetComponent<Transform>();
         transformWater->position.x = chunkWorldX;
@@ -1076,14 +1131,21 @@ void ChunkManager::Decorate(Chunk* chunk, int chunkWorldX, int chunkWorldZ, Mesh
                             
                             unsigned int numberOfChildren = Random.Range(1, 3);
                             
+                            std::vector<glm::vec3> youthPositions;
+                            
                             for (unsigned int c=0; c < numberOfChildren; c++) {
                                 
                                 float offsetX = (Random.Range(0, 1) - Random.Range(0, 1));
                                 float offsetZ = (Random.Range(0, 1) - Random.Range(0, 1));
                                 
-                                GameObject* youthActorObject = Engine.CreateAIActor( glm::vec3(from.x + offsetX, 
-                                                                                               0, 
-                                                                                               from.z + offsetZ) );
+                                youthPositions.push_back( glm::vec3(from.x + offsetX, 0, from.z + offsetZ) );
+                            }
+                            
+                            std::vector<GameObject*> youthActorObjects = Engine.CreateAIActors( youthPositions );
+                            
+                            for (unsigned int c=0; c < youthActorObjects.size(); c++) {
+                                
+                                GameObject* youthActorObject = youthActorObjects[c];
                                 
                                 chunk->actorList.push_back( youthActorObject );
                                 
@@ -1117,10 +1179,13 @@ void ChunkManager::Decorate(Chunk* chunk, int chunkWorldX, int chunkWorldZ, Mesh
 
 void ChunkManager::PurgeChunks(glm::vec2 position) {
     
+    PROFILE_ZONE("Purge chunks");
+    
     if (!updateWorldChunks) 
         return;
     
     unsigned int numberOfChunks = mActiveChunks.size();
+    unsigned int numberOfPurged = 0;
     
     for (unsigned int i=0; i < numberOfChunks; i++) {
         
@@ -1135,11 +1200,21 @@ void ChunkManager::PurgeChunks(glm::vec2 position) {
             
             mActiveChunks.erase( it );
             
+            numberOfPurged++;
+            
             break;
         }
         
     }
     
+    // Return emptied pools after unloading chunks
+    if (numberOfPurged > 0) {
+        
+        mChunkList.Shrink();
+        
+        Engine.ReleaseFreeMemory();
+    }
+    
     return;
 }
 
@@ -1160,6 +1235,10 @@ void ChunkManager::PurgeWorld(void) {
     
     mActiveChunks.clear();
     
+    mChunkList.Shrink();
+    
+    Engine.ReleaseFreeMemory();
+    
     return;
 }
 
@@ -1,10 +1,108 @@
 #ifndef CORE_PROFILER
 #define CORE_PROFILER
 
-#include <GameEngineFramework/Timer/timer.h>
+#include <GameEngineFramework/Timer/Timer.h>
 
-class ENGINE_API ProfilerTimer {
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Number of zones each thread keeps before the oldest are overwritten (Power of two)
+#define  PROFILER_ZONES_PER_THREAD   16384
+
+// Number of frame markers kept before the oldest are overwritten (Power of two)
+#define  PROFILER_NUMBER_OF_FRAMES   4096
+
+// Default number of samples a histogram keeps
+#define  PROFILER_HISTOGRAM_WINDOW             600
+
+// Width of a histogram bucket in milliseconds
+#define  PROFILER_HISTOGRAM_BUCKET_SIZE        0.25f
+
+// Number of histogram buckets. Samples past the last bucket are counted in it
+#define  PROFILER_HISTOGRAM_NUMBER_OF_BUCKETS  400
+
+#define  PROFILER_CONCATENATE_(a, b)  a##b
+#define  PROFILER_CONCATENATE(a, b)   PROFILER_CONCATENATE_(a, b)
+
+/// Time the remainder of the enclosing scope as a zone on the trace. The name must outlive the profiler.
+#define  PROFILE_ZONE(name)   ProfilerZone PROFILER_CONCATENATE(profilerZone, __LINE__)(name)
+
+/// Time the remainder of the enclosing function as a zone on the trace.
+#define  PROFILE_FUNCTION()   PROFILE_ZONE(__FUNCTION__)
+
+
+struct ProfilerThreadBuffer;
+
+
+/// Timings kept as frame time statistics.
+enum class ProfilerChannel {
+    Frame,
+    Engine,
+    Renderer,
+    Physics,
+    ActorAI
+};
+
+#define  PROFILER_NUMBER_OF_CHANNELS   5
+
+
+/// Rolling histogram over the most recent window of millisecond samples.
+class ENGINE_API ProfilerHistogram {
+    
+public:
     
+    /// Add a sample in milliseconds. The oldest sample leaves the window once it is full.
+    void AddSample(float milliseconds);
+    
+    /// Return the sample below which the percentage of samples fall. Resolution is one bucket width.
+    float GetPercentile(float percentage);
+    
+    /// Return the largest sample in the window.
+    float GetMax(void);
+    
+    /// Return the average of the samples in the window.
+    float GetMean(void);
+    
+    /// Return the number of samples in the window.
+    unsigned int GetNumberOfSamples(void);
+    
+    /// Return the number of samples counted in a bucket.
+    unsigned int GetBucketCount(unsigned int index);
+    
+    /// Set the number of samples kept. Clears the histogram.
+    void SetWindow(unsigned int numberOfSamples);
+    
+    /// Return the number of samples kept.
+    unsigned int GetWindow(void);
+    
+    /// Remove all samples.
+    void Clear(void);
+    
+    ProfilerHistogram();
+    
+private:
+    
+    // Samples in the order they were added
+    std::vector<float> mSamples;
+    
+    // Next sample to be overwritten
+    unsigned int mSampleIndex;
+    
+    unsigned int mNumberOfSamples;
+    
+    double mSampleSum;
+    
+    unsigned int mBuckets[PROFILER_HISTOGRAM_NUMBER_OF_BUCKETS];
+    
+    std::mutex mux;
+    
+};
+
+
+class ENGINE_API ProfilerTimer {
+
 public:
     
     /// Profile result for the render system.
@@ -25,12 +123,94 @@ public:
     /// Check the elapse time since begin.
     float Query(void);
     
+    // Frame time statistics
+    
+    /// Add a timing in milliseconds to the histogram of a channel.
+    void AddSample(ProfilerChannel channel, float milliseconds);
+    
+    /// Return the histogram of a channel.
+    ProfilerHistogram& GetHistogram(ProfilerChannel channel);
+    
+    /// Return the name of a channel.
+    std::string GetChannelName(ProfilerChannel channel);
+    
+    /// Set the number of samples every channel keeps. Clears the histograms.
+    void SetHistogramWindow(unsigned int numberOfSamples);
+    
+    /// Write the percentiles and buckets of every channel to a CSV file.
+    bool WriteHistogramCSV(std::string filename);
+    
+    // Trace capture
+    
+    /// Begin recording zones and frame markers.
+    void EnableCapture(void);
+    
+    /// Stop recording zones and frame markers.
+    void DisableCapture(void);
+    
+    /// Return whether zones are being recorded.
+    bool CheckIsCapturing(void);
+    
+    /// Mark the beginning of a new frame on the trace.
+    void MarkFrame(void);
+    
+    /// Name the calling thread on the trace.
+    void SetThreadName(std::string name);
+    
+    /// Discard the recorded zones and frame markers.
+    void ClearTrace(void);
+    
+    /// Write the recorded zones as Chrome trace event JSON. The file can be opened in Perfetto or chrome://tracing.
+    bool ExportTrace(std::string filename);
+    
+    /// Return the current trace time in nanoseconds.
+    unsigned long long int GetTraceTime(void);
+    
+    /// Record a zone on the calling thread.
+    void RecordZone(const char* name, unsigned long long int begin, unsigned long long int end);
+    
     ProfilerTimer();
+    ~ProfilerTimer();
     
 private:
     
     Timer timer;
     
+    std::atomic<bool> mIsCapturing;
+    
+    // Buffers of every thread which has recorded a zone
+    std::vector<ProfilerThreadBuffer*> mThreadBuffers;
+    
+    std::mutex mux;
+    
+    // Frame start times written by the thread marking frames
+    std::atomic<unsigned long long int> mFrames[PROFILER_NUMBER_OF_FRAMES];
+    
+    std::atomic<unsigned long long int> mNumberOfFrames;
+    
+    ProfilerHistogram mHistograms[PROFILER_NUMBER_OF_CHANNELS];
+    
+    // Return the buffer of the calling thread
+    ProfilerThreadBuffer* GetThreadBuffer(void);
+    
+};
+
+
+/// Records the time between its construction and destruction as a zone.
+class ENGINE_API ProfilerZone {
+
+public:
+    
+    ProfilerZone(const char* name);
+    ~ProfilerZone();
+    
+private:
+    
+    const char* mName;
+    
+    // Zero when the profiler was not capturing
+    unsigned long long int mBegin;
+    
 };
 
 #endif
@@ -0,0 +1,114 @@
+//
+// Bounding volume hierarchy
+//
+// Mesh renderers which rarely move are held in a binary tree of axis
+// aligned boxes. The tree is built top down by splitting the renderers at
+// the median center along the longest axis, so each node covers a
+// contiguous run of renderers. Culling walks the tree from the root. A
+// node outside the frustum drops its whole subtree with one test and a
+// node entirely inside accepts its whole subtree without further tests.
+// The tree is rebuilt lazily after renderers are added or removed and its
+// boxes are refitted after renderer bounds change.
+
+#ifndef _BOUNDING_VOLUME_HIERARCHY__
+#define _BOUNDING_VOLUME_HIERARCHY__
+
+#include <GameEngineFramework/configuration.h>
+#include <GameEngineFramework/MemoryAllocation/FrameArena.h>
+#include <GameEngineFramework/Math/Frustum.h>
+
+#include <glm/glm.hpp>
+
+#include <vector>
+
+class MeshRenderer;
+
+// Largest number of renderers held in a leaf
+#define  BVH_LEAF_SIZE                 4
+
+// Number of refits after which the tree is built again
+#define  BVH_REFITS_BEFORE_REBUILD    16
+
+
+class ENGINE_API BoundingVolumeHierarchy {
+
+public:
+    
+    /// Add a mesh renderer. A renderer may belong to one tree at a time.
+    bool Insert(MeshRenderer* meshRenderer);
+    
+    /// Remove a mesh renderer.
+    bool Remove(MeshRenderer* meshRenderer);
+    
+    /// Remove every mesh renderer.
+    void Clear(void);
+    
+    /// Append the mesh renderers which may be inside the frustum.
+    void Cull(const Frustum& frustum, FrameVector<MeshRenderer*>& visible);
+    
+    /// Build or refit the tree if renderers were added, removed or moved since it was last built.
+    void Update(void);
+    
+    /// Flag the renderer bounds as changed. Called by mesh renderers held in the tree.
+    void MarkBoundsChanged(void);
+    
+    
+    /// Return the number of mesh renderers in the tree.
+    unsigned int GetNumberOfRenderers(void);
+    
+    /// Return a mesh renderer in the order it was added.
+    MeshRenderer* GetRenderer(unsigned int index);
+    
+    /// Return the number of nodes in the tree.
+    unsigned int GetNumberOfNodes(void);
+    
+    /// Return the number of node and renderer boxes tested by the last cull.
+    unsigned int GetNumberOfTests(void);
+    
+    BoundingVolumeHierarchy();
+    ~BoundingVolumeHierarchy();
+    
+private:
+    
+    struct Node {
+        
+        glm::vec3 boundsMin;
+        glm::vec3 boundsMax;
+        
+        // Run of renderers covered by the node
+        unsigned int first;
+        unsigned int count;
+        
+        // Index of the first of two children. Zero for a leaf
+        unsigned int child;
+    };
+    
+    // Renderers in the order they were added
+    std::vector<MeshRenderer*> mRenderers;
+    
+    // Renderers in tree order
+    std::vector<MeshRenderer*> mLeafRenderers;
+    
+    std::vector<Node> mNodes;
+    
+    bool mNeedsRebuild;
+    bool mNeedsRefit;
+    
+    unsigned int mNumberOfRefits;
+    unsigned int mNumberOfTests;
+    
+    // Build the tree from the renderer bounds
+    void Build(void);
+    
+    // Split a node and build its children
+    void BuildNode(unsigned int index);
+    
+    // Fit the node boxes around the renderer bounds again
+    void Refit(void);
+    
+    // Fit a node box around its children or renderers
+    void FitNode(Node& node);
+    
+};
+
+#endif
@@ -0,0 +1,62 @@
+//
+// Render queue sort keys
+//
+// Every mesh renderer carries a 64 bit key which orders the draws of a
+// queue. From the most significant bit the key holds
+//
+//   queue group    4 bits
+//   depth bucket  16 bits
+//   shader        14 bits
+//   material      15 bits
+//   mesh          15 bits
+//
+// The depth bucket is the upper half of the squared camera distance as a
+// float, which keeps more buckets close to the camera than far away. It is
+// inverted for queues drawn back to front. Keys are sorted with a stable
+// radix sort. A queue left in order by the previous frame usually needs
+// no sorting or only a few insertions, so those are tried first.
+
+#ifndef _RENDER_QUEUE_SORT__
+#define _RENDER_QUEUE_SORT__
+
+#include <GameEngineFramework/configuration.h>
+
+class MeshRenderer;
+
+// Number of moves an insertion sort may make per entry before the radix sort is used instead
+#define  RENDER_SORT_INSERTION_BUDGET  4
+
+
+class ENGINE_API RenderQueueSort {
+
+public:
+    
+    /// Sort key paired with the renderer it orders.
+    struct Entry {
+        
+        unsigned long long int key;
+        
+        MeshRenderer* renderer;
+        
+    };
+    
+    /// Compose a sort key.
+    static unsigned long long int BuildKey(unsigned int queueGroup, unsigned int depthBucket, const void* shader, const void* material, const void* mesh);
+    
+    /// Return the depth bucket of a squared distance from the camera.
+    static unsigned int GetDepthBucket(float distanceSquared, bool isBackToFront);
+    
+    /// Return an identifier of a resource pointer folded into the given number of bits. Null is zero.
+    static unsigned int GetResourceId(const void* resource, unsigned int numberOfBits);
+    
+    /// Stable sort of entries by key in ascending order. The scratch buffer must hold as many entries.
+    static void Sort(Entry* entries, Entry* scratch, unsigned int count);
+    
+    /// Order a draw list of dynamic entries followed by static entries, each run already sorted by key. The runs are
+    /// optionally merged by depth, then only the shader, material and mesh bits are kept and the list is optionally
+    /// grouped by them with a stable sort. The scratch buffer must hold as many entries.
+    static void SortDrawList(Entry* entries, Entry* scratch, unsigned int numberOfDynamic, unsigned int count, bool doMergeByDepth, bool doGroupByState);
+    
+};
+
+#endif
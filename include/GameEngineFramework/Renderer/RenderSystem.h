@@ -2,8 +2,13 @@
 #define OPENGL_RENDERER_SYSTEM
 
 #include <GameEngineFramework/MemoryAllocation/PoolAllocator.h>
+#include <GameEngineFramework/MemoryAllocation/ConcurrentPoolAllocator.h>
+#include <GameEngineFramework/MemoryAllocation/FrameArena.h>
 
 #include <GameEngineFramework/Renderer/enumerators.h>
+#include <GameEngineFramework/Renderer/RenderQueueSort.h>
+
+#include <GameEngineFramework/Math/Frustum.h>
 
 #include <GameEngineFramework/Renderer/components/camera.h>
 #include <GameEngineFramework/Renderer/components/light.h>
@@ -48,6 +53,10 @@ public:
     /// Recalculate lights every frame.
     bool doUpdateLightsEveryFrame;
     
+    /// Run without a render context. Meshes, textures, shaders and frame buffers
+    /// keep their data on the CPU and nothing is handed to the graphics driver.
+    bool isHeadless;
+    
     
     RenderSystem();
     
@@ -95,10 +104,10 @@ public:
     unsigned int GetNumberOfCameras(void);
     
     
-    /// Create a material object and return its pointer.
+    /// Create a material object and return its pointer. Safe to call from any thread.
     Material* CreateMaterial(void);
     
-    /// Destroy a material object and return true on success.
+    /// Destroy a material object and return true on success. Safe to call from any thread.
     bool DestroyMaterial(Material* materialPtr);
     
     /// Return the number of material objects.
@@ -177,18 +186,57 @@ public:
     /// Get number of draw calls made in the last frame.
     unsigned int GetNumberOfDrawCalls(void);
     
+    /// Get number of mesh renderers drawn by instanced draw calls in the last frame.
+    unsigned int GetNumberOfInstances(void);
+    
+    /// Get number of shader binds made in the last frame.
+    unsigned int GetNumberOfShaderBinds(void);
+    
+    /// Get number of material binds made in the last frame.
+    unsigned int GetNumberOfMaterialBinds(void);
+    
+    /// Get number of mesh binds made in the last frame.
+    unsigned int GetNumberOfMeshBinds(void);
+    
+    /// Get number of uniforms sent to shaders in the last frame.
+    unsigned int GetNumberOfUniformUploads(void);
+    
+    /// Set how far between the last two simulation steps the frame is drawn. Zero draws the previous step and one the latest.
+    void SetInterpolationFactor(float factor);
+    
+    /// Get how far between the last two simulation steps the frame is drawn.
+    float GetInterpolationFactor(void);
+    
+    /// Release any object pools which no longer hold any objects.
+    void ReleaseFreeMemory(void);
+    
     
     friend class EngineSystemManager;
+    friend class BenchmarkFramework;
     
     
 private:
     
     // Draw call counter
     unsigned int mNumberOfDrawCalls;
+    unsigned int mNumberOfInstances;
+    
+    // State change counters
+    unsigned int mNumberOfShaderBinds;
+    unsigned int mNumberOfMaterialBinds;
+    unsigned int mNumberOfMeshBinds;
+    unsigned int mNumberOfUniformUploads;
+    
+    // Advanced for every scene so each shader receives the camera and lights once
+    unsigned long long int mUniformEpoch;
     
     // Frame counter
     unsigned long long int mNumberOfFrames;
     
+    // Interpolation between simulation steps
+    float                  mInterpolationFactor;
+    unsigned long long int mInterpolationStep;
+    
     // Render queue group
     std::vector<Scene*>  mActiveScenes;
     
@@ -197,8 +245,11 @@ private:
     Material*  mCurrentMaterial;
     Shader*    mCurrentShader;
     
-    // Sorting
-    std::vector<std::pair<float, MeshRenderer*>> mRenderQueueSorter[5];
+    // Per instance attributes of the current instanced draw
+    unsigned int mInstanceBuffer;
+    
+    // View frustum of the scene camera
+    Frustum    mFrustum;
     
     // Light list
     unsigned int mNumberOfLights=0;
@@ -221,7 +272,7 @@ private:
     // Render component allocators
     PoolAllocator<MeshRenderer>    mEntity;
     PoolAllocator<Mesh>            mMesh;
-    PoolAllocator<Material>        mMaterial;
+    ConcurrentPoolAllocator<Material> mMaterial;
     PoolAllocator<Shader>          mShader;
     PoolAllocator<Camera>          mCamera;
     PoolAllocator<Light>           mLight;
@@ -229,11 +280,6 @@ private:
     PoolAllocator<FrameBuffer>     mFrameBuffer;
     PoolAllocator<Texture>         mTexture;
     
-    // TODO: Sorting and other non openGL related render functions could be threaded out here
-    
-    // Render support thread
-    std::thread* renderThreadMain;
-    
     
     //
     // Render pipeline
@@ -253,17 +299,28 @@ private:
     
     bool BindShader(Shader* shaderPtr);
     
+    // Send the camera, lights and material to the bound shader when it has not yet received them
+    void SetShaderUniforms(glm::vec3& eye, glm::vec3 cameraAngle, glm::mat4& viewProjection);
+    
     // Passes
     
+    unsigned int DrawListPass(std::vector<MeshRenderer*>* renderQueueGroup, FrameVector<MeshRenderer*>& staticRenderers, unsigned int queueGroupIndex, FrameVector<RenderQueueSort::Entry>& drawList);
+    
     bool GeometryPass(MeshRenderer* currentEntity, glm::vec3& eye, glm::vec3 cameraAngle, glm::mat4& viewProjection);
     
+    unsigned int InstancingPass(RenderQueueSort::Entry* drawList, unsigned int numberOfDraws, glm::vec3& eye, glm::vec3 cameraAngle, glm::mat4& viewProjection);
+    
+    bool CheckMaterialStateMatches(Material* materialA, Material* materialB);
+    
     bool ShadowVolumePass(MeshRenderer* currentEntity, glm::vec3& eye, glm::vec3 cameraAngle, glm::mat4& viewProjection);
     
-    bool SortingPass(glm::vec3& eye, std::vector<MeshRenderer*>* renderQueueGroup, unsigned int queueGroupIndex);
+    bool SortingPass(glm::vec3& eye, MeshRenderer** renderers, unsigned int numberOfRenderers, unsigned int queueGroupIndex);
     
     void LevelOfDetailPass(MeshRenderer* currentEntity, glm::vec3& eye);
     
-    bool CullingPass(MeshRenderer* currentEntity, Camera* currentCamera);
+    bool CullingPass(MeshRenderer* currentEntity);
+    
+    bool InterpolationPass(MeshRenderer* currentEntity, glm::mat4& matrix, glm::mat3& normalMatrix);
     
     
     // Default assets
@@ -273,6 +330,7 @@ private:
         Shader*  textureUnlit = nullptr;
         Shader*  color = nullptr;
         Shader*  colorUnlit = nullptr;
+        Shader*  colorInstanced = nullptr;
         Shader*  UI = nullptr;
         Shader*  shadowCaster = nullptr;
         Shader*  sky = nullptr;
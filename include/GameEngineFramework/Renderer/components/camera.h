@@ -58,14 +58,6 @@ public:
     float clipFar;
     
     
-    /// How far in degrees the frustum angles should overlap when culling.
-    float frustumOverlap;
-    
-    /// Distance behind the camera where culling should begin.
-    /// This prevents clipping when culling large objects.
-    float frustumOffset;
-    
-    
     /// Maximum pitch angle limit. (in radians)
     int mouseLimitPitchMax;
     
@@ -95,13 +87,18 @@ public:
     
     
     friend class RenderSystem;
+    friend class EngineSystemManager;
     
     Camera();
     
     
 private:
     
+    // Simulation step which last moved the camera
+    unsigned long long int mInterpolationStep;
     
+    // Position before the last simulation step
+    glm::vec3 mPreviousPosition;
     
 };
 
@@ -3,9 +3,9 @@
 
 #include <GameEngineFramework/configuration.h>
 
-#include <GameEngineFramework/engine/types/bufferlayout.h>
+#include <GameEngineFramework/Engine/types/bufferlayout.h>
 
-#include <GameEngineFramework/engine/types/color.h>
+#include <GameEngineFramework/Engine/types/color.h>
 #include <GameEngineFramework/Math/Math.h>
 #include <GameEngineFramework/Math/Random.h>
 #include <GameEngineFramework/Renderer/components/submesh.h>
@@ -43,6 +43,9 @@ public:
     /// Add a vertex buffer directly into this vertex buffer. The index of the sub mesh in the mesh will be returned. A return value of negative one indicated an error.
     int AddSubMesh(float x, float y, float z, std::vector<Vertex>& vrtxBuffer, std::vector<Index>& indxBuffer, bool doUploadToGpu=true);
     
+    /// Add vertex and index arrays directly into this vertex buffer. The index of the sub mesh in the mesh will be returned. A return value of negative one indicated an error.
+    int AddSubMesh(float x, float y, float z, Vertex* vrtxBuffer, unsigned int vertexCount, Index* indxBuffer, unsigned int indexCount, bool doUploadToGpu=true);
+    
     /// Remove a sub mesh from this vertex buffer.
     bool RemoveSubMesh(unsigned int index);
     
@@ -104,6 +107,9 @@ public:
     /// Disable a vertex attribute.
     void DisableAttribute(int index);
     
+    /// Read the instance attributes from a buffer of instances, stepping once per instance.
+    void SetInstanceBuffer(unsigned int instanceBuffer);
+    
     
     /// Load vertex buffer data onto the GPU.
     void LoadVertexBuffer(Vertex* bufferData, int vertexCount);
@@ -121,6 +127,9 @@ public:
     /// Run a draw call on this index buffer.
     void DrawIndexArray(void);
     
+    /// Run a draw call on this index buffer for a number of instances.
+    void DrawIndexArrayInstanced(unsigned int numberOfInstances);
+    
     
     /// Return the number of sub meshes in this vertex buffer.
     unsigned int GetSubMeshCount(void);
@@ -132,7 +141,27 @@ public:
     void SetNormals(glm::vec3 normals);
     
     
+    /// Calculate the bounding box and bounding sphere around the vertex buffer. Called when the mesh is loaded.
+    void CalculateBounds(void);
+    
+    /// Return whether the mesh has bounds. A mesh without vertices has none.
+    bool CheckHasBounds(void);
+    
+    /// Return the minimum corner of the bounding box.
+    glm::vec3 GetBoundingBoxMin(void);
+    
+    /// Return the maximum corner of the bounding box.
+    glm::vec3 GetBoundingBoxMax(void);
+    
+    /// Return the center of the bounding sphere.
+    glm::vec3 GetBoundingSphereCenter(void);
+    
+    /// Return the radius of the bounding sphere.
+    float GetBoundingSphereRadius(void);
+    
+    
     friend class RenderSystem;
+    friend class MeshRenderer;
     
     Mesh();
     ~Mesh();
@@ -148,6 +177,9 @@ private:
     unsigned int mBufferVertex;
     unsigned int mBufferIndex;
     
+    // Buffer the instance attributes are read from
+    unsigned int mInstanceBuffer;
+    
     // Render draw type
     int mPrimitive;
     
@@ -167,6 +199,18 @@ private:
     // List of freed sub meshes in this mesh
     std::vector<SubMesh> mFreeMesh;
     
+    // Bounds in mesh space
+    glm::vec3 mBoundingBoxMin;
+    glm::vec3 mBoundingBoxMax;
+    
+    glm::vec3 mBoundingSphereCenter;
+    float     mBoundingSphereRadius;
+    
+    bool mHasBounds;
+    
+    // Counted up each time the bounds are calculated
+    unsigned int mBoundsVersion;
+    
     // Apply default vertex layout settings
     void SetDefaultAttributes(void);
     
@@ -6,6 +6,8 @@
 #include <GameEngineFramework/Renderer/components/material.h>
 #include <GameEngineFramework/Renderer/components/mesh.h>
 
+class BoundingVolumeHierarchy;
+
 class ENGINE_API LevelOfDetail {
     
 public:
@@ -41,6 +43,21 @@ public:
     /// Disable culling for this entity
     void DisableFrustumCulling(void);
     
+    /// Draw this entity between its last two simulated positions
+    void EnableInterpolation(void);
+    
+    /// Draw this entity at its last simulated position
+    void DisableInterpolation(void);
+    
+    /// Fit the world bounding box around the mesh bounds under the transform matrix. Called by the engine when the transform is updated.
+    void UpdateBounds(void);
+    
+    /// Return the minimum corner of the world bounding box.
+    glm::vec3 GetBoundingBoxMin(void);
+    
+    /// Return the maximum corner of the world bounding box.
+    glm::vec3 GetBoundingBoxMax(void);
+    
     MeshRenderer();
     
 private:
@@ -48,7 +65,44 @@ private:
     // Is this renderer being culled
     bool mDoCulling;
     
+    // Is this renderer drawn between simulation steps
+    bool mDoInterpolation;
+    
+    // Simulation step which last wrote the matrix
+    unsigned long long int mInterpolationStep;
+    
+    // Matrix before the last simulation step
+    glm::mat4 mPreviousMatrix;
+    
+    // Draw order within the render queue
+    unsigned long long int mSortKey;
+    
+    // World bounding box
+    glm::vec3 mBoundingBoxMin;
+    glm::vec3 mBoundingBoxMax;
+    
+    // Mesh and mesh bounds the box was fitted to
+    Mesh*        mBoundsMesh;
+    unsigned int mBoundsVersion;
+    
+    // Tree holding this renderer when it is static
+    BoundingVolumeHierarchy* mStaticTree;
+    
+    // Grow the world bounding box to hold the mesh bounds under a matrix
+    void ExpandBounds(const glm::mat4& matrix);
+    
+    // Grow the box without notifying the tree
+    void GrowBounds(const glm::mat4& matrix);
+    
+    // Tell the tree when the box differs from the one given
+    void NotifyBoundsChanged(const glm::vec3& boundsMin, const glm::vec3& boundsMax);
+    
+    // Has the mesh been swapped or its bounds calculated again since the box was fitted
+    bool CheckBoundsAreStale(void);
+    
     friend class RenderSystem;
+    friend class EngineSystemManager;
+    friend class BoundingVolumeHierarchy;
     
 };
 
@@ -4,6 +4,7 @@
 #include <GameEngineFramework/Renderer/components/meshrenderer.h>
 #include <GameEngineFramework/Renderer/components/camera.h>
 #include <GameEngineFramework/Renderer/components/light.h>
+#include <GameEngineFramework/Renderer/BoundingVolumeHierarchy.h>
 
 
 class ENGINE_API Scene {
@@ -25,6 +26,12 @@ public:
     /// Remove a mesh renderer from this scene.
     bool RemoveMeshRendererFromSceneRoot(MeshRenderer* meshRenderer, int renderQueueGroup);
     
+    /// Add a mesh renderer which rarely moves to this scene. Static renderers are culled through a bounding volume hierarchy rather than one by one.
+    void AddStaticMeshRendererToSceneRoot(MeshRenderer* meshRenderer, int renderQueueGroup = RENDER_QUEUE_GEOMETRY);
+    
+    /// Remove a static mesh renderer from this scene.
+    bool RemoveStaticMeshRendererFromSceneRoot(MeshRenderer* meshRenderer, int renderQueueGroup);
+    
     /// Add a light to this scene.
     void AddLightToSceneRoot(Light* light);
     
@@ -49,6 +56,12 @@ private:
     std::vector<MeshRenderer*>  mRenderQueueBackground;
     std::vector<MeshRenderer*>  mRenderQueueSky;
     
+    /// Static mesh renderers of each queue group, indexed from the sky queue.
+    BoundingVolumeHierarchy  mStaticRenderQueue[RENDER_NUMBER_OF_QUEUE_GROUPS];
+    
+    /// Return the static queue index of a render queue group.
+    unsigned int GetStaticQueueIndex(int renderQueueGroup);
+    
     /// List of lights in this scene.
     std::vector<Light*>  mLightList;
     
@@ -6,6 +6,8 @@
 
 #include <string>
 
+class Material;
+
 
 class ENGINE_API Shader {
     
@@ -69,6 +71,9 @@ public:
     /// Return the opengl index of the shader program.
     unsigned int GetProgram(void);
     
+    /// Return whether the program reads the model matrix and color per instance rather than from uniforms.
+    bool CheckIsInstanced(void);
+    
     /// Bind the shader program for rendering.
     void Bind(void);
     
@@ -107,6 +112,15 @@ private:
     
     bool  mIsShaderLoaded;
     
+    // Program declares the instance attributes
+    bool  mIsInstanced;
+    
+    // Frame whose camera and light uniforms were last sent to the program
+    unsigned long long int mUniformEpoch;
+    
+    // Material whose colors were last sent to the program
+    Material* mUniformMaterial;
+    
     unsigned int CompileSource(unsigned int Type, std::string Script);
     
 };
@@ -3,9 +3,9 @@
 
 #include <GameEngineFramework/configuration.h>
 
-#include <GameEngineFramework/engine/types/bufferlayout.h>
+#include <GameEngineFramework/Engine/types/bufferlayout.h>
 
-#include <GameEngineFramework/engine/types/color.h>
+#include <GameEngineFramework/Engine/types/color.h>
 #include <GameEngineFramework/Math/Math.h>
 #include <GameEngineFramework/Math/Random.h>
 
@@ -7,7 +7,7 @@
 #include <GameEngineFramework/Resources/assets/colliderTag.h>
 #include <GameEngineFramework/Resources/assets/textureTag.h>
 #include <GameEngineFramework/Resources/assets/shaderTag.h>
-#include <GameEngineFramework/Resources/assets/MeshTag.h>
+#include <GameEngineFramework/Resources/assets/meshTag.h>
 
 #include <GameEngineFramework/Resources/FileSystem.h>
 
@@ -0,0 +1,49 @@
+//
+// Monotonic clock
+//
+// Timestamps are integer nanoseconds counted from an arbitrary point. The
+// operating system clock is read by default. On x86 processors with an
+// invariant time stamp counter the counter may be read instead, which
+// costs a few nanoseconds rather than a call into the system. The counter
+// is calibrated against the system clock when it is enabled.
+
+#ifndef _CLOCK_MONOTONIC__
+#define _CLOCK_MONOTONIC__
+
+#include <GameEngineFramework/configuration.h>
+
+
+class ENGINE_API Clock {
+
+public:
+    
+    /// Sources a timestamp may be read from.
+    enum class Source {
+        System,
+        TSC
+    };
+    
+    /// Return the current time in nanoseconds from the active source.
+    static unsigned long long int GetTime(void);
+    
+    /// Return the current time in nanoseconds from the operating system clock.
+    static unsigned long long int GetSystemClockTime(void);
+    
+    /// Calibrate the time stamp counter and read timestamps from it. Returns false when the processor has no invariant counter.
+    static bool EnableTSC(void);
+    
+    /// Read timestamps from the operating system clock.
+    static void DisableTSC(void);
+    
+    /// Return the source timestamps are read from.
+    static Source GetSource(void);
+    
+    /// Return the calibrated frequency of the time stamp counter in hertz. Zero until the counter has been calibrated.
+    static unsigned long long int GetTSCFrequency(void);
+    
+    /// Return the average cost in nanoseconds of reading a timestamp from the active source.
+    static double MeasureReadCost(unsigned int numberOfReads=100000);
+    
+};
+
+#endif
@@ -0,0 +1,103 @@
+//
+// Fixed step scheduler
+//
+// Systems are registered with their own update rate. Elapsed time is
+// accumulated per system and every whole step which has come due is run
+// in registration order. A system runs a limited number of steps per
+// update; whole steps beyond the limit are dropped rather than caught up
+// so a slow frame cannot snowball. The time left over in a system after
+// its steps gives the interpolation factor between its last two states.
+
+#ifndef _FIXED_STEP_SCHEDULER__
+#define _FIXED_STEP_SCHEDULER__
+
+#include <GameEngineFramework/configuration.h>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+// Default number of steps a system may run per update before time is dropped
+#define  SCHEDULER_MAX_STEPS_PER_UPDATE   4
+
+
+/// Function called for each step with the time step in seconds.
+typedef std::function<void(float timeStep)> SchedulerFunction;
+
+
+class ENGINE_API Scheduler {
+
+public:
+    
+    /// Register a system stepped at a fixed rate and return its index.
+    unsigned int AddSystem(std::string name, double updatesPerSecond, SchedulerFunction function, unsigned int maxStepsPerUpdate=SCHEDULER_MAX_STEPS_PER_UPDATE);
+    
+    /// Run the steps which have come due since the previous update.
+    void Update(void);
+    
+    /// Run the steps which come due after the given number of milliseconds.
+    void Advance(double milliseconds);
+    
+    /// Drop the time accumulated by every system. Used after a pause so the time away is not caught up.
+    void Reset(void);
+    
+    /// Return the fraction of a step accumulated since the last step of a system.
+    float GetInterpolationFactor(unsigned int index);
+    
+    /// Return the time step of a system in seconds.
+    float GetTimeStep(unsigned int index);
+    
+    /// Set the number of steps per second of a system.
+    void SetRate(unsigned int index, double updatesPerSecond);
+    
+    /// Return the number of steps per second of a system.
+    double GetRate(unsigned int index);
+    
+    /// Set the number of steps a system may run per update.
+    void SetMaxStepsPerUpdate(unsigned int index, unsigned int maxStepsPerUpdate);
+    
+    /// Return the number of steps a system has run.
+    unsigned long long int GetNumberOfSteps(unsigned int index);
+    
+    /// Return the number of steps a system has dropped to stay within its step limit.
+    unsigned long long int GetNumberOfDroppedSteps(unsigned int index);
+    
+    /// Return the name of a system.
+    std::string GetName(unsigned int index);
+    
+    /// Return the number of registered systems.
+    unsigned int GetNumberOfSystems(void);
+    
+    Scheduler();
+    
+private:
+    
+    struct ScheduledSystem {
+        
+        std::string name;
+        
+        SchedulerFunction function;
+        
+        double rate;
+        
+        // Step length and accumulated time in nanoseconds
+        unsigned long long int step;
+        unsigned long long int accumulator;
+        
+        unsigned int maxStepsPerUpdate;
+        
+        unsigned long long int numberOfSteps;
+        unsigned long long int numberOfDroppedSteps;
+    };
+    
+    std::vector<ScheduledSystem> mSystems;
+    
+    // Clock time of the previous update
+    unsigned long long int mLastTime;
+    
+    // Run the due steps of every system after a number of nanoseconds
+    void AdvanceTime(unsigned long long int elapsed);
+    
+};
+
+#endif
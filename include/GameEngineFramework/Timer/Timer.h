@@ -35,7 +35,7 @@ public:
     /// Update and return the timer state.
     bool Update(void);
     
-    /// Return the current time delta without resetting the delta value.
+    /// Return the current clock time in milliseconds.
     double Current(void);
     
     /// Set the update rate in milliseconds.
@@ -44,11 +44,8 @@ public:
     
 private:
     
-    // Precision frequency adjustment
-    double timeFrequency;
-    
-    // Previous frame time
-    long long int tLast;
+    // Previous frame time in nanoseconds
+    unsigned long long int tLast;
     
 };
 
@@ -34,6 +34,9 @@ public:
     /// Transform matrix
     glm::mat4 matrix;
     
+    /// Inverse transpose of the transform matrix for transforming normals.
+    glm::mat3 normalMatrix;
+    
     /// Pointer to a parent transform.
     Transform* parent;
     
@@ -103,6 +106,56 @@ public:
     /// Update the model matrix from the current position, rotation and scale.
     void UpdateMatrix(void);
     
+    
+    /// Flag the transform to rebuild its world matrix on the next update.
+    void MarkDirty(void);
+    
+    /// Rebuild the cached world values if the transform or its parent chain has changed. The parent must be updated first. Returns whether the world values changed.
+    bool UpdateWorldCache(bool doUpdateMatrix);
+    
+    /// Rebuild the cached world values without building the matrix. Returns whether the caller must compose the matrix and normal matrix from the world values.
+    bool UpdateWorldValues(bool doUpdateMatrix);
+    
+    /// Return the position accumulated down the parent chain.
+    glm::vec3 GetWorldPosition(void);
+    
+    /// Return the rotation accumulated down the parent chain.
+    glm::quat GetWorldRotation(void);
+    
+    /// Return the scale accumulated down the parent chain.
+    glm::vec3 GetWorldScale(void);
+    
+    /// Return whether the world values changed during the last update.
+    bool CheckHasChanged(void);
+    
+private:
+    
+    // Set by MarkDirty to force a rebuild
+    bool mIsDirty;
+    
+    // World values changed during the last update
+    bool mHasChanged;
+    
+    // The matrix was built from the current world values
+    bool mIsMatrixCurrent;
+    
+    // Values seen by the last update
+    glm::vec3  mLastPosition;
+    glm::quat  mLastRotation;
+    glm::vec3  mLastScale;
+    Transform* mLastParent;
+    bool       mLastInheritRotation;
+    bool       mLastInheritScale;
+    
+    // Accumulated values down the parent chain
+    glm::vec3  mWorldPosition;
+    glm::quat  mWorldRotation;
+    glm::vec3  mWorldScale;
+    
+    // Rotation and scale passed down to the children
+    glm::quat  mChainRotation;
+    glm::vec3  mChainScale;
+    
 };
 
 
@@ -3,6 +3,8 @@
 
 #include <GameEngineFramework/configuration.h>
 
+#include <GameEngineFramework/MemoryAllocation/FrameArena.h>
+
 #include <string>
 #include <vector>
 
@@ -13,6 +15,9 @@ public:
     /// Return a float containing the numbers from text.
     float    ToFloat(std::string value);
     
+    /// Return a float containing the numbers from a null terminated string.
+    float    ToFloat(const char* value);
+    
     /// Return a double containing the numbers from text.
     double   ToDouble(std::string value);
     
@@ -25,6 +30,13 @@ public:
     /// Explode the string by the given delimiter into an array of strings.
     std::vector<std::string> Explode(std::string value, const char character);
     
+    /// Explode the string by the given delimiter into an array of strings held in the frame arena of the calling thread.
+    /// The result is only valid until the arena is reset at the end of the frame.
+    FrameVector<FrameString> ExplodeFrame(const std::string& value, const char character);
+    
+    /// Explode a frame string by the given delimiter into an array of strings held in the frame arena of the calling thread.
+    FrameVector<FrameString> ExplodeFrame(const FrameString& value, const char character);
+    
     /// Return the filename from a file name.
     std::string GetNameFromFilename(std::string filename);
     
@@ -32,6 +32,12 @@
 
 //#define PROFILE_ENGINE_CORE
 
+// Read timestamps from the processor time stamp counter when it is invariant
+//#define TIMER_TIME_STAMP_COUNTER
+
+// Frame time percentiles are written here at shutdown
+#define PROFILER_HISTOGRAM_CSV  "frametimes.csv"
+
 
 
 //
@@ -107,5 +113,11 @@
     #define ENGINE_API  __declspec(dllimport)
 #endif
 
+// Shared objects export their symbols by default outside of Windows
+#ifndef _WIN32
+    #undef  ENGINE_API
+    #define ENGINE_API
+#endif
+
 
 #endif
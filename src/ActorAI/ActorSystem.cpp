@@ -1,16 +1,19 @@
 #include <GameEngineFramework/ActorAI/ActorSystem.h>
 #include <GameEngineFramework/Logging/Logging.h>
 #include <GameEngineFramework/Math/Random.h>
+#include <GameEngineFramework/JobSystem/JobSystem.h>
+#include <GameEngineFramework/Profiler/profiler.h>
 
 extern Logger Log;
 extern ActorSystem AI;
 extern NumberGeneration Random;
 extern MathCore Math;
+extern JobSystem Jobs;
+extern ProfilerTimer Profiler;
 
-// Actor system thread
+// Actor system update cycle
 bool isActorThreadActive = true;
 bool doUpdate = false;
-void actorThreadMain(void);
 
 int actorCounter=0;
 
@@ -18,15 +21,19 @@ int actorCounter=0;
 ActorSystem::ActorSystem() : 
     mPlayerPosition(0),
     mActorUpdateDistance(300),
-    mActorDetailDistance(100)
+    mActorDetailDistance(100),
+    mIsUpdateScheduled(false),
+    mDoReleaseFreeMemory(false)
 {
 }
 
 void ActorSystem::Initiate(void) {
     
-    mActorSystemThread = new std::thread( actorThreadMain );
+    mux.lock();
+    isActorThreadActive = true;
+    mux.unlock();
     
-    Log.Write( " >> Starting thread AI" );
+    Log.Write( " >> Starting AI jobs" );
     
     return;
 }
@@ -37,7 +44,57 @@ void ActorSystem::Shutdown(void) {
     isActorThreadActive = false;
     mux.unlock();
     
-    mActorSystemThread->join();
+    // Let the update job in flight see the flag and finish
+    while (true) {
+        
+        mux.lock();
+        bool isScheduled = mIsUpdateScheduled;
+        mux.unlock();
+        
+        if (!isScheduled) 
+            break;
+            
+        std::this_thread::sleep_for( std::chrono::duration<float, std::milli>(1) );
+    }
+    
+    Log.Write( " >> Shutting down AI jobs" );
+    
+    return;
+}
+
+void ActorSystem::ScheduleUpdate(void) {
+    
+    Jobs.Schedule( []() {
+        
+        unsigned long long int updateBegin = Profiler.GetTraceTime();
+        
+        AI.Update();
+        
+        // Nanoseconds to milliseconds
+        Profiler.AddSample(ProfilerChannel::ActorAI, (Profiler.GetTraceTime() - updateBegin) / 1000000.0f);
+        
+        AI.mux.lock();
+        
+        // Pools are released between batches while no update reads the actors
+        if (AI.mDoReleaseFreeMemory) {
+            
+            AI.mActors.Shrink();
+            
+            AI.mDoReleaseFreeMemory = false;
+        }
+        
+        // Queue the next batch until the cycle over the actors has finished
+        bool doContinue = doUpdate & isActorThreadActive;
+        
+        if (!doContinue) 
+            AI.mIsUpdateScheduled = false;
+            
+        AI.mux.unlock();
+        
+        if (doContinue) 
+            AI.ScheduleUpdate();
+        
+    });
     
     return;
 }
@@ -68,30 +125,46 @@ glm::vec3 ActorSystem::GetPlayerWorldPosition(void) {
 void ActorSystem::UpdateSendSignal(void) {
     mux.lock();
     doUpdate = true;
+    
+    // Only one update job may be in flight at a time
+    bool doSchedule = (!mIsUpdateScheduled) & isActorThreadActive;
+    
+    if (doSchedule) 
+        mIsUpdateScheduled = true;
+        
     mux.unlock();
+    
+    if (doSchedule) 
+        ScheduleUpdate();
+        
     return;
 }
 
 Actor* ActorSystem::CreateActor(void) {
-    mux.lock();
-    Actor* newActor = mActors.Create();
-    mux.unlock();
-    return newActor;
+    return mActors.Create();
 }
 
 bool ActorSystem::DestroyActor(Actor* actorPtr) {
+    return mActors.Destroy(actorPtr);
+}
+
+void ActorSystem::ReleaseFreeMemory(void) {
     mux.lock();
-    bool state = mActors.Destroy(actorPtr);
+    
+    // The update job resolves actors so it releases the pools itself when it is in flight
+    if (mIsUpdateScheduled) {
+        mDoReleaseFreeMemory = true;
+    } else {
+        mActors.Shrink();
+    }
+    
     mux.unlock();
-    return state;
+    return;
 }
 
 
 unsigned int ActorSystem::GetNumberOfActors(void) {
-    mux.lock();
-    unsigned int value = mActors.GetObjectCount();
-    mux.unlock();
-    return value;
+    return mActors.GetObjectCount();
 }
 
 Actor* ActorSystem::GetActor(unsigned int index) {
@@ -109,29 +182,3 @@ void ActorSystem::SetActorUpdateDistance(float distance) {
     return;
 }
 
-
-
-//
-// Actor system thread
-//
-
-void actorThreadMain() {
-    
-    while (isActorThreadActive) {
-        
-        if (!doUpdate) {
-            std::this_thread::sleep_for( std::chrono::duration<float, std::milli>(1) );
-            continue;
-        }
-        
-        AI.Update();
-        
-        continue;
-    }
-    
-    std::this_thread::sleep_for( std::chrono::duration<float, std::milli>(1) );
-    Log.Write( " >> Shutting down on thread AI" );
-    
-    return;
-}
-
@@ -1,6 +1,7 @@
 #include <GameEngineFramework/ActorAI/ActorSystem.h>
 #include <GameEngineFramework/Logging/Logging.h>
 #include <GameEngineFramework/Math/Random.h>
+#include <GameEngineFramework/Profiler/profiler.h>
 
 extern Logger Log;
 extern ActorSystem AI;
@@ -20,12 +21,17 @@ extern int actorCounter;
 
 void ActorSystem::Update(void) {
     
-    glm::vec3 forward(0);
+    PROFILE_ZONE("Actor AI update");
     
-    int numberOfActors = mActors.Size();
+    glm::vec3 forward(0);
     
     mux.lock();
     
+    // Publish new actors and destruct destroyed actors
+    mActors.Synchronize();
+    
+    int numberOfActors = mActors.Size();
+    
     for (int i = 0; i < 80; i++) {
         
         if (actorCounter >= numberOfActors) {
@@ -79,67 +79,67 @@ std::string GeneticPresets::ExtractGenome(Actor* actorSource) {
 bool GeneticPresets::InjectGenome(Actor* actorSource, std::string genome) {
     
     // Inject actor idiosyncrasies into the genome
-    std::vector<std::string> traits = String.Explode( genome, ':' );
+    FrameVector<FrameString> traits = String.ExplodeFrame( genome, ':' );
     
-    actorSource->SetName(traits[0]);
+    actorSource->SetName( traits[0].c_str() );
     
-    actorSource->SetSpeed( String.ToFloat(traits[1]) );
-    actorSource->SetSpeedMultiplier( String.ToFloat(traits[2]) );
-    actorSource->SetSpeedYouth( String.ToFloat(traits[3]) );
+    actorSource->SetSpeed( String.ToFloat(traits[1].c_str()) );
+    actorSource->SetSpeedMultiplier( String.ToFloat(traits[2].c_str()) );
+    actorSource->SetSpeedYouth( String.ToFloat(traits[3].c_str()) );
     
-    actorSource->SetYouthScale( String.ToFloat(traits[4]) );
-    actorSource->SetAdultScale( String.ToFloat(traits[5]) );
+    actorSource->SetYouthScale( String.ToFloat(traits[4].c_str()) );
+    actorSource->SetAdultScale( String.ToFloat(traits[5].c_str()) );
     
     // Personality
-    actorSource->SetChanceToChangeDirection( String.ToFloat(traits[6]) );
-    actorSource->SetChanceToFocusOnActor( String.ToFloat(traits[7]) );
-    actorSource->SetChanceToStopWalking( String.ToFloat(traits[8]) );
-    actorSource->SetChanceToWalk( String.ToFloat(traits[9]) );
+    actorSource->SetChanceToChangeDirection( String.ToFloat(traits[6].c_str()) );
+    actorSource->SetChanceToFocusOnActor( String.ToFloat(traits[7].c_str()) );
+    actorSource->SetChanceToStopWalking( String.ToFloat(traits[8].c_str()) );
+    actorSource->SetChanceToWalk( String.ToFloat(traits[9].c_str()) );
     
-    actorSource->SetDistanceToWalk( String.ToFloat(traits[10]) );
-    actorSource->SetDistanceToAttack( String.ToFloat(traits[11]) );
-    actorSource->SetDistanceToFlee( String.ToFloat(traits[12]) );
-    actorSource->SetHeightPreferenceMin( String.ToFloat(traits[13]) );
-    actorSource->SetHeightPreferenceMax( String.ToFloat(traits[14]) );
+    actorSource->SetDistanceToWalk( String.ToFloat(traits[10].c_str()) );
+    actorSource->SetDistanceToAttack( String.ToFloat(traits[11].c_str()) );
+    actorSource->SetDistanceToFlee( String.ToFloat(traits[12].c_str()) );
+    actorSource->SetHeightPreferenceMin( String.ToFloat(traits[13].c_str()) );
+    actorSource->SetHeightPreferenceMax( String.ToFloat(traits[14].c_str()) );
     
     // Extract genes from the genome
-    std::vector<std::string> genes = String.Explode( genome, '#' );
+    FrameVector<FrameString> genes = String.ExplodeFrame( genome, '#' );
     
     unsigned int numberOfGenes = genes.size();
     for (unsigned int i=1; i < numberOfGenes; i++) {
         
         // Extract sub genes
-        std::vector<std::string> subGenes = String.Explode( (genes[i]), '|' );
-        std::vector<std::string> baseGene;
+        FrameVector<FrameString> subGenes = String.ExplodeFrame( genes[i], '|' );
+        FrameVector<FrameString> baseGene;
         
         Gene gene;
         
-        baseGene = String.Explode( subGenes[0], ',' );
-        gene.position.x = String.ToFloat( baseGene[0] );
-        gene.position.y = String.ToFloat( baseGene[1] );
-        gene.position.z = String.ToFloat( baseGene[2] );
+        baseGene = String.ExplodeFrame( subGenes[0], ',' );
+        gene.position.x = String.ToFloat( baseGene[0].c_str() );
+        gene.position.y = String.ToFloat( baseGene[1].c_str() );
+        gene.position.z = String.ToFloat( baseGene[2].c_str() );
         
-        baseGene = String.Explode( subGenes[1], ',' );
-        gene.rotation.x = String.ToFloat( baseGene[0] );
-        gene.rotation.y = String.ToFloat( baseGene[1] );
-        gene.rotation.z = String.ToFloat( baseGene[2] );
+        baseGene = String.ExplodeFrame( subGenes[1], ',' );
+        gene.rotation.x = String.ToFloat( baseGene[0].c_str() );
+        gene.rotation.y = String.ToFloat( baseGene[1].c_str() );
+        gene.rotation.z = String.ToFloat( baseGene[2].c_str() );
         
-        baseGene = String.Explode( subGenes[2], ',' );
-        gene.scale.x = String.ToFloat( baseGene[0] );
-        gene.scale.y = String.ToFloat( baseGene[1] );
-        gene.scale.z = String.ToFloat( baseGene[2] );
+        baseGene = String.ExplodeFrame( subGenes[2], ',' );
+        gene.scale.x = String.ToFloat( baseGene[0].c_str() );
+        gene.scale.y = String.ToFloat( baseGene[1].c_str() );
+        gene.scale.z = String.ToFloat( baseGene[2].c_str() );
         
-        baseGene = String.Explode( subGenes[3], ',' );
-        gene.offset.x = String.ToFloat( baseGene[0] );
-        gene.offset.y = String.ToFloat( baseGene[1] );
-        gene.offset.z = String.ToFloat( baseGene[2] );
+        baseGene = String.ExplodeFrame( subGenes[3], ',' );
+        gene.offset.x = String.ToFloat( baseGene[0].c_str() );
+        gene.offset.y = String.ToFloat( baseGene[1].c_str() );
+        gene.offset.z = String.ToFloat( baseGene[2].c_str() );
         
-        baseGene = String.Explode( subGenes[4], ',' );
-        gene.color.x = String.ToFloat( baseGene[0] );
-        gene.color.y = String.ToFloat( baseGene[1] );
-        gene.color.z = String.ToFloat( baseGene[2] );
+        baseGene = String.ExplodeFrame( subGenes[4], ',' );
+        gene.color.x = String.ToFloat( baseGene[0].c_str() );
+        gene.color.y = String.ToFloat( baseGene[1].c_str() );
+        gene.color.z = String.ToFloat( baseGene[2].c_str() );
         
-        baseGene = String.Explode( subGenes[5], ',' );
+        baseGene = String.ExplodeFrame( subGenes[5], ',' );
         if (baseGene[0] == "1") {gene.doInverseAnimation = 1;}
         if (baseGene[1] == "1") {gene.doAnimationCycle   = 1;}
         
@@ -1,4 +1,4 @@
-#include <GameEngineFramework/ActorAI/Genetics/Base.h>
+#include <GameEngineFramework/ActorAI/genetics/Base.h>
 
 #include <sstream>
 
@@ -1,5 +1,5 @@
-#include <GameEngineFramework/ActorAI/Genetics/Base.h>
-#include <GameEngineFramework/ActorAI/Genetics/Gene.h>
+#include <GameEngineFramework/ActorAI/genetics/Base.h>
+#include <GameEngineFramework/ActorAI/genetics/Gene.h>
 
 Gene::Gene() : 
     offset(0, 0, 0),
@@ -0,0 +1,115 @@
+#include <GameEngineFramework/Application/Platform.h>
+
+// Platform layer for systems without a window. There is no window, cursor
+// or render context, so the window calls only keep the tracked state.
+
+// Clipboard held by the process in place of the system clipboard
+static std::string clipboardText;
+
+
+PlatformLayer::PlatformLayer() : 
+    
+    windowHandle(NULL),
+    deviceContext(NULL),
+    renderContext(NULL),
+    
+    displayWidth(1024),
+    displayHeight(800),
+    
+    windowLeft(0),
+    windowTop(0),
+    windowRight(0),
+    windowBottom(0),
+    
+    isPaused(false),
+    isActive(true),
+    
+    mIsWindowRunning(false)
+{
+}
+
+void PlatformLayer::Pause(void) {
+    isPaused = !isPaused;
+    return;
+}
+
+void* PlatformLayer::CreateWindowHandle(std::string className, std::string windowName, void* parentHandle, void* hInstance) {
+    
+    isPaused = false;
+    isActive = true;
+    
+    mIsWindowRunning = true;
+    return NULL;
+}
+
+void PlatformLayer::DestroyWindowHandle(void) {
+    windowHandle = NULL;
+    
+    mIsWindowRunning = false;
+    return;
+}
+
+void PlatformLayer::SetWindowCenter(void) {
+    Viewport area = GetWindowArea();
+    
+    area.x = (displayWidth  / 2) - (area.w / 2);
+    area.y = (displayHeight / 2) - (area.h / 2);
+    
+    SetWindowPosition(area);
+    return;
+}
+
+void PlatformLayer::SetWindowCenterScale(float width, float height) {
+    Viewport newWindowSz;
+    newWindowSz.y = 0;
+    newWindowSz.x = 0;
+    newWindowSz.w = displayWidth  * width;
+    newWindowSz.h = displayHeight * height;
+    
+    SetWindowPosition(newWindowSz);
+    SetWindowCenter();
+    return;
+}
+
+void PlatformLayer::SetWindowPosition(Viewport windowSize) {
+    windowLeft   = windowSize.x;
+    windowTop    = windowSize.y;
+    windowRight  = windowSize.x + windowSize.w;
+    windowBottom = windowSize.y + windowSize.h;
+    return;
+}
+
+Viewport PlatformLayer::GetWindowArea(void) {
+    return Viewport(windowLeft, windowTop, windowRight - windowLeft, windowBottom - windowTop);
+}
+
+void PlatformLayer::HideWindowHandle(void) {
+    return;
+}
+
+void PlatformLayer::ShowWindowHandle(void) {
+    return;
+}
+
+void PlatformLayer::ShowMouseCursor(void) {
+    return;
+}
+
+void PlatformLayer::HideMouseCursor(void) {
+    return;
+}
+
+void PlatformLayer::SetClipboardText(std::string text) {
+    clipboardText = text;
+    return;
+}
+
+std::string PlatformLayer::GetClipboardText(void) {
+    return clipboardText;
+}
+
+GLenum PlatformLayer::SetRenderTarget(void) {
+    
+    // No window to create a render context for
+    return GLEW_ERROR_NO_GL_VERSION;
+}
@@ -0,0 +1,123 @@
+//
+// Microbenchmark runner
+//
+// Runs the engine microbenchmarks without a window or a render context
+// and prints the timings of each. The results can be written as a JSON
+// document to track performance across releases.
+//
+// Usage: benchmarks [--samples n] [--warmup n] [--filter text] [--json file]
+
+#include <GameEngineFramework/Application/main.h>
+
+#include "../../benchmarks/framework.h"
+
+#include <iostream>
+#include <cstdlib>
+
+
+static void PrintUsage(void) {
+    std::cout << "Usage: benchmarks [options]" << std::endl;
+    std::cout << "  --samples n     Number of timed samples per benchmark (default 50)" << std::endl;
+    std::cout << "  --warmup n      Number of samples discarded before timing (default 5)" << std::endl;
+    std::cout << "  --filter text   Only run the benchmarks whose name contains the text" << std::endl;
+    std::cout << "  --json file     Write the results to a JSON file" << std::endl;
+    return;
+}
+
+
+int main(int argc, char* argv[]) {
+    
+    BenchmarkFramework benchmarkFramework;
+    
+    std::string jsonFilename;
+    
+    for (int i=1; i < argc; i++) {
+        
+        std::string option = argv[i];
+        
+        if ((option == "--help") | (option == "-h")) {
+            PrintUsage();
+            return 0;
+        }
+        
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for " << option << std::endl;
+            return 1;
+        }
+        
+        std::string value = argv[++i];
+        
+        if (option == "--samples") {benchmarkFramework.numberOfSamples       = std::strtoul(value.c_str(), nullptr, 10); continue;}
+        if (option == "--warmup")  {benchmarkFramework.numberOfWarmupSamples = std::strtoul(value.c_str(), nullptr, 10); continue;}
+        if (option == "--filter")  {benchmarkFramework.filter = value; continue;}
+        if (option == "--json")    {jsonFilename = value; continue;}
+        
+        std::cerr << "Unknown option " << option << std::endl;
+        PrintUsage();
+        return 1;
+    }
+    
+    if (benchmarkFramework.numberOfSamples == 0) {
+        std::cerr << "The number of samples must be above zero" << std::endl;
+        return 1;
+    }
+    
+    Log.Clear();
+    
+#ifdef TIMER_TIME_STAMP_COUNTER
+    Clock::EnableTSC();
+#endif
+    
+    // Same seed for every run
+    Random.Seed(100);
+    
+    // Nothing is handed to the graphics driver
+    Renderer.isHeadless = true;
+    
+    
+    //
+    // Initiate engine sub systems
+    //
+    
+    Resources.Initiate();
+    
+    AI.Initiate();
+    
+    Physics.Initiate();
+    
+    Engine.Initiate();
+    
+    
+    benchmarkFramework.AddBenchmark( &BenchmarkFramework::BenchmarkPoolAllocator );
+    benchmarkFramework.AddBenchmark( &BenchmarkFramework::BenchmarkMesh );
+    benchmarkFramework.AddBenchmark( &BenchmarkFramework::BenchmarkHeightField );
+    benchmarkFramework.AddBenchmark( &BenchmarkFramework::BenchmarkRenderPasses );
+    benchmarkFramework.AddBenchmark( &BenchmarkFramework::BenchmarkActorSystem );
+    benchmarkFramework.AddBenchmark( &BenchmarkFramework::BenchmarkGenetics );
+    benchmarkFramework.AddBenchmark( &BenchmarkFramework::BenchmarkString );
+    
+    benchmarkFramework.Initiate();
+    
+    benchmarkFramework.RunBenchmarkSuite();
+    
+    benchmarkFramework.Complete();
+    
+    int result = 0;
+    
+    if ((!jsonFilename.empty()) && (!benchmarkFramework.WriteJSON(jsonFilename))) {
+        std::cerr << "Cannot write " << jsonFilename << std::endl;
+        result = 1;
+    }
+    
+    
+    // Shutdown engine & sub systems
+    Engine.Shutdown();
+    
+    Physics.Shutdown();
+    
+    AI.Shutdown();
+    
+    Resources.DestroyAssets();
+    
+    return result;
+}
@@ -0,0 +1,340 @@
+//
+// Headless simulation runner
+//
+// Drives the simulation without a window or a render context on a fixed
+// timestep. Every tick runs the application, scripts, engine, actor AI and
+// physics once with the same time step, so runs with the same seed and
+// camera path step through the same states. Intended for measuring the
+// simulation throughput on build machines.
+//
+// Usage: headless [--ticks n] [--rate hz] [--seed n] [--camera-path file] [--csv file] [--trace file]
+//
+// A camera path file holds one key frame per line as
+//   tick  x y z  [yaw pitch]
+// Positions between key frames are interpolated. Lines starting with # are skipped.
+
+#include <GameEngineFramework/Application/main.h>
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <cstdlib>
+
+#define HEADLESS_DEFAULT_TICKS  3600
+
+
+struct CameraKeyFrame {
+    
+    unsigned int tick;
+    
+    glm::vec3 position;
+    
+    glm::vec2 lookAngle;
+    
+    bool hasLookAngle;
+    
+};
+
+
+static void PrintUsage(void) {
+    std::cout << "Usage: headless [options]" << std::endl;
+    std::cout << "  --ticks n            Number of fixed updates to run (default " << HEADLESS_DEFAULT_TICKS << ")" << std::endl;
+    std::cout << "  --rate hz            Fixed updates per simulated second (default " << TICK_UPDATES_PER_SECOND << ")" << std::endl;
+    std::cout << "  --seed n             Seed for the random number generator" << std::endl;
+    std::cout << "  --camera-path file   Move the camera along the key frames in the file" << std::endl;
+    std::cout << "  --csv file           Write the tick time percentiles to a CSV file" << std::endl;
+    std::cout << "  --trace file         Record the profiler zones and write them as a trace" << std::endl;
+    return;
+}
+
+static bool LoadCameraPath(std::string filename, std::vector<CameraKeyFrame>& path) {
+    
+    std::ifstream file(filename);
+    
+    if (!file.is_open()) 
+        return false;
+        
+    std::string line;
+    while (std::getline(file, line)) {
+        
+        if ((line.empty()) | (line[0] == '#')) 
+            continue;
+            
+        std::stringstream stream(line);
+        
+        CameraKeyFrame keyFrame;
+        
+        if (!(stream >> keyFrame.tick >> keyFrame.position.x >> keyFrame.position.y >> keyFrame.position.z)) 
+            continue;
+            
+        keyFrame.hasLookAngle = (bool)(stream >> keyFrame.lookAngle.x >> keyFrame.lookAngle.y);
+        
+        path.push_back(keyFrame);
+    }
+    
+    std::sort(path.begin(), path.end(), [](const CameraKeyFrame& a, const CameraKeyFrame& b) {
+        return a.tick < b.tick;
+    });
+    
+    return !path.empty();
+}
+
+static void ApplyCameraPath(std::vector<CameraKeyFrame>& path, unsigned int tick) {
+    
+    if ((path.empty()) | (Engine.sceneMain == nullptr)) 
+        return;
+        
+    Camera* camera = Engine.sceneMain->camera;
+    
+    // Find the key frames on either side of the tick
+    unsigned int next = 0;
+    while ((next < path.size()) && (path[next].tick <= tick)) 
+        next++;
+        
+    CameraKeyFrame& from = path[ (next == 0) ? 0 : next - 1 ];
+    CameraKeyFrame& to   = path[ (next == path.size()) ? path.size() - 1 : next ];
+    
+    float blend = 0.0f;
+    if (to.tick > from.tick) 
+        blend = (float)(tick - from.tick) / (float)(to.tick - from.tick);
+        
+    if (blend < 0.0f) blend = 0.0f;
+    if (blend > 1.0f) blend = 1.0f;
+    
+    glm::vec3 position = glm::mix(from.position, to.position, blend);
+    
+    if (Engine.cameraController != nullptr) {
+        Engine.cameraController->SetPosition(position);
+    } else if (camera != nullptr) {
+        camera->transform.position = position;
+    }
+    
+    if ((camera != nullptr) & from.hasLookAngle & to.hasLookAngle) 
+        camera->mouseLookAngle = glm::mix(from.lookAngle, to.lookAngle, blend);
+        
+    return;
+}
+
+static void PrintChannel(ProfilerChannel channel) {
+    
+    ProfilerHistogram& histogram = Profiler.GetHistogram(channel);
+    
+    if (histogram.GetNumberOfSamples() == 0) 
+        return;
+        
+    std::cout << "  " << Profiler.GetChannelName(channel)
+              << "  mean " << histogram.GetMean()
+              << "  p50 "  << histogram.GetPercentile(50.0f)
+              << "  p95 "  << histogram.GetPercentile(95.0f)
+              << "  p99 "  << histogram.GetPercentile(99.0f)
+              << "  max "  << histogram.GetMax() << " ms" << std::endl;
+    return;
+}
+
+
+int main(int argc, char* argv[]) {
+    
+    unsigned int numberOfTicks = HEADLESS_DEFAULT_TICKS;
+    unsigned int tickRate      = TICK_UPDATES_PER_SECOND;
+    
+    std::string cameraPathFilename;
+    std::string csvFilename;
+    std::string traceFilename;
+    
+    for (int i=1; i < argc; i++) {
+        
+        std::string option = argv[i];
+        
+        if ((option == "--help") | (option == "-h")) {
+            PrintUsage();
+            return 0;
+        }
+        
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for " << option << std::endl;
+            return 1;
+        }
+        
+        std::string value = argv[++i];
+        
+        if (option == "--ticks")       {numberOfTicks = std::strtoul(value.c_str(), nullptr, 10); continue;}
+        if (option == "--rate")        {tickRate      = std::strtoul(value.c_str(), nullptr, 10); continue;}
+        if (option == "--seed")        {Random.Seed( std::atoi(value.c_str()) ); continue;}
+        if (option == "--camera-path") {cameraPathFilename = value; continue;}
+        if (option == "--csv")         {csvFilename = value; continue;}
+        if (option == "--trace")       {traceFilename = value; continue;}
+        
+        std::cerr << "Unknown option " << option << std::endl;
+        PrintUsage();
+        return 1;
+    }
+    
+    if (tickRate == 0) {
+        std::cerr << "The update rate must be above zero" << std::endl;
+        return 1;
+    }
+    
+    std::vector<CameraKeyFrame> cameraPath;
+    
+    if ((!cameraPathFilename.empty()) && (!LoadCameraPath(cameraPathFilename, cameraPath))) {
+        std::cerr << "Cannot read a camera path from " << cameraPathFilename << std::endl;
+        return 1;
+    }
+    
+    Log.Clear();
+    
+#ifdef TIMER_TIME_STAMP_COUNTER
+    Clock::EnableTSC();
+#endif
+    
+    // Nothing is handed to the graphics driver
+    Renderer.isHeadless = true;
+    
+    Renderer.displaySize.x = Platform.displayWidth;
+    Renderer.displaySize.y = Platform.displayHeight;
+    Renderer.displayCenter.x = Renderer.displaySize.x / 2;
+    Renderer.displayCenter.y = Renderer.displaySize.y / 2;
+    
+    Renderer.SetViewport(0, 0, Platform.displayWidth, Platform.displayHeight);
+    
+    
+    //
+    // Initiate engine sub systems
+    //
+    
+    Resources.Initiate();
+    
+    Log.WriteLn(); // For event log layout
+    
+    AI.Initiate();
+    
+    Audio.Initiate();
+    
+    Physics.Initiate();
+    
+    Engine.Initiate();
+    
+    Log.WriteLn();
+    Log.Write("<MainScene>");
+    
+    Start();
+    
+    // The camera follows the path rather than the mouse
+    if ((Engine.sceneMain != nullptr) && (Engine.sceneMain->camera != nullptr)) 
+        Engine.sceneMain->camera->DisableMouseLook();
+        
+    // Keep every tick in the statistics
+    Profiler.SetHistogramWindow(numberOfTicks);
+    
+    if (!traceFilename.empty()) 
+        Profiler.EnableCapture();
+        
+    Profiler.SetThreadName("Main");
+    
+    float timeStep = 1.0f / tickRate;
+    
+    // Background ticks run at the same rate as the windowed runtime
+    unsigned int tickUpdateInterval = (unsigned int)(tickRate / 1.3f);
+    if (tickUpdateInterval == 0) 
+        tickUpdateInterval = 1;
+        
+        
+    //
+    // Simulation loop
+    //
+    
+    unsigned long long int runBegin = Profiler.GetTraceTime();
+    
+    for (unsigned int tick=0; (tick < numberOfTicks) & Platform.isActive; tick++) {
+        
+        Profiler.MarkFrame();
+        
+        unsigned long long int tickBegin = Profiler.GetTraceTime();
+        
+        // Release the temporaries allocated during the previous tick
+        FrameArena::GetThreadArena().Reset();
+        
+        ApplyCameraPath(cameraPath, tick);
+        
+        if ((tick % tickUpdateInterval) == 0) {
+            
+            PROFILE_ZONE("Tick update");
+            
+            TickUpdate();
+        }
+        
+        {
+            PROFILE_ZONE("Fixed update");
+            
+            unsigned long long int updateBegin = Profiler.GetTraceTime();
+            
+            Run();
+            
+            Scripting.Update();
+            
+            Engine.Update();
+            
+            Profiler.AddSample(ProfilerChannel::Engine, (Profiler.GetTraceTime() - updateBegin) / 1000000.0f);
+        }
+        
+        // Actors update on this thread so every run steps them in the same order
+        {
+            unsigned long long int updateBegin = Profiler.GetTraceTime();
+            
+            AI.Update();
+            
+            Profiler.AddSample(ProfilerChannel::ActorAI, (Profiler.GetTraceTime() - updateBegin) / 1000000.0f);
+        }
+        
+        {
+            PROFILE_ZONE("Physics");
+            
+            unsigned long long int updateBegin = Profiler.GetTraceTime();
+            
+            Physics.world->update( timeStep );
+            
+            Profiler.AddSample(ProfilerChannel::Physics, (Profiler.GetTraceTime() - updateBegin) / 1000000.0f);
+        }
+        
+        Profiler.AddSample(ProfilerChannel::Frame, (Profiler.GetTraceTime() - tickBegin) / 1000000.0f);
+        
+        continue;
+    }
+    
+    double runTime = (Profiler.GetTraceTime() - runBegin) / 1000000000.0;
+    
+    unsigned int numberOfTicksRun = Profiler.GetHistogram(ProfilerChannel::Frame).GetNumberOfSamples();
+    
+    std::cout << "Clock       " << ((Clock::GetSource() == Clock::Source::TSC) ? "time stamp counter" : "system") << ", " << Clock::MeasureReadCost() << " ns per read" << std::endl;
+    std::cout << "Ticks       " << numberOfTicksRun << std::endl;
+    std::cout << "Simulated   " << numberOfTicksRun * (double)timeStep << " s" << std::endl;
+    std::cout << "Wall time   " << runTime << " s" << std::endl;
+    if (runTime > 0.0) 
+        std::cout << "Throughput  " << numberOfTicksRun / runTime << " ticks/s" << std::endl;
+        
+    for (unsigned int i=0; i < PROFILER_NUMBER_OF_CHANNELS; i++) 
+        PrintChannel( (ProfilerChannel)i );
+        
+    if ((!csvFilename.empty()) && (!Profiler.WriteHistogramCSV(csvFilename))) 
+        std::cerr << "Cannot write " << csvFilename << std::endl;
+        
+    if ((!traceFilename.empty()) && (!Profiler.ExportTrace(traceFilename))) 
+        std::cerr << "Cannot write " << traceFilename << std::endl;
+        
+        
+    // Shutdown engine & sub systems
+    Shutdown();
+    
+    Engine.Shutdown();
+    
+    Physics.Shutdown();
+    
+    Audio.Shutdown();
+    
+    AI.Shutdown();
+    
+    Resources.DestroyAssets();
+    
+    return 0;
+}
@@ -15,6 +15,11 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
     
     Log.Clear();
     
+#ifdef TIMER_TIME_STAMP_COUNTER
+    if (Clock::EnableTSC()) 
+        Log.Write(" >> Clock reading the time stamp counter at " + Float.ToString( (float)Clock::MeasureReadCost() ) + " ns per read");
+#endif
+    
     Platform.SetRenderTarget();
     
     // Set the window handle and get the device context
@@ -75,6 +80,19 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
     
     testFrameWork.AddTest( &testFrameWork.TestPhysicsSystem );
     testFrameWork.AddTest( &testFrameWork.TestTransform );
+    testFrameWork.AddTest( &testFrameWork.TestPoolAllocator );
+    testFrameWork.AddTest( &testFrameWork.TestFrameArena );
+    testFrameWork.AddTest( &testFrameWork.TestJobSystem );
+    testFrameWork.AddTest( &testFrameWork.TestTransformBatch );
+    testFrameWork.AddTest( &testFrameWork.TestProfiler );
+    testFrameWork.AddTest( &testFrameWork.TestClock );
+    testFrameWork.AddTest( &testFrameWork.TestScheduler );
+    testFrameWork.AddTest( &testFrameWork.TestRenderQueueSort );
+    testFrameWork.AddTest( &testFrameWork.TestDrawListSort );
+    testFrameWork.AddTest( &testFrameWork.TestFrustum );
+    testFrameWork.AddTest( &testFrameWork.TestBoundingVolumeHierarchy );
+    testFrameWork.AddTest( &testFrameWork.TestSpatialGrid );
+    testFrameWork.AddTest( &testFrameWork.TestInstancing );
     
     testFrameWork.AddTest( &testFrameWork.TestSerializerSystem );
     
@@ -96,186 +114,147 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
     
     Start();
     
-    // Render timer
-    Time.SetRefreshRate(RENDER_FRAMES_PER_SECOND);
-    Time.Update();
-    
-    // Physics timer
-    PhysicsTime.SetRefreshRate(PHYSICS_UPDATES_PER_SECOND);
-    PhysicsTime.Update();
-    
-    // Fixed rate update timer
-    Timer fixedTimer;
-    double fixedUpdateTimeout = 1000.0 / TICK_UPDATES_PER_SECOND;
-    double fixedAccumulator=0;
-    double fixedUpdateMax = fixedUpdateTimeout * 100;
-    fixedTimer.Update();
-    
-    // Tick update timer
-    Timer tickTimer;
-    double tickUpdateTimeout = 1000.0f / 1.3f;
-    double tickAccumulator=0;
-    double tickUpdateMax = tickUpdateTimeout * 100;
-    tickTimer.Update();
-    AI.UpdateSendSignal();
-    
+    // Presented frame timer
+    Timer frameTimer;
+    frameTimer.Update();
     
     //
-    // Game loop
+    // Systems stepped at their own fixed rates
     //
     
-    while (Platform.isActive) {
+    Scheduler scheduler;
+    
+    // Tick update (background update)
+    AI.UpdateSendSignal();
+    
+    scheduler.AddSystem("Tick", 1.3, [](float timeStep) {
         
-        MSG messages;
-        while (PeekMessage(&messages, NULL, 0, 0, PM_REMOVE)) {
-            TranslateMessage(&messages);
-            DispatchMessage(&messages);
-        }
+        PROFILE_ZONE("Tick update");
         
-        // Reset mouse scroll wheel state
-        Input.mouseWheelDelta = 0;
+        AI.UpdateSendSignal();
         
-        // Update mouse position
-        POINT cursorPos;
-        GetCursorPos(&cursorPos);
-        Input.mouseX = cursorPos.x;
-        Input.mouseY = cursorPos.y;
+        TickUpdate();
         
-        //
-        // Tick update timer (background update)
-        //
+    }, 2);
+    
+    // Fixed rate update
+    unsigned int fixedUpdateIndex = scheduler.AddSystem("Fixed update", TICK_UPDATES_PER_SECOND, [wHndl](float timeStep) {
         
-        tickAccumulator = tickTimer.GetCurrentDelta();
+        PROFILE_ZONE("Fixed update");
         
-        if (tickAccumulator > tickUpdateMax) 
-            tickAccumulator = tickUpdateMax;
+        // --- Profiling ---
+        Profiler.Begin();
         
-        if (tickAccumulator >= tickUpdateTimeout) {
-            
-            tickTimer.Update();
-            
-            tickAccumulator -= tickUpdateTimeout;
-            
-            AI.UpdateSendSignal();
-            
-            // Call extra updates on accumulated time
-            for (int i=0; i < 2; i++) {
-                
-                TickUpdate();
-                
-                tickAccumulator -= tickUpdateTimeout;
-                
-                // Break if no more accumulated time
-                if (tickAccumulator < tickUpdateTimeout) 
-                    break;
-                
-                continue;
-            }
-        }
         
-        //
-        // Fixed rate update timer
-        //
+        Run();
         
-        fixedAccumulator = fixedTimer.GetCurrentDelta();
+        Scripting.Update();
         
-        if (fixedAccumulator > fixedUpdateMax) 
-            fixedAccumulator = fixedUpdateMax;
+        Engine.Update();
         
-        if (fixedAccumulator >= fixedUpdateTimeout) {
-            
-            fixedTimer.Update();
-            
-            // Call extra updates on accumulated time
-            for (int i=0; i < 2; i++) {
-                
-                // --- Profiling ---
-                if (Engine.CheckIsProfilerActive()) 
-                    Profiler.Begin();
-                
-                
-                Run();
-                
-                Scripting.Update();
-                
-                Engine.Update();
-                
-                Network.Update();
-                
-                // Update window area
-                RECT windowRect;
-                GetWindowRect(wHndl, &windowRect);
-                
-                Platform.windowLeft   =  windowRect.left;
-                Platform.windowTop    =  windowRect.top;
-                Platform.windowRight  = (windowRect.right  - windowRect.left);
-                Platform.windowBottom = (windowRect.bottom - windowRect.top);
-                
-                
-                // --- Profiling ---
-                if (Engine.CheckIsProfilerActive()) 
-                    Profiler.profileGameEngineUpdate = Profiler.Query();
-                
-                
-                fixedAccumulator -= fixedUpdateTimeout;
-                
-                // Break if no more accumulated time
-                if (fixedAccumulator < fixedUpdateTimeout) 
-                    break;
-                
-                continue;
-            }
-        }
+        Network.Update();
         
+        // Update window area
+        RECT windowRect;
+        GetWindowRect(wHndl, &windowRect);
         
+        Platform.windowLeft   =  windowRect.left;
+        Platform.windowTop    =  windowRect.top;
+        Platform.windowRight  = (windowRect.right  - windowRect.left);
+        Platform.windowBottom = (windowRect.bottom - windowRect.top);
         
-        //
-        // Render timer
-        //
         
-        if (Time.Update()) {
-            
-            // --- Profiling ---
-            if (Engine.CheckIsProfilerActive()) 
-                Profiler.Begin();
-            
-            
-            // Draw the current frame state
-            Renderer.RenderFrame();
-            
-            // Turn over the frame buffer
-            SwapBuffers( (HDC)Platform.deviceContext );
-            
-            
-            // --- Profiling ---
-            if (Engine.CheckIsProfilerActive()) 
-                Profiler.profileRenderSystem = Profiler.Query();
+        // --- Profiling ---
+        Profiler.profileGameEngineUpdate = Profiler.Query();
+        Profiler.AddSample(ProfilerChannel::Engine, Profiler.profileGameEngineUpdate);
+        
+    }, 2);
+    
+    // Physics world update with the length of a step in seconds
+    scheduler.AddSystem("Physics", PHYSICS_UPDATES_PER_SECOND, [](float timeStep) {
+        
+        PROFILE_ZONE("Physics");
+        
+        // --- Profiling ---
+        Profiler.Begin();
+        
+        {
+            PROFILE_ZONE("Physics world update");
             
+            Physics.world->update( timeStep );
         }
         
+        // Generate the physics debug meshes
+        Engine.UpdatePhysicsDebugRenderer();
         
-        //
-        // Physics timer
-        //
         
-        if (PhysicsTime.Update()) {
-            
-            // --- Profiling ---
-            if (Engine.CheckIsProfilerActive()) 
-                Profiler.Begin();
-            
-            Physics.world->update( PHYSICS_UPDATES_PER_SECOND );
-            
-            // Generate the physics debug meshes
-            Engine.UpdatePhysicsDebugRenderer();
-            
-            
-            // --- Profiling ---
-            if (Engine.CheckIsProfilerActive()) 
-                Profiler.profilePhysicsSystem = Profiler.Query();
-            
+        // --- Profiling ---
+        Profiler.profilePhysicsSystem = Profiler.Query();
+        Profiler.AddSample(ProfilerChannel::Physics, Profiler.profilePhysicsSystem);
+        
+    });
+    
+    // Render the frame state between the last two fixed updates.
+    // Frames which fell behind are skipped rather than drawn twice
+    scheduler.AddSystem("Render", RENDER_FRAMES_PER_SECOND, [&scheduler, &frameTimer, fixedUpdateIndex](float timeStep) {
+        
+        PROFILE_ZONE("Render");
+        
+        // Time between presented frames
+        Profiler.AddSample(ProfilerChannel::Frame, frameTimer.GetCurrentDelta());
+        frameTimer.Update();
+        
+        // --- Profiling ---
+        Profiler.Begin();
+        
+        
+        Renderer.SetInterpolationFactor( scheduler.GetInterpolationFactor(fixedUpdateIndex) );
+        
+        // Draw the current frame state
+        Renderer.RenderFrame();
+        
+        // Turn over the frame buffer
+        SwapBuffers( (HDC)Platform.deviceContext );
+        
+        
+        // --- Profiling ---
+        Profiler.profileRenderSystem = Profiler.Query();
+        Profiler.AddSample(ProfilerChannel::Renderer, Profiler.profileRenderSystem);
+        
+    }, 1);
+    
+    
+    //
+    // Game loop
+    //
+    
+    Profiler.SetThreadName("Main");
+    
+    while (Platform.isActive) {
+        
+        Profiler.MarkFrame();
+        
+        // Release the temporaries allocated during the previous frame
+        FrameArena::GetThreadArena().Reset();
+        
+        MSG messages;
+        while (PeekMessage(&messages, NULL, 0, 0, PM_REMOVE)) {
+            TranslateMessage(&messages);
+            DispatchMessage(&messages);
         }
         
+        // Reset mouse scroll wheel state
+        Input.mouseWheelDelta = 0;
+        
+        // Update mouse position
+        POINT cursorPos;
+        GetCursorPos(&cursorPos);
+        Input.mouseX = cursorPos.x;
+        Input.mouseY = cursorPos.y;
+        
+        // Run the systems which have come due
+        scheduler.Update();
+        
         
 #ifdef APPLICATION_ESCAPE_KEY_PAUSE
         if (Input.CheckKeyPressed(VK_ESCAPE)) {
@@ -292,8 +271,9 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
                 
                 Platform.HideMouseCursor();
                 
-                Time.Update();
-                PhysicsTime.Update();
+                // Drop the time spent paused
+                scheduler.Reset();
+                frameTimer.Update();
             }
             
         }
@@ -305,6 +285,14 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
     
     Log.WriteLn();
     
+    // Keep the zones recorded up to the end of the session
+    if (Profiler.CheckIsCapturing()) 
+        Profiler.ExportTrace("trace.json");
+    
+#ifdef PROFILER_HISTOGRAM_CSV
+    Profiler.WriteHistogramCSV(PROFILER_HISTOGRAM_CSV);
+#endif
+    
     // Shutdown engine & sub systems
     Shutdown();
     
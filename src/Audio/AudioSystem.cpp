@@ -12,10 +12,7 @@ extern Logger Log;
 extern NumberGeneration Random;
 
 
-// Audio thread
 bool isAudioDeviceActive = false;
-bool isAudioThreadActive = true;
-void AudioThreadMain(void);
 
 
 
@@ -23,11 +20,6 @@ void AudioThreadMain(void);
 
 void AudioSystem::Initiate(void) {
     
-    // Launch the audio thread
-    audioThread = new std::thread( AudioThreadMain );
-    
-    Log.Write( " >> Starting thread audio" );
-    
     mDevice = alcGetContextsDevice(mContext);
     
     if (!mDevice) 
@@ -205,10 +197,6 @@ void AudioSystem::Shutdown(void) {
     
     */
     
-    isAudioThreadActive = false;
-    
-    audioThread->join();
-    
     return;
 }
 
@@ -241,23 +229,4 @@ bool AudioSystem::CheckIsAudioEndpointActive(void) {
     return mIsDeviceActive;
 }
 
-//
-// Audio thread entry point
-//
-
-void AudioThreadMain(void) {
-    
-    while (isAudioThreadActive) {
-        
-        std::this_thread::sleep_for( std::chrono::duration<float, std::milli>(1) );
-        
-        continue;
-    }
-    
-    std::this_thread::sleep_for( std::chrono::duration<float, std::milli>(2) );
-    Log.Write(" >> Shutting down on thread audio");
-    
-    return;
-}
-
 
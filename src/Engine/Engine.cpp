@@ -19,6 +19,7 @@ ENGINE_API AudioPreset          Samples;
 ENGINE_API InputSystem          Input;
 ENGINE_API MathCore             Math;
 ENGINE_API ActorSystem          AI;
+ENGINE_API JobSystem            Jobs;
 
 ENGINE_API StringType           String;
 ENGINE_API FloatType            Float;
@@ -52,9 +53,19 @@ EngineSystemManager::EngineSystemManager(void) :
     mConsoleInputObject(nullptr),
     mConsolePanelObject(nullptr),
     
-    mDataStreamIndex(0),
-    mObjectIndex(0),
+    mGarbageBudget(GARBAGE_COLLECTION_BUDGET),
+    mGarbageCostEstimate(1.0f),
+    mRigidBodyRequests(0),
+    mRigidBodyDemand(0),
+    mFreeRigidBodyCapacity(GARBAGE_FREE_RIGID_BODIES_MIN),
+    
     mStreamSize(0),
+    mStreamCameraCell(0, 0, 0),
+    mHasStreamCameraCell(false),
+    mStreamMaxRenderDistance(0),
+    mIsStreamMaxRenderDistanceDirty(false),
+    
+    mIsTransformOrderDirty(true),
     
     usePhysicsDebugRenderer(false),
     debugMesh(nullptr),
@@ -578,13 +589,161 @@ GameObject* EngineSystemManager::GetGameObject(unsigned int index) {
     return nullptr;
 }
 
+// List allocator statistics or dump them to a CSV file
+static void FuncPools(std::vector<std::string> args) {
+    
+    AllocatorRegistry& registry = AllocatorRegistry::Get();
+    
+    if (args[0] == "csv") {
+        
+        std::string filename = "allocators.csv";
+        if ((args.size() > 1) && (args[1] != "")) 
+            filename = args[1];
+        
+        if (registry.WriteCSV(filename)) {
+            
+            Engine.Print("Allocators written to " + filename);
+            
+            return;
+        }
+        
+        Engine.Print("Error writing " + filename);
+        
+        return;
+    }
+    
+    std::vector<AllocatorStatistics> statisticsList = registry.GetStatistics();
+    
+    for (unsigned int i=0; i < statisticsList.size(); i++) {
+        
+        AllocatorStatistics& statistics = statisticsList[i];
+        
+        // Filter by type name
+        if ((args[0] != "") && (statistics.name.find(args[0]) == std::string::npos)) 
+            continue;
+        
+        Engine.Print(statistics.name + 
+                     "  " + Uint.ToString( statistics.liveCount ) + "/" + Uint.ToString( statistics.capacity ) + 
+                     "  slabs " + Uint.ToString( statistics.slabCount ) + 
+                     "  peak " + Uint.ToString( statistics.highWaterMark ) + 
+                     "  waste " + Uint.ToString( (unsigned int)(statistics.bytesWasted / 1024) ) + "kb" + 
+                     "  +" + Float.ToString( statistics.createRate ) + "/s" + 
+                     "  -" + Float.ToString( statistics.destroyRate ) + "/s");
+    }
+    
+    return;
+}
+
+// Start recording profiler zones or stop and write them to a trace file
+static void FuncTrace(std::vector<std::string> args) {
+    
+    if (args[0] == "start") {
+        
+        Profiler.ClearTrace();
+        Profiler.EnableCapture();
+        
+        Engine.Print("Trace capture started");
+        
+        return;
+    }
+    
+    if (args[0] == "stop") {
+        
+        Profiler.DisableCapture();
+        
+        std::string filename = "trace.json";
+        if ((args.size() > 1) && (args[1] != "")) 
+            filename = args[1];
+        
+        if (Profiler.ExportTrace(filename)) {
+            
+            Engine.Print("Trace written to " + filename);
+            
+            return;
+        }
+        
+        Engine.Print("Error writing " + filename);
+        
+        return;
+    }
+    
+    Engine.Print("trace start / trace stop [file]");
+    
+    return;
+}
+
+// List the frame time percentiles of each channel, change their window or write them to a CSV file
+static void FuncFrameTimes(std::vector<std::string> args) {
+    
+    if (args[0] == "csv") {
+        
+        std::string filename = "frametimes.csv";
+        if ((args.size() > 1) && (args[1] != "")) 
+            filename = args[1];
+        
+        if (Profiler.WriteHistogramCSV(filename)) {
+            
+            Engine.Print("Frame times written to " + filename);
+            
+            return;
+        }
+        
+        Engine.Print("Error writing " + filename);
+        
+        return;
+    }
+    
+    if (args[0] == "window") {
+        
+        if ((args.size() < 2) || (String.ToUint(args[1]) == 0)) {
+            
+            Engine.Print("frametimes window [samples]");
+            
+            return;
+        }
+        
+        Profiler.SetHistogramWindow( String.ToUint(args[1]) );
+        
+        Engine.Print("Frame time window " + args[1] + " samples");
+        
+        return;
+    }
+    
+    for (unsigned int i=0; i < PROFILER_NUMBER_OF_CHANNELS; i++) {
+        
+        ProfilerHistogram& histogram = Profiler.GetHistogram( (ProfilerChannel)i );
+        
+        Engine.Print(Profiler.GetChannelName( (ProfilerChannel)i ) + 
+                     "  p50 " + Float.ToString( histogram.GetPercentile(50.0f) ) + 
+                     "  p95 " + Float.ToString( histogram.GetPercentile(95.0f) ) + 
+                     "  p99 " + Float.ToString( histogram.GetPercentile(99.0f) ) + 
+                     "  max " + Float.ToString( histogram.GetMax() ) + 
+                     "  (" + Uint.ToString( histogram.GetNumberOfSamples() ) + ")");
+    }
+    
+    return;
+}
+
 void EngineSystemManager::Initiate() {
     
+    // Start the worker threads for the component update passes
+    Jobs.Initiate();
+    
+    // Allocator telemetry
+    ConsoleRegisterCommand("pools", FuncPools);
+    
+    // Profiler trace capture
+    ConsoleRegisterCommand("trace", FuncTrace);
+    
+    // Frame time statistics
+    ConsoleRegisterCommand("frametimes", FuncFrameTimes);
+    
     // Load default shaders
     shaders.texture       = Resources.CreateShaderFromTag("texture");
     shaders.textureUnlit  = Resources.CreateShaderFromTag("textureUnlit");
     shaders.color         = Resources.CreateShaderFromTag("color");
     shaders.colorUnlit    = Resources.CreateShaderFromTag("colorUnlit");
+    shaders.colorInstanced = Resources.CreateShaderFromTag("colorInstanced");
     shaders.UI            = Resources.CreateShaderFromTag("UI");
     shaders.shadowCaster  = Resources.CreateShaderFromTag("shadowCaster");
     shaders.sky           = Resources.CreateShaderFromTag("sky");
@@ -627,6 +786,7 @@ void EngineSystemManager::Initiate() {
     Renderer.shaders.textureUnlit = shaders.textureUnlit;
     Renderer.shaders.color        = shaders.color;
     Renderer.shaders.colorUnlit   = shaders.colorUnlit;
+    Renderer.shaders.colorInstanced = shaders.colorInstanced;
     Renderer.shaders.UI           = shaders.UI;
     Renderer.shaders.shadowCaster = shaders.shadowCaster;
     Renderer.shaders.sky          = shaders.sky;
@@ -656,7 +816,7 @@ void EngineSystemManager::Initiate() {
     mConsolePanelObject = CreateOverlayPanelRenderer(200, -8, 5000, 10, "panel_blue");
     MeshRenderer* panelRenderer = mConsolePanelObject->GetComponent<MeshRenderer>();
     sceneOverlay->AddMeshRendererToSceneRoot( panelRenderer, RENDER_QUEUE_BACKGROUND );
-    mConsolePanelObject->isActive = false;
+    mConsolePanelObject->SetActive( false );
     
     float alphaBlend = 0.87;
     panelRenderer->material->ambient.g = alphaBlend;
@@ -724,6 +884,8 @@ void EngineSystemManager::Initiate() {
 
 void EngineSystemManager::Shutdown(void) {
     
+    CollectAllGarbage();
+    
     Destroy<Scene>(sceneMain);
     
     Destroy<Scene>(sceneOverlay);
@@ -732,9 +894,12 @@ void EngineSystemManager::Shutdown(void) {
     Renderer.DestroyShader(shaders.textureUnlit);
     Renderer.DestroyShader(shaders.color);
     Renderer.DestroyShader(shaders.colorUnlit);
+    Renderer.DestroyShader(shaders.colorInstanced);
     Renderer.DestroyShader(shaders.UI);
     Renderer.DestroyShader(shaders.shadowCaster);
     
+    Jobs.Shutdown();
+    
     return;
 }
 
@@ -803,12 +968,17 @@ void EngineSystemManager::UpdatePhysicsDebugRenderer(void) {
     //
     
     unsigned int numberOfLines = debugRenderer.getNbLines();
-    rp3d::Array<rp3d::DebugRenderer::DebugLine> lineArray = debugRenderer.getLines();
+    const rp3d::Array<rp3d::DebugRenderer::DebugLine>& lineArray = debugRenderer.getLines();
+    
+    // Temporary buffers are drawn from the frame arena
+    FrameVector<Vertex> lineVertices;
+    FrameVector<Index>  lineIndices;
+    lineVertices.reserve(numberOfLines * 2);
+    lineIndices.reserve(numberOfLines * 2);
     
-    SubMesh subMeshLines;
     for (unsigned int i=0; i < numberOfLines; i++) {
         
-        rp3d::DebugRenderer::DebugLine line = lineArray[i];
+        const rp3d::DebugRenderer::DebugLine& line = lineArray[i];
         
         Vertex vertA;
         vertA.x = line.point1.x;
@@ -832,20 +1002,17 @@ void EngineSystemManager::UpdatePhysicsDebugRenderer(void) {
         vertB.ny = 1;
         vertB.nz = 0;
         
-        subMeshLines.vertexBuffer.push_back(vertA);
-        subMeshLines.vertexBuffer.push_back(vertB);
+        lineVertices.push_back(vertA);
+        lineVertices.push_back(vertB);
         
-        subMeshLines.indexBuffer.push_back( (i * 2) + 0 );
-        subMeshLines.indexBuffer.push_back( (i * 2) + 1 );
+        lineIndices.push_back( (i * 2) + 0 );
+        lineIndices.push_back( (i * 2) + 1 );
         
     }
     
-    subMeshLines.indexCount  = numberOfLines * 2;
-    subMeshLines.vertexCount = numberOfLines * 2;
-    
     debugLines->RemoveSubMesh(0);
     
-    debugLines->AddSubMesh(0, 0, 0, subMeshLines, true);
+    debugLines->AddSubMesh(0, 0, 0, lineVertices.data(), lineVertices.size(), lineIndices.data(), lineIndices.size(), true);
     
     
     //
@@ -853,12 +1020,16 @@ void EngineSystemManager::UpdatePhysicsDebugRenderer(void) {
     //
     
     unsigned int numberOfTriangles = debugRenderer.getNbTriangles();
-    rp3d::Array<rp3d::DebugRenderer::DebugTriangle> triangleArray = debugRenderer.getTriangles();
+    const rp3d::Array<rp3d::DebugRenderer::DebugTriangle>& triangleArray = debugRenderer.getTriangles();
+    
+    FrameVector<Vertex> triangleVertices;
+    FrameVector<Index>  triangleIndices;
+    triangleVertices.reserve(numberOfTriangles * 3);
+    triangleIndices.reserve(numberOfTriangles * 3);
     
-    SubMesh subMeshTriangles;
     for (unsigned int i=0; i < numberOfTriangles; i++) {
         
-        rp3d::DebugRenderer::DebugTriangle triangle = triangleArray[i];
+        const rp3d::DebugRenderer::DebugTriangle& triangle = triangleArray[i];
         
         Vertex vertA;
         vertA.x = triangle.point1.x;
@@ -899,22 +1070,19 @@ void EngineSystemManager::UpdatePhysicsDebugRenderer(void) {
         vertC.u = 1;
         vertC.v = 1;
         
-        subMeshTriangles.vertexBuffer.push_back(vertA);
-        subMeshTriangles.vertexBuffer.push_back(vertB);
-        subMeshTriangles.vertexBuffer.push_back(vertC);
+        triangleVertices.push_back(vertA);
+        triangleVertices.push_back(vertB);
+        triangleVertices.push_back(vertC);
         
-        subMeshTriangles.indexBuffer.push_back( (i * 3) + 0 );
-        subMeshTriangles.indexBuffer.push_back( (i * 3) + 1 );
-        subMeshTriangles.indexBuffer.push_back( (i * 3) + 2 );
+        triangleIndices.push_back( (i * 3) + 0 );
+        triangleIndices.push_back( (i * 3) + 1 );
+        triangleIndices.push_back( (i * 3) + 2 );
         
     }
     
-    subMeshTriangles.indexCount  = numberOfTriangles * 3;
-    subMeshTriangles.vertexCount = numberOfTriangles * 3;
-    
     debugMesh->RemoveSubMesh(0);
     
-    debugMesh->AddSubMesh(0, 0, 0, subMeshTriangles, true);
+    debugMesh->AddSubMesh(0, 0, 0, triangleVertices.data(), triangleVertices.size(), triangleIndices.data(), triangleIndices.size(), true);
     
     return;
 }
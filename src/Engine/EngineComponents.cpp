@@ -50,12 +50,15 @@ Component* EngineSystemManager::CreateComponent(ComponentType type) {
         }
         case COMPONENT_TYPE_RIGID_BODY: {
             
+            // Demand sets how many clean rigid bodies are kept
+            mRigidBodyRequests++;
+            
             // Check the rigid body free list for an old rigid body
             if (mFreeRigidBodies.size() > 0) {
                 
-                RigidBody* rigidBody = mFreeRigidBodies[ 0 ];
+                RigidBody* rigidBody = mFreeRigidBodies[ mFreeRigidBodies.size() - 1 ];
                 
-                mFreeRigidBodies.erase( mFreeRigidBodies.begin() );
+                mFreeRigidBodies.pop_back();
                 
                 Component* component = mComponents.Create();
                 
@@ -126,7 +129,7 @@ bool EngineSystemManager::DestroyComponent(Component* componentPtr) {
                 MeshRenderer* renderer = actorPtr->mGeneticRenderers[i];
                 
                 // Remove renderer from the render queue
-                sceneMain->RemoveMeshRendererFromSceneRoot( renderer, RENDER_QUEUE_BACKGROUND );
+                sceneMain->RemoveMeshRendererFromSceneRoot( renderer, RENDER_QUEUE_GEOMETRY );
                 
                 Destroy<MeshRenderer>( renderer );
             }
@@ -7,10 +7,10 @@
 void EngineSystemManager::EnableConsole(void) {
     
     mIsConsoleEnabled = true;
-    mConsoleInputObject->isActive = true;
+    mConsoleInputObject->SetActive( true );
     
     if (mShowConsoleBackPanel) 
-        mConsolePanelObject->isActive = true;
+        mConsolePanelObject->SetActive( true );
     
     return;
 }
@@ -18,8 +18,8 @@ void EngineSystemManager::EnableConsole(void) {
 void EngineSystemManager::DisableConsole(void) {
     
     mIsConsoleEnabled = false;
-    mConsoleInputObject->isActive = false;
-    mConsolePanelObject->isActive = false;
+    mConsoleInputObject->SetActive( false );
+    mConsolePanelObject->SetActive( false );
     
     return;
 }
@@ -40,7 +40,7 @@ void EngineSystemManager::EnableProfiler(void) {
     mIsProfilerEnabled = true;
     
     //for (uint8_t i=0; i < PROFILER_NUMBER_OF_ELEMENTS; i++) 
-    //    mProfilerTextObjects[i]->isActive = true;
+    //    mProfilerTextObjects[i]->SetActive( true );
     
     return;
 }
@@ -50,7 +50,7 @@ void EngineSystemManager::DisableProfiler(void) {
     mIsProfilerEnabled = false;
     
     //for (uint8_t i=0; i < PROFILER_NUMBER_OF_ELEMENTS; i++) 
-    //    mProfilerTextObjects[i]->isActive = false;
+    //    mProfilerTextObjects[i]->SetActive( false );
     
     return;
 }
@@ -122,7 +122,7 @@ void EngineSystemManager::Print(std::string text, unsigned int fadeTimer) {
     
     // Shift up game object is active states
     for (unsigned int i=CONSOLE_NUMBER_OF_ELEMENTS - 1; i > 0; i--) 
-        mConsoleTextObjects[i]->isActive = mConsoleTextObjects[i - 1]->isActive;
+        mConsoleTextObjects[i]->SetActive( mConsoleTextObjects[i - 1]->GetActive() );
     
     // Shift up transparency levels
     for (unsigned int i=CONSOLE_NUMBER_OF_ELEMENTS - 1; i > 0; i--) {
@@ -140,7 +140,7 @@ void EngineSystemManager::Print(std::string text, unsigned int fadeTimer) {
     
     // Submit new line of text after the up shift
     mConsoleText[0]->text = text;
-    mConsoleTextObjects[0]->isActive = true;
+    mConsoleTextObjects[0]->SetActive( true );
     
     if (fadeTimer == 0) {
         
@@ -177,7 +177,7 @@ void EngineSystemManager::UpdateConsole(void) {
             }
             
             if (mConsoleTimers[i] < 1) 
-                mConsoleTextObjects[i]->isActive = false;
+                mConsoleTextObjects[i]->SetActive( false );
             
         }
         
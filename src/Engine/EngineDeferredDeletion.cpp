@@ -6,86 +6,264 @@
 
 void EngineSystemManager::ProcessDeferredDeletion(void) {
     
-    // Purge game objects
-    int numberOfGameObjects = mGarbageGameObjects.size();
-    if (numberOfGameObjects > 0) {
-        
-        unsigned int objectsPerCycle = glm::max(1, (numberOfGameObjects / 16));
-        
-        for (unsigned int i=0; i < objectsPerCycle; i++) {
-            
-            GameObject* objectPtr = mGarbageGameObjects[ i ];
-            
-            DestroyGameObject( objectPtr );
-            
-            mGameObjects.Destroy( objectPtr );
-            
-            continue;
-        }
-        
-    }
+    mGarbageTimer.Update();
     
+    mGarbageStats.objectsDestroyed     = 0;
+    mGarbageStats.rigidBodiesRecycled  = 0;
+    mGarbageStats.rigidBodiesDestroyed = 0;
     
-    // Purge rigid bodies
-    if (mGarbageRigidBodies.size() > 0) {
-        
-        rp3d::RigidBody* rigidBody = mGarbageRigidBodies[ mGarbageRigidBodies.size() - 1 ];
+    float budget = (float)mGarbageBudget;
+    
+    // Purge game objects in batches sized to fit the remaining time. At least
+    // one object is purged each update so the backlog always drains
+    while (mGarbageGameObjects.size() > 0) {
         
-        mGarbageRigidBodies.erase( mGarbageRigidBodies.end() - 1 );
+        float elapsed = mGarbageTimer.GetCurrentDelta() * 1000.0f;
         
-        //
-        // Cleanse the rigid body before handing it back to the user
-        //
+        if ((elapsed >= budget) & (mGarbageStats.objectsDestroyed > 0)) 
+            break;
+            
+        float costAllowed = (budget - elapsed) / mGarbageCostEstimate;
         
-        rigidBody->setUserData(nullptr);
+        unsigned int numberOfGarbage = mGarbageGameObjects.size();
+        unsigned int batchSize = 0;
+        unsigned int batchCost = 0;
         
-        // Clear colliders
-        unsigned int numberOfColliders = rigidBody->getNbColliders();
-        for (unsigned int i=0; i < numberOfColliders; i++) {
-            rp3d::Collider* collider = rigidBody->getCollider( i );
-            rigidBody->removeCollider( collider );
+        // Objects are taken from the back so the list never shifts
+        while ((batchSize < numberOfGarbage) & (batchSize < GARBAGE_COLLECTION_BATCH_MAX)) {
+            
+            unsigned int cost = GetGarbageCost( mGarbageGameObjects[numberOfGarbage - batchSize - 1] );
+            
+            if ((batchSize > 0) & ((float)(batchCost + cost) > costAllowed)) 
+                break;
+                
+            batchCost += cost;
+            batchSize++;
         }
         
-        // Reset physics
-        rigidBody->resetForce();
-        rigidBody->resetTorque();
+        PurgeGameObjects( &mGarbageGameObjects[numberOfGarbage - batchSize], batchSize );
         
-        // Defaults
-        rigidBody->setMass(1);
+        mGarbageGameObjects.resize( numberOfGarbage - batchSize );
         
-        rigidBody->setLinearDamping( 0 );
-        rigidBody->setAngularDamping( 0 );
+        mGarbageStats.objectsDestroyed += batchSize;
         
-        rigidBody->setLinearLockAxisFactor( rp3d::Vector3(0, 0, 0) );
-        rigidBody->setAngularLockAxisFactor( rp3d::Vector3(0, 0, 0) );
+        // Follow the measured cost so the next batch is sized to the objects being destroyed
+        float batchTime = (mGarbageTimer.GetCurrentDelta() * 1000.0f) - elapsed;
         
-        rigidBody->setLinearVelocity( rp3d::Vector3(0, 0, 0) );
+        mGarbageCostEstimate = glm::mix(mGarbageCostEstimate, batchTime / (float)batchCost, 0.25f);
         
-        rigidBody->setLocalCenterOfMass( rp3d::Vector3(0, 0, 0) );
+        if (mGarbageCostEstimate < 0.001f) 
+            mGarbageCostEstimate = 0.001f;
         
-        rigidBody->setType( rp3d::BodyType::DYNAMIC );
-        
-        rigidBody->setIsAllowedToSleep(true);
-        rigidBody->setIsActive(false);
+        continue;
+    }
+    
+    // Keep enough clean rigid bodies to cover the largest recent burst of requests
+    mRigidBodyDemand = glm::max((float)mRigidBodyRequests, mRigidBodyDemand * GARBAGE_RIGID_BODY_DEMAND_DECAY);
+    mRigidBodyRequests = 0;
+    
+    mFreeRigidBodyCapacity = glm::clamp((unsigned int)(mRigidBodyDemand * 2.0f), 
+                                        (unsigned int)GARBAGE_FREE_RIGID_BODIES_MIN, 
+                                        (unsigned int)GARBAGE_FREE_RIGID_BODIES_MAX);
+    
+    // Purge rigid bodies
+    while (mGarbageRigidBodies.size() > 0) {
         
-        rigidBody->enableGravity(false);
+        if ((mGarbageTimer.GetCurrentDelta() * 1000.0f >= budget) & 
+            ((mGarbageStats.rigidBodiesRecycled + mGarbageStats.rigidBodiesDestroyed) > 0)) 
+            break;
+            
+        RigidBody* rigidBody = mGarbageRigidBodies[ mGarbageRigidBodies.size() - 1 ];
         
-        rigidBody->updateLocalCenterOfMassFromColliders();
+        mGarbageRigidBodies.pop_back();
         
         // Add the clean rigid body to a free list
-        if (mFreeRigidBodies.size() < 100) {
+        if (mFreeRigidBodies.size() < mFreeRigidBodyCapacity) {
+            
+            RecycleRigidBody( rigidBody );
             
             mFreeRigidBodies.push_back( rigidBody );
             
+            mGarbageStats.rigidBodiesRecycled++;
+            
         } else {
             
             // Purge extra rigid bodies
             Physics.DestroyRigidBody( rigidBody );
             
+            mGarbageStats.rigidBodiesDestroyed++;
+        }
+        
+    }
+    
+    // Release the clean rigid bodies no longer covered by the demand
+    while ((mFreeRigidBodies.size() > mFreeRigidBodyCapacity) & 
+           (mGarbageTimer.GetCurrentDelta() * 1000.0f < budget)) {
+        
+        Physics.DestroyRigidBody( mFreeRigidBodies[ mFreeRigidBodies.size() - 1 ] );
+        
+        mFreeRigidBodies.pop_back();
+        
+        mGarbageStats.rigidBodiesDestroyed++;
+    }
+    
+    mGarbageStats.timeSpent             = mGarbageTimer.GetCurrentDelta() * 1000.0f;
+    mGarbageStats.gameObjectBacklog     = mGarbageGameObjects.size();
+    mGarbageStats.rigidBodyBacklog      = mGarbageRigidBodies.size();
+    mGarbageStats.freeRigidBodyCapacity = mFreeRigidBodyCapacity;
+    
+    return;
+}
+
+void EngineSystemManager::CollectAllGarbage(void) {
+    
+    PurgeGameObjects( mGarbageGameObjects.data(), mGarbageGameObjects.size() );
+    
+    mGarbageGameObjects.clear();
+    
+    for (unsigned int i=0; i < mGarbageRigidBodies.size(); i++) 
+        Physics.DestroyRigidBody( mGarbageRigidBodies[i] );
+        
+    mGarbageRigidBodies.clear();
+    
+    return;
+}
+
+void EngineSystemManager::PurgeGameObjects(GameObject** gameObjects, unsigned int count) {
+    
+    if (count == 0) 
+        return;
+    
+    FrameVector<Component*> components;
+    
+    for (unsigned int i=0; i < count; i++) {
+        
+        GameObject* gameObjectPtr = gameObjects[i];
+        
+        // Destroy the object of the component
+        for (unsigned int c=0; c < gameObjectPtr->GetComponentCount(); c++) {
+            
+            Component* component = gameObjectPtr->GetComponentIndex(c);
+            
+            DestroyComponent( component );
+            
+            components.push_back( component );
         }
         
     }
     
+    // Destroy the object containers
+    mComponents.DestroyBatch( components.data(), components.size() );
+    
+    mGameObjects.DestroyBatch( gameObjects, count );
+    
+    return;
+}
+
+unsigned int EngineSystemManager::GetGarbageCost(GameObject* gameObject) {
+    
+    unsigned int cost = 1 + gameObject->GetComponentCount();
+    
+    // Each genetic renderer is searched out of the render queue
+    if (gameObject->mActorCache != nullptr) 
+        cost += gameObject->mActorCache->mGeneticRenderers.size();
+        
+    return cost;
+}
+
+void EngineSystemManager::DisableGarbageComponents(GameObject* gameObject) {
+    
+    if (gameObject->mActorCache != nullptr) 
+        gameObject->mActorCache->SetActive( false );
+        
+    if (gameObject->mMeshRendererCache != nullptr) 
+        gameObject->mMeshRendererCache->isActive = false;
+        
+    if (gameObject->mLightCache != nullptr) 
+        gameObject->mLightCache->isActive = false;
+        
+    if (gameObject->mRigidBodyCache != nullptr) 
+        gameObject->mRigidBodyCache->setIsActive( false );
+        
+    return;
+}
+
+void EngineSystemManager::RecycleRigidBody(RigidBody* rigidBody) {
+    
+    //
+    // Cleanse the rigid body before handing it back to the user
+    //
+    
+    rigidBody->setUserData(nullptr);
+    
+    // Clear colliders
+    unsigned int numberOfColliders = rigidBody->getNbColliders();
+    for (unsigned int i=0; i < numberOfColliders; i++) {
+        rp3d::Collider* collider = rigidBody->getCollider( i );
+        rigidBody->removeCollider( collider );
+    }
+    
+    // Reset physics
+    rigidBody->resetForce();
+    rigidBody->resetTorque();
+    
+    // Defaults
+    rigidBody->setMass(1);
+    
+    rigidBody->setLinearDamping( 0 );
+    rigidBody->setAngularDamping( 0 );
+    
+    rigidBody->setLinearLockAxisFactor( rp3d::Vector3(0, 0, 0) );
+    rigidBody->setAngularLockAxisFactor( rp3d::Vector3(0, 0, 0) );
+    
+    rigidBody->setLinearVelocity( rp3d::Vector3(0, 0, 0) );
+    
+    rigidBody->setLocalCenterOfMass( rp3d::Vector3(0, 0, 0) );
+    
+    rigidBody->setType( rp3d::BodyType::DYNAMIC );
+    
+    rigidBody->setIsAllowedToSleep(true);
+    rigidBody->setIsActive(false);
+    
+    rigidBody->enableGravity(false);
+    
+    rigidBody->updateLocalCenterOfMassFromColliders();
+    
+    return;
+}
+
+void EngineSystemManager::SetGarbageCollectionBudget(unsigned int microseconds) {
+    
+    mGarbageBudget = microseconds;
+    
+    return;
+}
+
+unsigned int EngineSystemManager::GetGarbageCollectionBudget(void) {
+    
+    return mGarbageBudget;
+}
+
+EngineSystemManager::GarbageCollectionStats EngineSystemManager::GetGarbageCollectionStats(void) {
+    
+    return mGarbageStats;
+}
+
+void EngineSystemManager::ReleaseFreeMemory(void) {
+    
+    // Pools are only released when completely empty so
+    // objects are never moved and pointers remain valid
+    mGameObjects.Shrink();
+    mComponents.Shrink();
+    mTransforms.Shrink();
+    mTextObjects.Shrink();
+    mPanelObjects.Shrink();
+    mButtons.Shrink();
+    
+    Renderer.ReleaseFreeMemory();
+    
+    AI.ReleaseFreeMemory();
+    
     return;
 }
 
@@ -13,6 +13,16 @@ GameObject* EngineSystemManager::CreateGameObject(void) {
 
 bool EngineSystemManager::DestroyGameObject(GameObject* gameObjectPtr) {
     
+    if (gameObjectPtr->mIsGarbage) 
+        return false;
+        
+    gameObjectPtr->mIsGarbage = true;
+    
+    DisableGarbageComponents( gameObjectPtr );
+    
+    // Remove the game object from the component stream
+    RemoveGameObjectFromStream( gameObjectPtr );
+    
     // Remove the game object from the active list
     for (std::vector<GameObject*>::iterator it = mGameObjectActive.begin(); it != mGameObjectActive.end(); ++it) {
         
@@ -26,20 +36,97 @@ bool EngineSystemManager::DestroyGameObject(GameObject* gameObjectPtr) {
         break;
     }
     
-    // Destroy the object of the component
-    for (unsigned int i=0; i < gameObjectPtr->GetComponentCount(); i++) 
-        DestroyComponent( gameObjectPtr->GetComponentIndex(i) );
+    // Defer the deletion
+    mGarbageGameObjects.push_back( gameObjectPtr );
     
-    // Destroy the object container
-    for (unsigned int i=0; i < gameObjectPtr->GetComponentCount(); i++) 
-        mComponents.Destroy( gameObjectPtr->GetComponentIndex(i) );
+    return true;
+}
+
+std::vector<GameObject*> EngineSystemManager::CreateGameObjects(unsigned int count) {
     
-    mGameObjects.Destroy( gameObjectPtr );
+    std::vector<GameObject*> gameObjects(count);
     
-    // Defer the deletion
-    gameObjectPtr->mIsGarbage = true;
+    if (count == 0) 
+        return gameObjects;
     
-    return true;
+    FrameVector<Component*> components(count);
+    FrameVector<Transform*> transforms(count);
+    
+    // Reserve the objects from each pool in one pass
+    if (mGameObjects.CreateBatch( gameObjects.data(), count ) != count) 
+        return std::vector<GameObject*>();
+        
+    // Hand back what the earlier pools gave if a later pool runs out
+    if (mComponents.CreateBatch( components.data(), count ) != count) {
+        
+        mGameObjects.DestroyBatch( gameObjects.data(), count );
+        
+        return std::vector<GameObject*>();
+    }
+    
+    if (mTransforms.CreateBatch( transforms.data(), count ) != count) {
+        
+        mGameObjects.DestroyBatch( gameObjects.data(), count );
+        mComponents.DestroyBatch( components.data(), count );
+        
+        return std::vector<GameObject*>();
+    }
+    
+    for (unsigned int i=0; i < count; i++) {
+        
+        components[i]->SetComponent( Components.Transform, (void*)transforms[i] );
+        
+        gameObjects[i]->AddComponent( components[i] );
+        
+        mGameObjectActive.push_back( gameObjects[i] );
+    }
+    
+    return gameObjects;
+}
+
+void EngineSystemManager::DestroyGameObjects(std::vector<GameObject*>& gameObjects) {
+    
+    unsigned int numberOfGameObjects = gameObjects.size();
+    
+    if (numberOfGameObjects == 0) 
+        return;
+    
+    unsigned int firstGarbage = mGarbageGameObjects.size();
+    
+    // Flag the objects so the active list can be filtered in a single pass
+    for (unsigned int i=0; i < numberOfGameObjects; i++) {
+        
+        // Objects already queued are skipped
+        if (gameObjects[i]->mIsGarbage) 
+            continue;
+            
+        gameObjects[i]->mIsGarbage = true;
+        
+        mGarbageGameObjects.push_back( gameObjects[i] );
+    }
+    
+    mGameObjectActive.erase( std::remove_if(mGameObjectActive.begin(), mGameObjectActive.end(), [](GameObject* gameObject) {
+        return gameObject->mIsGarbage;
+    }), mGameObjectActive.end() );
+    
+    // Remove the objects from the component stream
+    mDirtyGameObjects.erase( std::remove_if(mDirtyGameObjects.begin(), mDirtyGameObjects.end(), [](GameObject* gameObject) {
+        return gameObject->mIsGarbage;
+    }), mDirtyGameObjects.end() );
+    
+    // The components are destroyed later by the garbage collector
+    for (unsigned int i=firstGarbage; i < mGarbageGameObjects.size(); i++) {
+        
+        GameObject* gameObjectPtr = mGarbageGameObjects[i];
+        
+        gameObjectPtr->mIsDirty = false;
+        
+        DisableGarbageComponents( gameObjectPtr );
+        
+        RemoveGameObjectFromStream( gameObjectPtr );
+    }
+    
+    return;
 }
 
 unsigned int EngineSystemManager::GetNumberOfGameObjects(void) {
@@ -47,6 +134,16 @@ unsigned int EngineSystemManager::GetNumberOfGameObjects(void) {
     return mGameObjects.Size();
 }
 
+unsigned int EngineSystemManager::FindGameObjectsInRadius(glm::vec3 position, float radius, std::vector<GameObject*>& results) {
+    
+    return mSpatialGrid.QueryRadius(position, radius, results);
+}
+
+unsigned int EngineSystemManager::FindGameObjectsInBox(glm::vec3 min, glm::vec3 max, std::vector<GameObject*>& results) {
+    
+    return mSpatialGrid.QueryBox(min, max, results);
+}
+
 GameObject* EngineSystemManager::CreateCameraController(glm::vec3 position) {
     
     GameObject* cameraController = CreateGameObject();
@@ -135,18 +232,39 @@ GameObject* EngineSystemManager::CreateSky(std::string meshTagName, Color colorL
     GameObject* skyObject = CreateGameObject();
     skyObject->name = "sky";
     skyObject->AddComponent( CreateComponentMeshRenderer(skyMesh, skyMaterial) );
-    skyObject->renderDistance = -1;
+    skyObject->SetRenderDistance( -1 );
     
     skyObject->mTransformCache->SetScale(10000, 2000, 10000);
     
     return skyObject;
 }
 
+std::vector<GameObject*> EngineSystemManager::CreateAIActors(std::vector<glm::vec3>& positions) {
+    
+    unsigned int numberOfActors = positions.size();
+    
+    std::vector<GameObject*> gameObjects = CreateGameObjects( numberOfActors );
+    
+    mComponents.Reserve( numberOfActors * 2 );
+    
+    for (unsigned int i=0; i < numberOfActors; i++) 
+        InitiateAIActor( gameObjects[i], positions[i] );
+    
+    return gameObjects;
+}
+
 GameObject* EngineSystemManager::CreateAIActor(glm::vec3 position) {
     
     GameObject* newGameObject = CreateGameObject();
     
-    newGameObject->renderDistance = 300;
+    InitiateAIActor( newGameObject, position );
+    
+    return newGameObject;
+}
+
+void EngineSystemManager::InitiateAIActor(GameObject* newGameObject, glm::vec3 position) {
+    
+    newGameObject->SetRenderDistance( 300 );
     
     newGameObject->AddComponent( CreateComponent(Components.Actor) );
     newGameObject->AddComponent( CreateComponent(Components.RigidBody) );
@@ -168,13 +286,13 @@ GameObject* EngineSystemManager::CreateAIActor(glm::vec3 position) {
     newGameObject->SetLinearAxisLockFactor(1, 1, 1);
     newGameObject->SetAngularAxisLockFactor(0, 0, 0);
     
-    return newGameObject;
+    return;
 }
 
 GameObject* EngineSystemManager::CreateOverlayRenderer(void) {
     GameObject* overlayObject = Create<GameObject>();
     
-    overlayObject->renderDistance = -1;
+    overlayObject->SetRenderDistance( -1 );
     
     overlayObject->mTransformCache->matrix = glm::mat4(1);
     overlayObject->mTransformCache->RotateAxis(-180, Vector3(0, 1, 0));
@@ -206,7 +324,7 @@ GameObject* EngineSystemManager::CreateOverlayTextRenderer(int x, int y, std::st
     
     GameObject* overlayObject = CreateOverlayRenderer();
     
-    overlayObject->renderDistance = -1;
+    overlayObject->SetRenderDistance( -1 );
     
     overlayObject->AddComponent( CreateComponent<Text>() );
     Text* textElement = overlayObject->GetComponent<Text>();
@@ -243,7 +361,7 @@ GameObject* EngineSystemManager::CreateOverlayPanelRenderer(int x, int y, int wi
     
     GameObject* overlayObject = CreateOverlayRenderer();
     
-    overlayObject->renderDistance = -1;
+    overlayObject->SetRenderDistance( -1 );
     
     overlayObject->AddComponent( CreateComponent<Panel>() );
     Panel* overPanel = overlayObject->GetComponent<Panel>();
@@ -4,11 +4,17 @@
 
 extern FloatType Float;
 extern IntType Int;
+extern UintType Uint;
 
 extern ProfilerTimer Profiler;
 
 void EngineSystemManager::Update(void) {
     
+    PROFILE_ZONE("Engine update");
+    
+    // Count simulation steps so the renderer only blends from the step before
+    Renderer.mInterpolationStep++;
+    
     // Update player/camera position in the AI simulation
     if (sceneMain != nullptr) {
         
@@ -19,33 +25,130 @@ void EngineSystemManager::Update(void) {
         
     }
     
+    // Run the work handed back to the main thread by the job system
+    {
+        PROFILE_ZONE("Main thread jobs");
+        
+        Jobs.RunMainThreadJobs();
+    }
+    
     // Process garbage objects
-    ProcessDeferredDeletion();
+    {
+        PROFILE_ZONE("Deferred deletion");
+        
+        ProcessDeferredDeletion();
+    }
     
     // Update component stream buffer
-    UpdateComponentStream();
+    {
+        PROFILE_ZONE("Component stream");
+        
+        UpdateComponentStream();
+    }
+    
+    // Expressing genes creates renderers and materials so it stays on this thread
+    {
+        PROFILE_ZONE("Actor genetics");
+        
+        for (unsigned int i=0; i < mStreamSize; i++) 
+            if (mStreamBuffer[i].actor != nullptr) UpdateActorGenetics(i);
+    }
+    
+    
+    //
+    // Component passes
+    //
+    // Each pass is scheduled behind the passes it reads from so the
+    // independent passes overlap across the worker threads.
+    
+    // Copy the simulated rigid body positions into their transforms
+    JobHandle rigidBodyPass = Jobs.ScheduleParallelFor(mStreamSize, JOB_SYSTEM_GRAIN_SIZE, [this](unsigned int begin, unsigned int end) {
+        
+        PROFILE_ZONE("Rigid body pass");
+        
+        for (unsigned int i=begin; i < end; i++) 
+            if (mStreamBuffer[i].rigidBody != nullptr) UpdateRigidBody(i);
+        
+    });
     
     // Run through the parent matrix transform chains and apply the matrices therein
-    UpdateTransformationChains();
+    JobHandle transformPass = UpdateTransformationChains( rigidBodyPass );
+    
+    // Move the stream objects to their new positions in the spatial grid
+    JobHandle spatialGridPass = Jobs.Schedule([this]() {
+        
+        PROFILE_ZONE("Spatial grid pass");
+        
+        UpdateSpatialGrid();
+        
+    }, transformPass);
+    
+    // Mesh renderers and lights copy the finished transforms
+    JobHandle rendererPass = Jobs.ScheduleParallelFor(mStreamSize, JOB_SYSTEM_GRAIN_SIZE, [this](unsigned int begin, unsigned int end) {
+        
+        PROFILE_ZONE("Renderer pass");
+        
+        for (unsigned int i=begin; i < end; i++) {
+            
+            if (mStreamBuffer[i].meshRenderer != nullptr)    UpdateMeshRenderer(i);
+            if (mStreamBuffer[i].light != nullptr)           UpdateLight(i);
+            
+        }
+        
+    }, transformPass);
+    
+    // Targeting and animation only touch the actor and its own renderers
+    JobHandle actorPass = Jobs.ScheduleParallelFor(mStreamSize, JOB_SYSTEM_GRAIN_SIZE, [this](unsigned int begin, unsigned int end) {
+        
+        PROFILE_ZONE("Actor pass");
+        
+        for (unsigned int i=begin; i < end; i++) {
+            
+            if (mStreamBuffer[i].actor == nullptr) 
+                continue;
+                
+            UpdateActorTargetRotation(i);
+            
+            UpdateActorAnimation(i);
+        }
+        
+    }, transformPass);
+    
+    // The console and UI may create or destroy objects in the stream
+    {
+        PROFILE_ZONE("Wait component passes");
+        
+        Jobs.Wait( spatialGridPass );
+        Jobs.Wait( rendererPass );
+        Jobs.Wait( actorPass );
+    }
+    
+    // Objects which entered a new grid cell during the spatial grid pass
+    for (unsigned int i=0; i < mMovedGameObjects.size(); i++) 
+        MarkGameObjectDirty( mMovedGameObjects[i] );
+        
+    mMovedGameObjects.clear();
     
     // Process UI elements
-    UpdateUI();
+    {
+        PROFILE_ZONE("UI");
+        
+        UpdateUI();
+    }
     
     // Process console input
     UpdateConsole();
     
+    // Sample the allocator create and destroy rates
+    AllocatorRegistry::Get().Sample();
     
-    //
-    // Update attached components
-    //
+    // The remaining updates touch the physics world, the scenes and the input state
+    PROFILE_ZONE("Main thread components");
     
     for (unsigned int i=0; i < mStreamSize; i++ ) {
         
-        if (mStreamBuffer[i].rigidBody != nullptr)       UpdateRigidBody(i);
-        if (mStreamBuffer[i].meshRenderer != nullptr)    UpdateMeshRenderer(i);
         if (mStreamBuffer[i].camera != nullptr)          UpdateCamera(i);
         if (mStreamBuffer[i].actor != nullptr)           UpdateActor(i);
-        if (mStreamBuffer[i].light != nullptr)           UpdateLight(i);
         if (mStreamBuffer[i].text != nullptr)            UpdateTextUI(i);
         
         if ((mStreamBuffer[i].panel != nullptr) & 
@@ -74,9 +177,23 @@ void EngineSystemManager::Update(void) {
         if (Profiler.profilePhysicsSystem > 30) mProfilerText[1]->color = Colors.red;
         
         
+        // Hitches show in the tail of the frame times rather than the current frame
+        float frameTimeTail = Profiler.GetHistogram(ProfilerChannel::Frame).GetPercentile(99.0f);
+        
+        mProfilerText[2]->text = "Frame p99 - " + Float.ToString( frameTimeTail );
+        mProfilerText[2]->color = Colors.white;
+        if (frameTimeTail > 20) mProfilerText[2]->color = Colors.yellow;
+        if (frameTimeTail > 33) mProfilerText[2]->color = Colors.orange;
+        if (frameTimeTail > 50) mProfilerText[2]->color = Colors.red;
+        
         mProfilerText[3]->text = "Engine   - " + Float.ToString( Profiler.profileGameEngineUpdate );
         
-        mProfilerText[4]->text = "Draw calls - " + Float.ToString( Renderer.GetNumberOfDrawCalls() );
+        mProfilerText[4]->text = "Draw calls - " + Float.ToString( Renderer.GetNumberOfDrawCalls() ) + "  Instances - " 
+                                                 + Uint.ToString( Renderer.GetNumberOfInstances() );
+        mProfilerText[5]->text = "Binds - " + Uint.ToString( Renderer.GetNumberOfShaderBinds() ) + " / " 
+                                            + Uint.ToString( Renderer.GetNumberOfMaterialBinds() ) + " / " 
+                                            + Uint.ToString( Renderer.GetNumberOfMeshBinds() ) + "  Uniforms - " 
+                                            + Uint.ToString( Renderer.GetNumberOfUniformUploads() );
         
         mProfilerText[6]->text = "GameObject ------ " + Int.ToString( GetNumberOfGameObjects() );
         mProfilerText[7]->text = "Component ------- " + Int.ToString( GetNumberOfComponents() );
@@ -89,7 +206,8 @@ void EngineSystemManager::Update(void) {
         
         mProfilerText[15]->text = "Garbage game objects --- " + Int.ToString( mGarbageGameObjects.size() );
         mProfilerText[16]->text = "Garbage rigid bodies --- " + Int.ToString( mGarbageRigidBodies.size() );
-        mProfilerText[17]->text = "Clean rigid bodies ----- " + Int.ToString( mFreeRigidBodies.size() );
+        mProfilerText[17]->text = "Clean rigid bodies ----- " + Int.ToString( mFreeRigidBodies.size() ) + " / " + Int.ToString( mFreeRigidBodyCapacity );
+        mProfilerText[18]->text = "Garbage collected ------ " + Int.ToString( mGarbageStats.objectsDestroyed ) + " in " + Float.ToString( mGarbageStats.timeSpent ) + "us";
         
         mProfilerText[19]->text = "Camera Yaw ---- " + Float.ToString( sceneMain->camera->lookAngle.x );
         mProfilerText[20]->text = "Camera Pitch -- " + Float.ToString( sceneMain->camera->lookAngle.y );
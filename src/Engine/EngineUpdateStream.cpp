@@ -3,105 +3,352 @@
 
 void EngineSystemManager::UpdateComponentStream(void) {
     
-    unsigned int numberOfGameObjects = mGameObjects.Size();
+    // Re-evaluate the distance limited objects near the camera when it changes cell
+    if ((sceneMain != nullptr) && (sceneMain->camera != nullptr)) {
+        
+        glm::vec3 cameraPosition = sceneMain->camera->transform.position;
+        
+        glm::ivec3 cameraCell( glm::floor(cameraPosition / COMPONENT_STREAM_CELL_SIZE) );
+        
+        if ((!mHasStreamCameraCell) | (cameraCell != mStreamCameraCell)) {
+            
+            if (mIsStreamMaxRenderDistanceDirty) 
+                UpdateStreamMaxRenderDistance();
+                
+            std::vector<GameObject*> nearbyObjects;
+            
+            if (mHasStreamCameraCell) {
+                
+                // Objects in the stream were last evaluated with the camera in the previous cell and have
+                // since moved within their grid cell, so only that area can fall out of range. Two cells
+                // of margin covers the diagonal of a cell
+                float reach = mStreamMaxRenderDistance + mSpatialGrid.GetCellSize() * 2.0f;
+                
+                glm::vec3 previousMin = glm::vec3(mStreamCameraCell) * COMPONENT_STREAM_CELL_SIZE - glm::vec3(reach);
+                glm::vec3 previousMax = glm::vec3(mStreamCameraCell + glm::ivec3(1)) * COMPONENT_STREAM_CELL_SIZE + glm::vec3(reach);
+                
+                mSpatialGrid.QueryBox(previousMin, previousMax, nearbyObjects);
+                
+                for (unsigned int i=0; i < nearbyObjects.size(); i++) {
+                    
+                    if ((nearbyObjects[i]->mStreamIndex != COMPONENT_STREAM_INDEX_NONE) & (nearbyObjects[i]->mDistanceIndex != COMPONENT_STREAM_INDEX_NONE)) 
+                        MarkGameObjectDirty( nearbyObjects[i] );
+                }
+                
+                nearbyObjects.clear();
+                
+            } else {
+                
+                // Objects may have been activated before there was a camera to measure from
+                for (unsigned int i=0; i < mDistanceGameObjects.size(); i++) 
+                    MarkGameObjectDirty( mDistanceGameObjects[i].gameObject );
+                    
+            }
+            
+            mStreamCameraCell    = cameraCell;
+            mHasStreamCameraCell = true;
+            
+            // Objects out of the stream can only come into range if they are within the largest render distance
+            mSpatialGrid.QueryRadius(cameraPosition, mStreamMaxRenderDistance, nearbyObjects);
+            
+            for (unsigned int i=0; i < nearbyObjects.size(); i++) {
+                
+                if (nearbyObjects[i]->mDistanceIndex != COMPONENT_STREAM_INDEX_NONE) 
+                    MarkGameObjectDirty( nearbyObjects[i] );
+            }
+            
+        }
+        
+    } else {
+        
+        // Measure again from whichever camera is set next
+        mHasStreamCameraCell = false;
+        
+    }
+    
+    // Objects turned away from a full stream try again once slots free up
+    if ((mWaitingGameObjects.size() > 0) & (mStreamSize < COMPONENT_STREAM_BUFFER_SIZE)) {
+        
+        for (unsigned int i=0; i < mWaitingGameObjects.size(); i++) {
+            
+            mWaitingGameObjects[i]->mIsWaitingForStream = false;
+            
+            MarkGameObjectDirty( mWaitingGameObjects[i] );
+        }
+        
+        mWaitingGameObjects.clear();
+    }
     
-    if (numberOfGameObjects == 0) 
+    // Process the objects which have changed since the last update
+    for (unsigned int i=0; i < mDirtyGameObjects.size(); i++) {
+        
+        GameObject* gameObject = mDirtyGameObjects[i];
+        
+        if (!gameObject->mIsDirty) 
+            continue;
+            
+        gameObject->mIsDirty = false;
+        
+        UpdateGameObjectActivation( gameObject );
+    }
+    
+    mDirtyGameObjects.clear();
+    
+    return;
+}
+
+void EngineSystemManager::MarkGameObjectDirty(GameObject* gameObject) {
+    
+    if (gameObject->mIsDirty) 
         return;
+        
+    gameObject->mIsDirty = true;
     
-    unsigned int objectsPerTick = glm::max((unsigned int)1, (numberOfGameObjects / 8));
+    mDirtyGameObjects.push_back( gameObject );
+    
+    return;
+}
+
+void EngineSystemManager::UpdateGameObjectActivation(GameObject* gameObject) {
     
-    if (objectsPerTick == 0) 
-        objectsPerTick = 1;
+    // Keep the spatial index in step with objects outside the stream. Objects
+    // in the stream are moved to their world position by the transform chain
+    glm::vec3 worldPosition(0);
     
-    for (unsigned int i=0; i < objectsPerTick; i++) {
+    if (gameObject->mTransformCache != nullptr) {
         
-        mObjectIndex++;
+        worldPosition = GetStreamWorldPosition( gameObject->mTransformCache );
         
-        if (mObjectIndex >= mGameObjects.Size()) 
-            mObjectIndex = 0;
+        mSpatialGrid.Update( gameObject, worldPosition );
         
-        GameObject* gameObject = mGameObjects[mObjectIndex];
+    } else {
         
-        // Check game object render distance
-        bool shouldRender = true;
+        mSpatialGrid.Remove( gameObject );
         
-        if (gameObject->renderDistance > 0) {
+    }
+    
+    // Track the objects which are limited by a render distance
+    if (gameObject->mRenderDistance > 0) {
+        
+        if (gameObject->mDistanceIndex == COMPONENT_STREAM_INDEX_NONE) {
             
-            if (glm::distance(gameObject->mTransformCache->position, sceneMain->camera->transform.position) > gameObject->renderDistance) 
-                shouldRender = false;
+            gameObject->mDistanceIndex = mDistanceGameObjects.size();
+            
+            DistanceGameObject entry;
+            entry.gameObject     = gameObject;
+            entry.renderDistance = gameObject->mRenderDistance;
+            
+            mDistanceGameObjects.push_back( entry );
         }
         
-        // Check garbage collection
-        if (gameObject->mIsGarbage) 
-            mGarbageGameObjects.push_back( gameObject );
+        DistanceGameObject& entry = mDistanceGameObjects[ gameObject->mDistanceIndex ];
         
+        // The largest distance is searched for again once the farthest object moves it closer
+        if ((entry.renderDistance >= mStreamMaxRenderDistance) & (gameObject->mRenderDistance < entry.renderDistance)) 
+            mIsStreamMaxRenderDistanceDirty = true;
+            
+        entry.renderDistance = gameObject->mRenderDistance;
+        
+        if (mStreamMaxRenderDistance < entry.renderDistance) 
+            mStreamMaxRenderDistance = entry.renderDistance;
+            
+    } else {
+        
+        RemoveGameObjectFromDistanceList( gameObject );
+        
+    }
+    
+    // Check game object render distance
+    bool shouldRender = true;
+    
+    if ((gameObject->mRenderDistance > 0) & (gameObject->mTransformCache != nullptr)) {
+        
+        if ((sceneMain != nullptr) && (sceneMain->camera != nullptr)) {
+            
+            if (glm::distance(worldPosition, sceneMain->camera->transform.position) > gameObject->mRenderDistance) 
+                shouldRender = false;
+        }
+        
+    }
+    
+    
+    //
+    // Update the state of associated components
+    //
+    
+    bool activeState = true;
+    
+    if ((!gameObject->mIsActive) | (!shouldRender)) 
+        activeState = false;
         
-        //
-        // Update the state of associated components
-        //
+    if (gameObject->mActorCache != nullptr) 
+        gameObject->mActorCache->SetActive( activeState );
         
-        bool activeState = true;
+    if (gameObject->mMeshRendererCache != nullptr) 
+        gameObject->mMeshRendererCache->isActive = activeState;
         
-        if ((!gameObject->isActive) | (!shouldRender))
-            activeState = false;
+    if (gameObject->mLightCache != nullptr) 
+        gameObject->mLightCache->isActive = activeState;
         
-        if (gameObject->mActorCache != nullptr) 
-            gameObject->mActorCache->SetActive( activeState );
+    if (gameObject->mRigidBodyCache != nullptr) 
+        gameObject->mRigidBodyCache->setIsActive( activeState );
         
-        if (gameObject->mMeshRendererCache != nullptr) 
-            gameObject->mMeshRendererCache->isActive = activeState;
+    // UI elements should always be added to the stream buffer
+    bool isUIElement = false;
+    
+    if (gameObject->mTextCache != nullptr)  isUIElement = true;
+    if (gameObject->mPanelCache != nullptr) isUIElement = true;
+    
+    
+    //
+    // Final check before added to list
+    
+    if ((((!gameObject->mIsActive) | (!shouldRender)) & (!isUIElement)) | (gameObject->mTransformCache == nullptr)) {
         
-        if (gameObject->mLightCache != nullptr) 
-            gameObject->mLightCache->isActive = activeState;
+        RemoveGameObjectFromStream( gameObject );
         
-        if (gameObject->mRigidBodyCache != nullptr) 
-            gameObject->mRigidBodyCache->setIsActive( activeState );
+        return;
+    }
+    
+    if (gameObject->mStreamIndex == COMPONENT_STREAM_INDEX_NONE) {
         
-        // Check last object
-        if (mObjectIndex == mGameObjects.Size() - 1) {
+        if (mStreamSize >= COMPONENT_STREAM_BUFFER_SIZE) {
             
-            mStreamSize = mDataStreamIndex;
+            if (!gameObject->mIsWaitingForStream) {
+                
+                gameObject->mIsWaitingForStream = true;
+                
+                mWaitingGameObjects.push_back( gameObject );
+            }
             
-            mDataStreamIndex = 0;
+            return;
         }
         
-        // UI elements should always be added to the stream buffer
-        bool isUIElement = false;
+        gameObject->mStreamIndex = mStreamSize;
         
-        if (gameObject->mTextCache != nullptr)  isUIElement = true;
-        if (gameObject->mPanelCache != nullptr) isUIElement = true;
+        mStreamSize++;
         
+        mIsTransformOrderDirty = true;
+    }
+    
+    if (mStreamBuffer[gameObject->mStreamIndex].transform != gameObject->mTransformCache) 
+        mIsTransformOrderDirty = true;
         
-        //
-        // Final check before added to list
+    //
+    // Set buffer stream objects and components
+    //
+    
+    unsigned int index = gameObject->mStreamIndex;
+    
+    mStreamBuffer[index].gameObject    = gameObject;
+    mStreamBuffer[index].transform     = gameObject->mTransformCache;
+    
+    mStreamBuffer[index].light         = gameObject->mLightCache;
+    mStreamBuffer[index].actor         = gameObject->mActorCache;
+    mStreamBuffer[index].camera        = gameObject->mCameraCache;
+    mStreamBuffer[index].rigidBody     = gameObject->mRigidBodyCache;
+    mStreamBuffer[index].meshRenderer  = gameObject->mMeshRendererCache;
+    
+    mStreamBuffer[index].text          = gameObject->mTextCache;
+    mStreamBuffer[index].panel         = gameObject->mPanelCache;
+    
+    return;
+}
+
+void EngineSystemManager::RemoveGameObjectFromStream(GameObject* gameObject) {
+    
+    // Remove from the stream buffer by swapping the last entry into its place
+    if (gameObject->mStreamIndex != COMPONENT_STREAM_INDEX_NONE) {
         
-        if (((!gameObject->isActive) | (!shouldRender)) & (!isUIElement)) 
-            continue;
+        unsigned int index = gameObject->mStreamIndex;
+        unsigned int last  = mStreamSize - 1;
         
-        //
-        // Set buffer stream objects and components
-        //
+        if (index != last) {
+            
+            mStreamBuffer[index] = mStreamBuffer[last];
+            mStreamBuffer[index].gameObject->mStreamIndex = index;
+        }
         
-        mStreamBuffer[mDataStreamIndex].gameObject    = gameObject;
-        mStreamBuffer[mDataStreamIndex].transform     = gameObject->mTransformCache;
+        mStreamSize--;
         
-        mStreamBuffer[mDataStreamIndex].light         = gameObject->mLightCache;
-        mStreamBuffer[mDataStreamIndex].actor         = gameObject->mActorCache;
-        mStreamBuffer[mDataStreamIndex].camera        = gameObject->mCameraCache;
-        mStreamBuffer[mDataStreamIndex].rigidBody     = gameObject->mRigidBodyCache;
-        mStreamBuffer[mDataStreamIndex].meshRenderer  = gameObject->mMeshRendererCache;
+        gameObject->mStreamIndex = COMPONENT_STREAM_INDEX_NONE;
         
-        mStreamBuffer[mDataStreamIndex].text          = gameObject->mTextCache;
-        mStreamBuffer[mDataStreamIndex].panel         = gameObject->mPanelCache;
+        mIsTransformOrderDirty = true;
+    }
+    
+    // Destroyed objects must also leave the activation lists
+    if (!gameObject->mIsGarbage) 
+        return;
         
-        mDataStreamIndex++;
+    RemoveGameObjectFromDistanceList( gameObject );
+    
+    mSpatialGrid.Remove( gameObject );
+    
+    if (gameObject->mIsDirty) {
         
-        if (mStreamSize < mDataStreamIndex)
-            mStreamSize++;
+        std::vector<GameObject*>::iterator it = std::find(mDirtyGameObjects.begin(), mDirtyGameObjects.end(), gameObject);
         
-        continue;
+        if (it != mDirtyGameObjects.end()) 
+            mDirtyGameObjects.erase(it);
+            
+        gameObject->mIsDirty = false;
     }
     
+    if (gameObject->mIsWaitingForStream) {
+        
+        std::vector<GameObject*>::iterator it = std::find(mWaitingGameObjects.begin(), mWaitingGameObjects.end(), gameObject);
+        
+        if (it != mWaitingGameObjects.end()) 
+            mWaitingGameObjects.erase(it);
+            
+        gameObject->mIsWaitingForStream = false;
+    }
+    
+    return;
+}
+
+void EngineSystemManager::RemoveGameObjectFromDistanceList(GameObject* gameObject) {
+    
+    if (gameObject->mDistanceIndex == COMPONENT_STREAM_INDEX_NONE) 
+        return;
+        
+    unsigned int index = gameObject->mDistanceIndex;
+    
+    if (mDistanceGameObjects[index].renderDistance >= mStreamMaxRenderDistance) 
+        mIsStreamMaxRenderDistanceDirty = true;
+        
+    DistanceGameObject lastEntry = mDistanceGameObjects[ mDistanceGameObjects.size() - 1 ];
+    
+    mDistanceGameObjects[index] = lastEntry;
+    lastEntry.gameObject->mDistanceIndex = index;
+    
+    mDistanceGameObjects.pop_back();
+    
+    gameObject->mDistanceIndex = COMPONENT_STREAM_INDEX_NONE;
+    
+    return;
+}
+
+glm::vec3 EngineSystemManager::GetStreamWorldPosition(Transform* transform) {
+    
+    glm::vec3 position(0);
+    
+    for (Transform* current = transform; current != nullptr; current = current->parent) 
+        position += current->position;
+        
+    return position;
+}
+
+void EngineSystemManager::UpdateStreamMaxRenderDistance(void) {
+    
+    mStreamMaxRenderDistance = 0;
+    
+    for (unsigned int i=0; i < mDistanceGameObjects.size(); i++) 
+        if (mStreamMaxRenderDistance < mDistanceGameObjects[i].renderDistance) 
+            mStreamMaxRenderDistance = mDistanceGameObjects[i].renderDistance;
+            
+    mIsStreamMaxRenderDistanceDirty = false;
+    
     return;
 }
 
@@ -26,11 +26,7 @@ ENGINE_API extern PlatformLayer     Platform;
 
 void EngineSystemManager::UpdateActor(unsigned int index) {
     
-    UpdateActorGenetics(index);
-    
-    UpdateActorTargetRotation(index);
-    
-    UpdateActorAnimation(index);
+    // Genetics, targeting and animation are updated in their own passes beforehand
     
     UpdateActorPhysics(index);
     
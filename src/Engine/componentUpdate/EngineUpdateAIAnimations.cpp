@@ -2,6 +2,7 @@
 // Update actor components
 
 #include <GameEngineFramework/Engine/Engine.h>
+#include <GameEngineFramework/Math/TransformBatch.h>
 
 ENGINE_API extern EngineComponents  Components;
 ENGINE_API extern ColorPreset       Colors;
@@ -26,6 +27,35 @@ ENGINE_API extern PlatformLayer     Platform;
 
 void EngineSystemManager::UpdateActorAnimation(unsigned int index) {
     
+    // The actor position, age scale and center mass rotation
+    // are shared by every gene so the base is built once
+    glm::mat4 baseMatrix = glm::translate(glm::mat4(1), mStreamBuffer[index].actor->mPosition);
+    
+    // Rotate around center mass
+    float orientationCenterMass = glm::length( mStreamBuffer[index].actor->mRotation );
+    
+    
+    // Scale by age
+    float ageScalerValue = ((float)mStreamBuffer[index].actor->mAge) * 0.001f;
+    
+    if (ageScalerValue > 1.0f) 
+        ageScalerValue = 1.0f;
+    
+    float ageScale = Math.Lerp(mStreamBuffer[index].actor->mYouthScale, 
+                               mStreamBuffer[index].actor->mAdultScale, 
+                               ageScalerValue);
+    
+    baseMatrix = glm::scale( baseMatrix, glm::vec3( ageScale ));
+    
+    // Rotate around center
+    if (orientationCenterMass > 0) {
+        
+        baseMatrix = glm::rotate(baseMatrix, 
+                                 glm::radians( orientationCenterMass ), 
+                                 glm::normalize( mStreamBuffer[index].actor->mRotation ));
+        
+    }
+    
     for (unsigned int a=0; a < mStreamBuffer[index].actor->mGeneticRenderers.size(); a++) {
         
         MeshRenderer* geneRenderer = mStreamBuffer[index].actor->mGeneticRenderers[a];
@@ -33,33 +63,7 @@ void EngineSystemManager::UpdateActorAnimation(unsigned int index) {
         geneRenderer->transform.position = mStreamBuffer[index].actor->mPosition;
         
         // Initiate the transform
-        glm::mat4 matrix = glm::translate(glm::mat4(1), geneRenderer->transform.position);
-        
-        // Rotate around center mass
-        float orientationCenterMass = glm::length( mStreamBuffer[index].actor->mRotation );
-        
-        
-        // Scale by age
-        float ageScalerValue = ((float)mStreamBuffer[index].actor->mAge) * 0.001f;
-        
-        if (ageScalerValue > 1.0f) 
-            ageScalerValue = 1.0f;
-        
-        float ageScale = Math.Lerp(mStreamBuffer[index].actor->mYouthScale, 
-                                   mStreamBuffer[index].actor->mAdultScale, 
-                                   ageScalerValue);
-        
-        matrix = glm::scale( matrix, glm::vec3( ageScale ));
-        
-        // Rotate around center
-        if (orientationCenterMass > 0) {
-            
-            matrix = glm::rotate(matrix, 
-                                glm::radians( orientationCenterMass ), 
-                                glm::normalize( mStreamBuffer[index].actor->mRotation ));
-            
-        }
-        
+        glm::mat4 matrix = baseMatrix;
         
         // Offset from center
         matrix = glm::translate( matrix, glm::vec3(mStreamBuffer[index].actor->mGenes[a].offset.x,
@@ -77,6 +81,8 @@ void EngineSystemManager::UpdateActorAnimation(unsigned int index) {
                                                        mStreamBuffer[index].actor->mGenes[a].position.z));
             
             geneRenderer->transform.matrix = glm::scale(matrix, geneRenderer->transform.scale);
+            geneRenderer->transform.normalMatrix = TransformBatch::CalculateNormalMatrix( geneRenderer->transform.matrix );
+            geneRenderer->UpdateBounds();
             
             continue;
         }
@@ -222,6 +228,8 @@ void EngineSystemManager::UpdateActorAnimation(unsigned int index) {
                                                    mStreamBuffer[index].actor->mGenes[a].position.z));
         
         geneRenderer->transform.matrix = glm::scale(matrix, geneRenderer->transform.scale);
+        geneRenderer->transform.normalMatrix = TransformBatch::CalculateNormalMatrix( geneRenderer->transform.matrix );
+        geneRenderer->UpdateBounds();
         
         continue;
     }
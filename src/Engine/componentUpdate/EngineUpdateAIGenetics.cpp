@@ -88,7 +88,7 @@ void EngineSystemManager::UpdateActorGenetics(unsigned int index) {
         // Generate a new mesh renderer for the gene
         
         Material* newMaterial = Renderer.CreateMaterial();
-        newMaterial->shader = shaders.color;
+        newMaterial->shader = shaders.colorInstanced;
         newMaterial->diffuse.r = mStreamBuffer[index].actor->mGenes[a].color.x;
         newMaterial->diffuse.g = mStreamBuffer[index].actor->mGenes[a].color.y;
         newMaterial->diffuse.b = mStreamBuffer[index].actor->mGenes[a].color.z;
@@ -71,7 +71,18 @@ void EngineSystemManager::UpdateCamera(unsigned int index) {
         
     } else {
         
-        mStreamBuffer[index].camera->transform.position = mStreamBuffer[index].transform->position;
+        Camera* camera = mStreamBuffer[index].camera;
+        
+        // Keep the position of the previous step for interpolation
+        if (camera->mInterpolationStep + 1 == Renderer.mInterpolationStep) {
+            camera->mPreviousPosition = camera->transform.position;
+        } else {
+            camera->mPreviousPosition = mStreamBuffer[index].transform->position;
+        }
+        
+        camera->mInterpolationStep = Renderer.mInterpolationStep;
+        
+        camera->transform.position = mStreamBuffer[index].transform->position;
         
     }
     
@@ -26,12 +26,31 @@ ENGINE_API extern PlatformLayer     Platform;
 
 void EngineSystemManager::UpdateMeshRenderer(unsigned int index) {
     
+    MeshRenderer* meshRenderer = mStreamBuffer[index].meshRenderer;
+    
+    // Keep the matrix of the previous step for interpolation. Snap when
+    // the renderer was not updated on the step before
+    if (meshRenderer->mInterpolationStep + 1 == Renderer.mInterpolationStep) {
+        meshRenderer->mPreviousMatrix = meshRenderer->transform.matrix;
+    } else {
+        meshRenderer->mPreviousMatrix = mStreamBuffer[index].transform->matrix;
+    }
+    
+    meshRenderer->mInterpolationStep = Renderer.mInterpolationStep;
+    
     mStreamBuffer[index].meshRenderer->transform.position  = mStreamBuffer[index].transform->position;
     mStreamBuffer[index].meshRenderer->transform.rotation  = mStreamBuffer[index].transform->rotation;
     mStreamBuffer[index].meshRenderer->transform.scale     = mStreamBuffer[index].transform->scale;
     
-    mStreamBuffer[index].meshRenderer->transform.matrix = mStreamBuffer[index].transform->matrix;
+    mStreamBuffer[index].meshRenderer->transform.matrix       = mStreamBuffer[index].transform->matrix;
+    mStreamBuffer[index].meshRenderer->transform.normalMatrix = mStreamBuffer[index].transform->normalMatrix;
+    
+    // The bounds cover every matrix the renderer may be drawn with before the next step
+    meshRenderer->UpdateBounds();
     
+    if (meshRenderer->mDoInterpolation) 
+        meshRenderer->ExpandBounds( meshRenderer->mPreviousMatrix );
+        
     return;
 }
 
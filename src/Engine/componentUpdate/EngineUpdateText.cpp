@@ -29,7 +29,7 @@ void EngineSystemManager::UpdateTextUI(unsigned int index) {
     if (mStreamBuffer[index].meshRenderer == nullptr) 
         return;
     
-    if (mStreamBuffer[index].gameObject->isActive) {
+    if (mStreamBuffer[index].gameObject->GetActive()) {
         
         mStreamBuffer[index].meshRenderer->isActive = true;
         
@@ -2,6 +2,10 @@
 // Update transform components
 
 #include <GameEngineFramework/Engine/Engine.h>
+#include <GameEngineFramework/Math/TransformBatch.h>
+
+#include <unordered_map>
+#include <unordered_set>
 
 ENGINE_API extern EngineComponents  Components;
 ENGINE_API extern ColorPreset       Colors;
@@ -20,55 +24,183 @@ ENGINE_API extern AudioSystem       Audio;
 ENGINE_API extern InputSystem       Input;
 ENGINE_API extern MathCore          Math;
 ENGINE_API extern ActorSystem       AI;
+ENGINE_API extern JobSystem         Jobs;
 
 ENGINE_API extern PlatformLayer     Platform;
 
 
-void EngineSystemManager::UpdateTransformationChains(void) {
+JobHandle EngineSystemManager::UpdateTransformationChains(const JobHandle& dependency) {
     
-    for (unsigned int i=0; i < mStreamSize; i++ ) {
+    // A transform moved to another parent invalidates the order
+    if (!mIsTransformOrderDirty) {
         
-        Transform* current = mStreamBuffer[i].transform;
-        Transform* parent  = mStreamBuffer[i].transform->parent;
+        for (unsigned int i=0; i < mTransformOrder.size(); i++) {
+            
+            if (mTransformOrder[i].transform->parent == mTransformOrder[i].parent) 
+                continue;
+                
+            mIsTransformOrderDirty = true;
+            
+            break;
+        }
         
-        glm::vec3 currentPosition = mStreamBuffer[i].transform->position;
-        glm::quat currentRotation = mStreamBuffer[i].transform->rotation;
-        glm::vec3 currentScale    = mStreamBuffer[i].transform->scale;
+    }
+    
+    if (mIsTransformOrderDirty) 
+        UpdateTransformOrder();
         
-        // Roll over the parent matrix transform chain
+    // Each depth only reads the depth above it so the entries of a depth
+    // are updated in parallel. Unchanged subtrees skip the matrix rebuild
+    JobHandle handle = dependency;
+    
+    for (unsigned int level=0; level < mTransformLevels.size(); level++) {
         
-        // TODO: Rotations should be positioned locally from the
-        //       previous transform rather than the base object.
+        unsigned int first = mTransformLevels[level];
+        unsigned int last  = (level + 1 < mTransformLevels.size()) ? mTransformLevels[level + 1] : mTransformOrder.size();
         
-        while (parent != nullptr) {
+        handle = Jobs.ScheduleParallelFor(last - first, JOB_SYSTEM_GRAIN_SIZE, [this, first](unsigned int begin, unsigned int end) {
             
-            currentPosition += parent->position;
+            PROFILE_ZONE("Transform pass");
             
-            if (parent->inheritParentRotation) 
-                currentRotation *= parent->rotation;
+            FrameArena& arena = FrameArena::GetThreadArena();
+            FrameArenaMarker marker = arena.GetMarker();
             
-            if (parent->inheritParentScale) 
-                currentScale *= parent->scale;
+            {
+                // The matrices which need rebuilding are composed together
+                TransformBatch batch;
+                batch.Reserve(end - begin);
+                
+                for (unsigned int i=first + begin; i < first + end; i++) {
+                    
+                    Transform* transform = mTransformOrder[i].transform;
+                    
+                    if (!transform->UpdateWorldValues( mTransformOrder[i].isStreamed )) 
+                        continue;
+                        
+                    batch.Add(transform->GetWorldPosition(), 
+                              transform->GetWorldRotation(), 
+                              transform->GetWorldScale(), 
+                              transform->inheritParentRotation, 
+                              &transform->matrix, 
+                              &transform->normalMatrix);
+                }
+                
+                batch.Compose();
+            }
             
-            parent = parent->parent;
+            arena.Rewind(marker);
             
-            continue;
+        }, handle);
+        
+    }
+    
+    return handle;
+}
+
+void EngineSystemManager::UpdateTransformOrder(void) {
+    
+    mIsTransformOrderDirty = false;
+    
+    // Depth of every transform reached from the stream
+    std::unordered_map<Transform*, unsigned int> depths;
+    
+    std::vector<Transform*> chain;
+    
+    unsigned int numberOfLevels = 0;
+    
+    for (unsigned int i=0; i < mStreamSize; i++) {
+        
+        // Walk up until a transform with a known depth is found
+        chain.clear();
+        
+        Transform* current = mStreamBuffer[i].transform;
+        
+        unsigned int depth = 0;
+        
+        while (current != nullptr) {
+            
+            std::unordered_map<Transform*, unsigned int>::iterator it = depths.find(current);
+            
+            if (it != depths.end()) {
+                
+                depth = it->second + 1;
+                
+                break;
+            }
+            
+            chain.push_back(current);
+            
+            current = current->parent;
         }
         
-        // Finalize the matrix
-        if (current->inheritParentRotation) {
+        // Assign the depths back down the chain
+        for (unsigned int c=chain.size(); c > 0; c--) {
             
-            current->matrix = glm::toMat4( currentRotation ) * 
-                              glm::translate( glm::mat4(1), currentPosition ) * 
-                              glm::scale( glm::mat4(1), currentScale );
-        } else {
+            depths[ chain[c - 1] ] = depth;
             
-            current->matrix = glm::translate( glm::mat4(1), currentPosition ) * 
-                              glm::toMat4( currentRotation ) * 
-                              glm::scale( glm::mat4(1), currentScale );
+            depth++;
         }
         
-        continue;
+        if (numberOfLevels < depth) 
+            numberOfLevels = depth;
+    }
+    
+    // Count the entries of each depth
+    std::vector<unsigned int> counts(numberOfLevels, 0);
+    
+    for (std::unordered_map<Transform*, unsigned int>::iterator it = depths.begin(); it != depths.end(); ++it) 
+        counts[it->second]++;
+        
+    mTransformLevels.resize(numberOfLevels);
+    
+    unsigned int offset = 0;
+    
+    for (unsigned int level=0; level < numberOfLevels; level++) {
+        
+        mTransformLevels[level] = offset;
+        
+        offset += counts[level];
+        
+        counts[level] = mTransformLevels[level];
+    }
+    
+    // Place the entries by depth
+    mTransformOrder.resize(offset);
+    
+    for (std::unordered_map<Transform*, unsigned int>::iterator it = depths.begin(); it != depths.end(); ++it) {
+        
+        TransformOrderEntry& entry = mTransformOrder[ counts[it->second]++ ];
+        
+        entry.transform  = it->first;
+        entry.parent     = it->first->parent;
+        entry.isStreamed = false;
+    }
+    
+    // Only transforms in the stream need their matrix
+    std::unordered_set<Transform*> streamed;
+    
+    for (unsigned int i=0; i < mStreamSize; i++) 
+        streamed.insert( mStreamBuffer[i].transform );
+        
+    for (unsigned int i=0; i < mTransformOrder.size(); i++) 
+        mTransformOrder[i].isStreamed = (streamed.find( mTransformOrder[i].transform ) != streamed.end());
+        
+    return;
+}
+
+void EngineSystemManager::UpdateSpatialGrid(void) {
+    
+    // The spatial index is not thread safe so it is updated by a single job
+    for (unsigned int i=0; i < mStreamSize; i++) {
+        
+        GameObject* gameObject = mStreamBuffer[i].gameObject;
+        
+        if (!mSpatialGrid.Update( gameObject, glm::vec3( mStreamBuffer[i].transform->matrix[3] ) )) 
+            continue;
+            
+        // Distance limited objects which moved themselves are checked against the camera again
+        if (gameObject->mDistanceIndex != COMPONENT_STREAM_INDEX_NONE) 
+            mMovedGameObjects.push_back( gameObject );
     }
     
     return;
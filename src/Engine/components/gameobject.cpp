@@ -1,14 +1,23 @@
 #include <GameEngineFramework/Engine/components/gameobject.h>
+#include <GameEngineFramework/Engine/Engine.h>
+
+extern EngineSystemManager Engine;
 
 
 GameObject::GameObject() : 
     
     name(""),
-    isActive(true),
-    renderDistance(-1),
     
     mIsGarbage(false),
     
+    mIsActive(true),
+    mRenderDistance(-1),
+    
+    mIsDirty(false),
+    mIsWaitingForStream(false),
+    mStreamIndex(COMPONENT_STREAM_INDEX_NONE),
+    mDistanceIndex(COMPONENT_STREAM_INDEX_NONE),
+    
     mTransformCache(nullptr),
     mCameraCache(nullptr),
     mRigidBodyCache(nullptr),
@@ -20,6 +29,38 @@ GameObject::GameObject() :
 {
 }
 
+void GameObject::SetActive(bool state) {
+    
+    if (mIsActive == state) 
+        return;
+    
+    mIsActive = state;
+    
+    Engine.MarkGameObjectDirty(this);
+    
+    return;
+}
+
+bool GameObject::GetActive(void) {
+    return mIsActive;
+}
+
+void GameObject::SetRenderDistance(float distance) {
+    
+    if (mRenderDistance == distance) 
+        return;
+    
+    mRenderDistance = distance;
+    
+    Engine.MarkGameObjectDirty(this);
+    
+    return;
+}
+
+float GameObject::GetRenderDistance(void) {
+    return mRenderDistance;
+}
+
 
 //
 // Component functions
@@ -76,6 +117,9 @@ void GameObject::AddComponent(Component* component) {
         default: break;
     }
     
+    // Refresh the cached components in the stream buffer
+    Engine.MarkGameObjectDirty(this);
+    
     return;
 }
 
@@ -137,6 +181,8 @@ bool GameObject::RemoveComponent(Component* component) {
             default: break;
         }
         
+        Engine.MarkGameObjectDirty(this);
+        
         return true;
     }
     
@@ -190,8 +236,10 @@ void GameObject::SetPosition(glm::vec3 newPosition) {
 
 void GameObject::Activate(void) {
     
-    renderDistance = -1;
-    isActive = true;
+    mRenderDistance = -1;
+    mIsActive = true;
+    
+    Engine.MarkGameObjectDirty(this);
     
     for (unsigned int i=0; i < mComponentList.size(); i++) {
         
@@ -228,8 +276,10 @@ void GameObject::Activate(void) {
 
 void GameObject::Deactivate(void) {
     
-    renderDistance = -1;
-    isActive = false;
+    mRenderDistance = -1;
+    mIsActive = false;
+    
+    Engine.MarkGameObjectDirty(this);
     
     for (unsigned int i=0; i < mComponentList.size(); i++) {
         
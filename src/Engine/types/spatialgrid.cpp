@@ -0,0 +1,283 @@
+#include <GameEngineFramework/Engine/types/spatialgrid.h>
+
+#include <cmath>
+
+// Bits per axis of a packed cell key
+#define  SPATIAL_GRID_KEY_BITS    21
+#define  SPATIAL_GRID_KEY_MASK    ((1ull << SPATIAL_GRID_KEY_BITS) - 1)
+#define  SPATIAL_GRID_KEY_BIAS    (1 << (SPATIAL_GRID_KEY_BITS - 1))
+
+
+SpatialGrid::SpatialGrid(float cellSize) : 
+    mCellSize(cellSize),
+    mInverseCellSize(1.0f / cellSize)
+{
+}
+
+glm::ivec3 SpatialGrid::GetCell(glm::vec3 position) {
+    
+    return glm::ivec3( (int)std::floor(position.x * mInverseCellSize),
+                       (int)std::floor(position.y * mInverseCellSize),
+                       (int)std::floor(position.z * mInverseCellSize) );
+}
+
+std::uint64_t SpatialGrid::GetCellKey(glm::ivec3 cell) {
+    
+    std::uint64_t x = (std::uint64_t)(cell.x + SPATIAL_GRID_KEY_BIAS) & SPATIAL_GRID_KEY_MASK;
+    std::uint64_t y = (std::uint64_t)(cell.y + SPATIAL_GRID_KEY_BIAS) & SPATIAL_GRID_KEY_MASK;
+    std::uint64_t z = (std::uint64_t)(cell.z + SPATIAL_GRID_KEY_BIAS) & SPATIAL_GRID_KEY_MASK;
+    
+    return x | (y << SPATIAL_GRID_KEY_BITS) | (z << (SPATIAL_GRID_KEY_BITS * 2));
+}
+
+glm::ivec3 SpatialGrid::GetCellFromKey(std::uint64_t key) {
+    
+    int x = (int)( key                                 & SPATIAL_GRID_KEY_MASK) - SPATIAL_GRID_KEY_BIAS;
+    int y = (int)((key >> SPATIAL_GRID_KEY_BITS)       & SPATIAL_GRID_KEY_MASK) - SPATIAL_GRID_KEY_BIAS;
+    int z = (int)((key >> (SPATIAL_GRID_KEY_BITS * 2)) & SPATIAL_GRID_KEY_MASK) - SPATIAL_GRID_KEY_BIAS;
+    
+    return glm::ivec3(x, y, z);
+}
+
+bool SpatialGrid::Update(GameObject* gameObject, glm::vec3 position) {
+    
+    std::uint64_t cell = GetCellKey( GetCell(position) );
+    
+    std::unordered_map<GameObject*, Location>::iterator it = mLocations.find(gameObject);
+    
+    if (it != mLocations.end()) {
+        
+        Location& location = it->second;
+        
+        // Still in the same cell
+        if (location.cell == cell) {
+            
+            mCells[cell][location.slot].position = position;
+            
+            return false;
+        }
+        
+        RemoveFromCell(location.cell, location.slot);
+        
+        std::vector<Item>& items = mCells[cell];
+        
+        location.cell = cell;
+        location.slot = items.size();
+        
+        Item item;
+        item.gameObject = gameObject;
+        item.position   = position;
+        
+        items.push_back(item);
+        
+        return true;
+    }
+    
+    std::vector<Item>& items = mCells[cell];
+    
+    Location location;
+    location.cell = cell;
+    location.slot = items.size();
+    
+    mLocations[gameObject] = location;
+    
+    Item item;
+    item.gameObject = gameObject;
+    item.position   = position;
+    
+    items.push_back(item);
+    
+    return true;
+}
+
+void SpatialGrid::Remove(GameObject* gameObject) {
+    
+    std::unordered_map<GameObject*, Location>::iterator it = mLocations.find(gameObject);
+    
+    if (it == mLocations.end()) 
+        return;
+        
+    Location location = it->second;
+    
+    mLocations.erase(it);
+    
+    RemoveFromCell(location.cell, location.slot);
+    
+    return;
+}
+
+void SpatialGrid::RemoveFromCell(std::uint64_t cell, unsigned int slot) {
+    
+    std::unordered_map<std::uint64_t, std::vector<Item>>::iterator it = mCells.find(cell);
+    
+    if (it == mCells.end()) 
+        return;
+        
+    std::vector<Item>& items = it->second;
+    
+    unsigned int last = items.size() - 1;
+    
+    if (slot != last) {
+        
+        items[slot] = items[last];
+        
+        mLocations[ items[slot].gameObject ].slot = slot;
+    }
+    
+    items.pop_back();
+    
+    // Only occupied cells are kept
+    if (items.size() == 0) 
+        mCells.erase(it);
+        
+    return;
+}
+
+void SpatialGrid::Clear(void) {
+    
+    mCells.clear();
+    mLocations.clear();
+    
+    return;
+}
+
+void SpatialGrid::GatherCells(glm::vec3 min, glm::vec3 max, FrameVector<std::vector<Item>*>& cells) {
+    
+    glm::ivec3 cellMin = GetCell(min);
+    glm::ivec3 cellMax = GetCell(max);
+    
+    double width  = (double)(cellMax.x - cellMin.x + 1);
+    double height = (double)(cellMax.y - cellMin.y + 1);
+    double depth  = (double)(cellMax.z - cellMin.z + 1);
+    
+    // Walk the occupied cells instead when the box covers more
+    // cells than the grid holds
+    if ((width * height * depth) > (double)mCells.size()) {
+        
+        for (std::unordered_map<std::uint64_t, std::vector<Item>>::iterator it = mCells.begin(); it != mCells.end(); ++it) {
+            
+            glm::ivec3 cell = GetCellFromKey(it->first);
+            
+            if ((cell.x < cellMin.x) | (cell.x > cellMax.x)) continue;
+            if ((cell.y < cellMin.y) | (cell.y > cellMax.y)) continue;
+            if ((cell.z < cellMin.z) | (cell.z > cellMax.z)) continue;
+            
+            cells.push_back( &it->second );
+        }
+        
+        return;
+    }
+    
+    for (int z=cellMin.z; z <= cellMax.z; z++) {
+        
+        for (int y=cellMin.y; y <= cellMax.y; y++) {
+            
+            for (int x=cellMin.x; x <= cellMax.x; x++) {
+                
+                std::unordered_map<std::uint64_t, std::vector<Item>>::iterator it = mCells.find( GetCellKey( glm::ivec3(x, y, z) ) );
+                
+                if (it == mCells.end()) 
+                    continue;
+                    
+                cells.push_back( &it->second );
+            }
+            
+        }
+        
+    }
+    
+    return;
+}
+
+unsigned int SpatialGrid::QueryRadius(glm::vec3 position, float radius, std::vector<GameObject*>& results) {
+    
+    FrameArena& arena = FrameArena::GetThreadArena();
+    FrameArenaMarker marker = arena.GetMarker();
+    
+    unsigned int numberOfResults = 0;
+    
+    {
+        FrameVector<std::vector<Item>*> cells;
+        
+        GatherCells(position - glm::vec3(radius), position + glm::vec3(radius), cells);
+        
+        float radiusSquared = radius * radius;
+        
+        for (unsigned int c=0; c < cells.size(); c++) {
+            
+            std::vector<Item>& items = *cells[c];
+            
+            for (unsigned int i=0; i < items.size(); i++) {
+                
+                glm::vec3 delta = items[i].position - position;
+                
+                if (glm::dot(delta, delta) > radiusSquared) 
+                    continue;
+                    
+                results.push_back( items[i].gameObject );
+                
+                numberOfResults++;
+            }
+            
+        }
+        
+    }
+    
+    arena.Rewind(marker);
+    
+    return numberOfResults;
+}
+
+unsigned int SpatialGrid::QueryBox(glm::vec3 min, glm::vec3 max, std::vector<GameObject*>& results) {
+    
+    FrameArena& arena = FrameArena::GetThreadArena();
+    FrameArenaMarker marker = arena.GetMarker();
+    
+    unsigned int numberOfResults = 0;
+    
+    {
+        FrameVector<std::vector<Item>*> cells;
+        
+        GatherCells(min, max, cells);
+        
+        for (unsigned int c=0; c < cells.size(); c++) {
+            
+            std::vector<Item>& items = *cells[c];
+            
+            for (unsigned int i=0; i < items.size(); i++) {
+                
+                glm::vec3& point = items[i].position;
+                
+                if ((point.x < min.x) | (point.x > max.x)) continue;
+                if ((point.y < min.y) | (point.y > max.y)) continue;
+                if ((point.z < min.z) | (point.z > max.z)) continue;
+                
+                results.push_back( items[i].gameObject );
+                
+                numberOfResults++;
+            }
+            
+        }
+        
+    }
+    
+    arena.Rewind(marker);
+    
+    return numberOfResults;
+}
+
+bool SpatialGrid::CheckContains(GameObject* gameObject) {
+    return mLocations.find(gameObject) != mLocations.end();
+}
+
+unsigned int SpatialGrid::GetNumberOfObjects(void) {
+    return mLocations.size();
+}
+
+unsigned int SpatialGrid::GetNumberOfCells(void) {
+    return mCells.size();
+}
+
+float SpatialGrid::GetCellSize(void) {
+    return mCellSize;
+}
@@ -1,13 +1,15 @@
 #include <GameEngineFramework/Input/InputSystem.h>
 
-#ifndef _WIN32_WINNT
-  #define _WIN32_WINNT 0x500
-#endif
+#ifdef _WIN32
+  #ifndef _WIN32_WINNT
+    #define _WIN32_WINNT 0x500
+  #endif
 
-#define WIN32_LEAN_AND_MEAN
+  #define WIN32_LEAN_AND_MEAN
 
-#include <sdkddkver.h>
-#include <windows.h>
+  #include <sdkddkver.h>
+  #include <windows.h>
+#endif
 
 extern InputSystem::InputSystem(void) : 
     
@@ -28,7 +30,10 @@ extern InputSystem::InputSystem(void) :
 }
 
 void InputSystem::SetMousePosition(unsigned int x, unsigned int y) {
+    // Without a window system only the tracked position moves
+#ifdef _WIN32
     SetCursorPos( (int)x, (int)y );
+#endif
     mouseX = x;
     mouseY = y;
     return;
@@ -0,0 +1,603 @@
+#include <GameEngineFramework/JobSystem/JobSystem.h>
+#include <GameEngineFramework/Profiler/profiler.h>
+
+#include <memory>
+
+extern ProfilerTimer Profiler;
+
+// Index of the worker queue owned by the calling thread
+static thread_local int jobWorkerIndex = -1;
+
+// Job system the calling worker thread belongs to
+static thread_local JobSystem* jobWorkerOwner = nullptr;
+
+
+struct Job {
+    
+    JobFunction function;
+    
+    // Jobs which must finish before this job may run, plus one
+    // guard held by the scheduler while the job is being set up
+    std::atomic<int> numberOfDependencies;
+    
+    // Handles and the scheduler each hold a reference
+    std::atomic<int> numberOfReferences;
+    
+    std::atomic<bool> isComplete;
+    
+    bool isMainThread;
+    
+    // Jobs waiting on this job to finish
+    std::vector<Job*> continuations;
+    
+    std::mutex mux;
+    
+};
+
+static void ReleaseJob(Job* job) {
+    
+    if (job->numberOfReferences.fetch_sub(1) == 1) 
+        delete job;
+        
+    return;
+}
+
+
+//
+// Job handle
+//
+
+JobHandle::JobHandle() : 
+    mJob(nullptr)
+{
+}
+
+JobHandle::JobHandle(Job* job) : 
+    mJob(job)
+{
+    if (mJob != nullptr) 
+        mJob->numberOfReferences++;
+        
+    return;
+}
+
+JobHandle::JobHandle(const JobHandle& handle) : 
+    mJob(handle.mJob)
+{
+    if (mJob != nullptr) 
+        mJob->numberOfReferences++;
+        
+    return;
+}
+
+JobHandle::~JobHandle() {
+    
+    if (mJob != nullptr) 
+        ReleaseJob(mJob);
+        
+    return;
+}
+
+JobHandle& JobHandle::operator= (const JobHandle& handle) {
+    
+    if (handle.mJob != nullptr) 
+        handle.mJob->numberOfReferences++;
+        
+    if (mJob != nullptr) 
+        ReleaseJob(mJob);
+        
+    mJob = handle.mJob;
+    
+    return *this;
+}
+
+bool JobHandle::CheckIsComplete(void) const {
+    
+    if (mJob == nullptr) 
+        return true;
+        
+    return mJob->isComplete.load();
+}
+
+bool JobHandle::CheckIsValid(void) const {
+    return mJob != nullptr;
+}
+
+
+//
+// Job system
+//
+
+JobSystem::JobSystem() : 
+    mIsActive(false),
+    mNumberOfQueuedJobs(0),
+    mStealIndex(0)
+{
+}
+
+JobSystem::~JobSystem() {
+    
+    Shutdown();
+    
+    return;
+}
+
+void JobSystem::Initiate(unsigned int numberOfWorkers) {
+    
+    if (mIsActive) 
+        return;
+        
+    if (numberOfWorkers == 0) {
+        
+        unsigned int numberOfThreads = std::thread::hardware_concurrency();
+        
+        if (numberOfThreads > 1) 
+            numberOfWorkers = numberOfThreads - 1;
+    }
+    
+    mMainThreadID = std::this_thread::get_id();
+    
+    mIsActive = true;
+    
+    for (unsigned int i=0; i < numberOfWorkers; i++) 
+        mQueues.push_back( new WorkerQueue() );
+        
+    for (unsigned int i=0; i < numberOfWorkers; i++) 
+        mWorkers.push_back( new std::thread( &JobSystem::WorkerMain, this, i ) );
+        
+    return;
+}
+
+void JobSystem::Shutdown(void) {
+    
+    {
+        std::lock_guard<std::mutex> lock(mux);
+        
+        if (!mIsActive) 
+            return;
+            
+        mIsActive = false;
+    }
+    
+    mWorkReady.notify_all();
+    
+    // Workers leave once the queues have drained
+    for (unsigned int i=0; i < mWorkers.size(); i++) {
+        
+        mWorkers[i]->join();
+        
+        delete mWorkers[i];
+    }
+    
+    mWorkers.clear();
+    
+    for (unsigned int i=0; i < mQueues.size(); i++) 
+        delete mQueues[i];
+        
+    mQueues.clear();
+    
+    // Anything released from here on runs in place
+    for (;;) {
+        
+        bool isEmpty;
+        
+        {
+            std::lock_guard<std::mutex> lock(mMainThreadMux);
+            
+            isEmpty = (mMainThreadJobs.size() == 0);
+        }
+        
+        if (isEmpty) 
+            break;
+            
+        RunMainThreadJobs();
+    }
+    
+    Job* job;
+    while ((job = FindJob()) != nullptr) 
+        Execute(job);
+        
+    return;
+}
+
+Job* JobSystem::CreateJob(const JobFunction& function, bool isMainThread) {
+    
+    Job* job = new Job();
+    
+    job->function     = function;
+    job->isMainThread = isMainThread;
+    
+    job->numberOfDependencies.store(1);
+    job->numberOfReferences.store(1);
+    job->isComplete.store(false);
+    
+    return job;
+}
+
+void JobSystem::AddDependency(Job* job, const JobHandle& dependency) {
+    
+    Job* dependencyJob = dependency.mJob;
+    
+    if (dependencyJob == nullptr) 
+        return;
+        
+    std::lock_guard<std::mutex> lock(dependencyJob->mux);
+    
+    if (dependencyJob->isComplete.load()) 
+        return;
+        
+    job->numberOfDependencies++;
+    
+    dependencyJob->continuations.push_back(job);
+    
+    return;
+}
+
+void JobSystem::Submit(Job* job) {
+    
+    if (job->numberOfDependencies.fetch_sub(1) == 1) 
+        Enqueue(job);
+        
+    return;
+}
+
+void JobSystem::Enqueue(Job* job) {
+    
+    if (job->isMainThread) {
+        
+        std::lock_guard<std::mutex> lock(mMainThreadMux);
+        
+        mMainThreadJobs.push_back(job);
+        
+        return;
+    }
+    
+    // Nothing to hand the job to
+    if (mWorkers.size() == 0) {
+        
+        Execute(job);
+        
+        return;
+    }
+    
+    if (jobWorkerOwner == this) {
+        
+        WorkerQueue* queue = mQueues[jobWorkerIndex];
+        
+        std::lock_guard<std::mutex> lock(queue->mux);
+        
+        queue->jobs.push_back(job);
+        
+    } else {
+        
+        std::lock_guard<std::mutex> lock(mSharedQueue.mux);
+        
+        mSharedQueue.jobs.push_back(job);
+    }
+    
+    {
+        std::lock_guard<std::mutex> lock(mux);
+        
+        mNumberOfQueuedJobs++;
+    }
+    
+    mWorkReady.notify_one();
+    
+    return;
+}
+
+Job* JobSystem::FindJob(void) {
+    
+    Job* job = nullptr;
+    
+    // Newest job first from our own queue while it is still warm in the cache
+    if (jobWorkerOwner == this) {
+        
+        WorkerQueue* queue = mQueues[jobWorkerIndex];
+        
+        std::lock_guard<std::mutex> lock(queue->mux);
+        
+        if (queue->jobs.size() > 0) {
+            
+            job = queue->jobs.back();
+            
+            queue->jobs.pop_back();
+        }
+        
+    }
+    
+    // Jobs submitted from outside the workers
+    if (job == nullptr) {
+        
+        std::lock_guard<std::mutex> lock(mSharedQueue.mux);
+        
+        if (mSharedQueue.jobs.size() > 0) {
+            
+            job = mSharedQueue.jobs.front();
+            
+            mSharedQueue.jobs.pop_front();
+        }
+        
+    }
+    
+    // Steal the oldest job from another worker
+    unsigned int numberOfQueues = mQueues.size();
+    
+    if ((job == nullptr) & (numberOfQueues > 0)) {
+        
+        unsigned int start = mStealIndex.fetch_add(1);
+        
+        for (unsigned int i=0; i < numberOfQueues; i++) {
+            
+            unsigned int index = (start + i) % numberOfQueues;
+            
+            if ((jobWorkerOwner == this) & ((int)index == jobWorkerIndex)) 
+                continue;
+                
+            WorkerQueue* queue = mQueues[index];
+            
+            std::lock_guard<std::mutex> lock(queue->mux);
+            
+            if (queue->jobs.size() == 0) 
+                continue;
+                
+            job = queue->jobs.front();
+            
+            queue->jobs.pop_front();
+            
+            break;
+        }
+        
+    }
+    
+    if (job != nullptr) 
+        mNumberOfQueuedJobs--;
+        
+    return job;
+}
+
+void JobSystem::Execute(Job* job) {
+    
+    if (job->function) 
+        job->function();
+        
+    std::vector<Job*> continuations;
+    
+    {
+        std::lock_guard<std::mutex> lock(job->mux);
+        
+        job->isComplete.store(true);
+        
+        continuations.swap(job->continuations);
+    }
+    
+    for (unsigned int i=0; i < continuations.size(); i++) 
+        Submit(continuations[i]);
+        
+    ReleaseJob(job);
+    
+    return;
+}
+
+void JobSystem::WorkerMain(unsigned int index) {
+    
+    jobWorkerIndex = index;
+    jobWorkerOwner = this;
+    
+    Profiler.SetThreadName("Worker " + std::to_string(index));
+    
+    for (;;) {
+        
+        Job* job = FindJob();
+        
+        if (job != nullptr) {
+            
+            Execute(job);
+            
+            continue;
+        }
+        
+        std::unique_lock<std::mutex> lock(mux);
+        
+        mWorkReady.wait(lock, [this] {return (!mIsActive) | (mNumberOfQueuedJobs.load() > 0);});
+        
+        if ((!mIsActive) & (mNumberOfQueuedJobs.load() <= 0)) 
+            break;
+    }
+    
+    jobWorkerIndex = -1;
+    jobWorkerOwner = nullptr;
+    
+    return;
+}
+
+JobHandle JobSystem::Schedule(const JobFunction& function) {
+    
+    Job* job = CreateJob(function, false);
+    
+    JobHandle handle(job);
+    
+    Submit(job);
+    
+    return handle;
+}
+
+JobHandle JobSystem::Schedule(const JobFunction& function, const JobHandle& dependency) {
+    
+    Job* job = CreateJob(function, false);
+    
+    JobHandle handle(job);
+    
+    AddDependency(job, dependency);
+    
+    Submit(job);
+    
+    return handle;
+}
+
+JobHandle JobSystem::Schedule(const JobFunction& function, const std::vector<JobHandle>& dependencies) {
+    
+    Job* job = CreateJob(function, false);
+    
+    JobHandle handle(job);
+    
+    for (unsigned int i=0; i < dependencies.size(); i++) 
+        AddDependency(job, dependencies[i]);
+        
+    Submit(job);
+    
+    return handle;
+}
+
+JobHandle JobSystem::ScheduleMainThread(const JobFunction& function, const JobHandle& dependency) {
+    
+    Job* job = CreateJob(function, true);
+    
+    JobHandle handle(job);
+    
+    AddDependency(job, dependency);
+    
+    Submit(job);
+    
+    return handle;
+}
+
+JobHandle JobSystem::ScheduleParallelFor(unsigned int count, unsigned int grainSize, const JobRangeFunction& function, const JobHandle& dependency) {
+    
+    if (grainSize == 0) 
+        grainSize = 1;
+        
+    // More chunks than a few per thread only adds scheduling overhead
+    unsigned int maxChunks = (mWorkers.size() + 1) * JOB_SYSTEM_CHUNKS_PER_THREAD;
+    unsigned int minGrain  = (count + maxChunks - 1) / maxChunks;
+    
+    if (grainSize < minGrain) 
+        grainSize = minGrain;
+        
+    // Completes once the last chunk has finished
+    Job* finish = CreateJob(JobFunction(), false);
+    
+    JobHandle handle(finish);
+    
+    std::shared_ptr<JobRangeFunction> rangeFunction = std::make_shared<JobRangeFunction>(function);
+    
+    JobFunction spawnChunks = [this, finish, count, grainSize, rangeFunction]() {
+        
+        for (unsigned int begin=0; begin < count; begin += grainSize) {
+            
+            unsigned int end = begin + grainSize;
+            
+            if (end > count) 
+                end = count;
+                
+            Job* chunk = CreateJob([rangeFunction, begin, end]() {(*rangeFunction)(begin, end);}, false);
+            
+            finish->numberOfDependencies++;
+            
+            chunk->continuations.push_back(finish);
+            
+            Submit(chunk);
+        }
+        
+        Submit(finish);
+        
+    };
+    
+    if (dependency.CheckIsComplete()) {
+        
+        spawnChunks();
+        
+    } else {
+        
+        Job* gate = CreateJob(spawnChunks, false);
+        
+        AddDependency(gate, dependency);
+        
+        Submit(gate);
+    }
+    
+    return handle;
+}
+
+void JobSystem::ParallelFor(unsigned int count, unsigned int grainSize, const JobRangeFunction& function) {
+    
+    if (count == 0) 
+        return;
+        
+    // Run in place when there is nothing to gain from splitting the range
+    if ((mWorkers.size() == 0) | (count <= grainSize)) {
+        
+        function(0, count);
+        
+        return;
+    }
+    
+    Wait( ScheduleParallelFor(count, grainSize, function) );
+    
+    return;
+}
+
+void JobSystem::Wait(const JobHandle& handle) {
+    
+    bool isMainThread = (std::this_thread::get_id() == mMainThreadID);
+    
+    while (!handle.CheckIsComplete()) {
+        
+        Job* job = FindJob();
+        
+        if (job != nullptr) {
+            
+            Execute(job);
+            
+            continue;
+        }
+        
+        // The job may be waiting on work only the main thread can run
+        if (isMainThread) {
+            
+            bool hasMainThreadJobs;
+            
+            {
+                std::lock_guard<std::mutex> lock(mMainThreadMux);
+                
+                hasMainThreadJobs = (mMainThreadJobs.size() > 0);
+            }
+            
+            if (hasMainThreadJobs) {
+                
+                RunMainThreadJobs();
+                
+                continue;
+            }
+            
+        }
+        
+        std::this_thread::yield();
+    }
+    
+    return;
+}
+
+void JobSystem::RunMainThreadJobs(void) {
+    
+    std::vector<Job*> jobs;
+    
+    {
+        std::lock_guard<std::mutex> lock(mMainThreadMux);
+        
+        jobs.swap(mMainThreadJobs);
+    }
+    
+    for (unsigned int i=0; i < jobs.size(); i++) 
+        Execute(jobs[i]);
+        
+    return;
+}
+
+unsigned int JobSystem::GetNumberOfWorkers(void) {
+    return mWorkers.size();
+}
+
+bool JobSystem::CheckIsWorkerThread(void) {
+    return jobWorkerIndex >= 0;
+}
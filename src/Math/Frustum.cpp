@@ -0,0 +1,320 @@
+#include <GameEngineFramework/Math/Frustum.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  #define FRUSTUM_X86
+  #include <immintrin.h>
+#endif
+
+
+namespace {
+
+// Plane components and the box corner each plane is tested against
+struct PlaneArrays {
+    
+    float x[6];
+    float y[6];
+    float z[6];
+    float w[6];
+    
+    // Corner furthest along the normal of each plane
+    const float* cornerX[6];
+    const float* cornerY[6];
+    const float* cornerZ[6];
+};
+
+typedef void(*CheckFunction)(unsigned int begin, unsigned int end, const PlaneArrays& planes, unsigned char* visible);
+
+
+void CheckScalar(unsigned int begin, unsigned int end, const PlaneArrays& planes, unsigned char* visible) {
+    
+    for (unsigned int i=begin; i < end; i++) {
+        
+        unsigned char isVisible = 1;
+        
+        for (unsigned int p=0; p < 6; p++) {
+            
+            float distance = ((planes.x[p] * planes.cornerX[p][i] + planes.y[p] * planes.cornerY[p][i]) + planes.z[p] * planes.cornerZ[p][i]) + planes.w[p];
+            
+            if (distance < 0.0f) {
+                isVisible = 0;
+                break;
+            }
+            
+        }
+        
+        visible[i] = isVisible;
+    }
+    
+    return;
+}
+
+
+#ifdef FRUSTUM_X86
+
+__attribute__((target("sse2")))
+void CheckSSE(unsigned int begin, unsigned int end, const PlaneArrays& planes, unsigned char* visible) {
+    
+    const __m128 zero = _mm_setzero_ps();
+    
+    unsigned int i = begin;
+    
+    for (; i + 4 <= end; i += 4) {
+        
+        __m128 outside = zero;
+        
+        for (unsigned int p=0; p < 6; p++) {
+            
+            __m128 distance = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(planes.x[p]), _mm_loadu_ps(planes.cornerX[p] + i)), 
+                                         _mm_mul_ps(_mm_set1_ps(planes.y[p]), _mm_loadu_ps(planes.cornerY[p] + i)));
+                                         
+            distance = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(planes.z[p]), _mm_loadu_ps(planes.cornerZ[p] + i)));
+            distance = _mm_add_ps(distance, _mm_set1_ps(planes.w[p]));
+            
+            outside = _mm_or_ps(outside, _mm_cmplt_ps(distance, zero));
+        }
+        
+        int mask = _mm_movemask_ps(outside);
+        
+        for (unsigned int b=0; b < 4; b++) 
+            visible[i + b] = ((mask >> b) & 1) ^ 1;
+    }
+    
+    CheckScalar(i, end, planes, visible);
+    
+    return;
+}
+
+__attribute__((target("avx")))
+void CheckAVX(unsigned int begin, unsigned int end, const PlaneArrays& planes, unsigned char* visible) {
+    
+    const __m256 zero = _mm256_setzero_ps();
+    
+    unsigned int i = begin;
+    
+    for (; i + 8 <= end; i += 8) {
+        
+        __m256 outside = zero;
+        
+        for (unsigned int p=0; p < 6; p++) {
+            
+            __m256 distance = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(planes.x[p]), _mm256_loadu_ps(planes.cornerX[p] + i)), 
+                                            _mm256_mul_ps(_mm256_set1_ps(planes.y[p]), _mm256_loadu_ps(planes.cornerY[p] + i)));
+                                            
+            distance = _mm256_add_ps(distance, _mm256_mul_ps(_mm256_set1_ps(planes.z[p]), _mm256_loadu_ps(planes.cornerZ[p] + i)));
+            distance = _mm256_add_ps(distance, _mm256_set1_ps(planes.w[p]));
+            
+            outside = _mm256_or_ps(outside, _mm256_cmp_ps(distance, zero, _CMP_LT_OQ));
+        }
+        
+        int mask = _mm256_movemask_ps(outside);
+        
+        for (unsigned int b=0; b < 8; b++) 
+            visible[i + b] = ((mask >> b) & 1) ^ 1;
+    }
+    
+    CheckSSE(i, end, planes, visible);
+    
+    return;
+}
+
+#endif
+
+
+Frustum::InstructionSet DetectInstructionSet(void) {
+    
+#ifdef FRUSTUM_X86
+    __builtin_cpu_init();
+    
+    if (__builtin_cpu_supports("avx")) 
+        return Frustum::InstructionSet::AVX;
+        
+    if (__builtin_cpu_supports("sse2")) 
+        return Frustum::InstructionSet::SSE;
+#endif
+        
+    return Frustum::InstructionSet::Scalar;
+}
+
+CheckFunction GetCheckFunction(Frustum::InstructionSet instructionSet) {
+    
+#ifdef FRUSTUM_X86
+    switch (instructionSet) {
+        
+        case Frustum::InstructionSet::AVX: return CheckAVX;
+        case Frustum::InstructionSet::SSE: return CheckSSE;
+        
+        default: break;
+    }
+#endif
+    
+    return CheckScalar;
+}
+
+// Selected on first use
+struct Dispatch {
+    
+    Frustum::InstructionSet supported;
+    Frustum::InstructionSet selected;
+    CheckFunction           check;
+    
+    Dispatch() : 
+        supported(DetectInstructionSet()),
+        selected(supported),
+        check(GetCheckFunction(supported))
+    {}
+};
+
+Dispatch& GetDispatch(void) {
+    
+    static Dispatch dispatch;
+    
+    return dispatch;
+}
+
+}
+
+
+Frustum::Frustum() {
+    
+    // Every plane passes everything until a matrix is set
+    for (unsigned int p=0; p < 6; p++) 
+        planes[p] = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+        
+}
+
+void Frustum::SetViewProjection(const glm::mat4& viewProjection) {
+    
+    glm::vec4 rowX(viewProjection[0][0], viewProjection[1][0], viewProjection[2][0], viewProjection[3][0]);
+    glm::vec4 rowY(viewProjection[0][1], viewProjection[1][1], viewProjection[2][1], viewProjection[3][1]);
+    glm::vec4 rowZ(viewProjection[0][2], viewProjection[1][2], viewProjection[2][2], viewProjection[3][2]);
+    glm::vec4 rowW(viewProjection[0][3], viewProjection[1][3], viewProjection[2][3], viewProjection[3][3]);
+    
+    // Clip space runs from -w to w on every axis
+    planes[0] = rowW + rowX;
+    planes[1] = rowW - rowX;
+    planes[2] = rowW + rowY;
+    planes[3] = rowW - rowY;
+    planes[4] = rowW + rowZ;
+    planes[5] = rowW - rowZ;
+    
+    // Normalized so distances are in world units
+    for (unsigned int p=0; p < 6; p++) {
+        
+        float length = glm::length( glm::vec3(planes[p]) );
+        
+        if (length > 0.0f) 
+            planes[p] /= length;
+            
+    }
+    
+    return;
+}
+
+bool Frustum::CheckBox(const glm::vec3& min, const glm::vec3& max) const {
+    
+    for (unsigned int p=0; p < 6; p++) {
+        
+        glm::vec3 corner((planes[p].x >= 0.0f) ? max.x : min.x, 
+                         (planes[p].y >= 0.0f) ? max.y : min.y, 
+                         (planes[p].z >= 0.0f) ? max.z : min.z);
+                         
+        float distance = ((planes[p].x * corner.x + planes[p].y * corner.y) + planes[p].z * corner.z) + planes[p].w;
+        
+        if (distance < 0.0f) 
+            return false;
+            
+    }
+    
+    return true;
+}
+
+bool Frustum::CheckBoxPlanes(const glm::vec3& min, const glm::vec3& max, unsigned int& planeMask) const {
+    
+    for (unsigned int p=0; p < 6; p++) {
+        
+        unsigned int planeBit = 1 << p;
+        
+        if ((planeMask & planeBit) == 0) 
+            continue;
+            
+        // Corners furthest along and furthest against the normal
+        glm::vec3 positiveCorner((planes[p].x >= 0.0f) ? max.x : min.x, 
+                                 (planes[p].y >= 0.0f) ? max.y : min.y, 
+                                 (planes[p].z >= 0.0f) ? max.z : min.z);
+        
+        glm::vec3 negativeCorner((planes[p].x >= 0.0f) ? min.x : max.x, 
+                                 (planes[p].y >= 0.0f) ? min.y : max.y, 
+                                 (planes[p].z >= 0.0f) ? min.z : max.z);
+        
+        float distance = ((planes[p].x * positiveCorner.x + planes[p].y * positiveCorner.y) + planes[p].z * positiveCorner.z) + planes[p].w;
+        
+        if (distance < 0.0f) 
+            return false;
+            
+        distance = ((planes[p].x * negativeCorner.x + planes[p].y * negativeCorner.y) + planes[p].z * negativeCorner.z) + planes[p].w;
+        
+        if (distance >= 0.0f) 
+            planeMask &= ~planeBit;
+            
+    }
+    
+    return true;
+}
+
+bool Frustum::CheckSphere(const glm::vec3& center, float radius) const {
+    
+    for (unsigned int p=0; p < 6; p++) {
+        
+        if (glm::dot( glm::vec3(planes[p]), center ) + planes[p].w < -radius) 
+            return false;
+            
+    }
+    
+    return true;
+}
+
+void Frustum::CheckBoxes(const BoxArrays& boxes, unsigned int count, unsigned char* visible) const {
+    
+    if (count == 0) 
+        return;
+        
+    PlaneArrays arrays;
+    
+    // The sign of a plane normal picks the same corner for every box
+    for (unsigned int p=0; p < 6; p++) {
+        
+        arrays.x[p] = planes[p].x;
+        arrays.y[p] = planes[p].y;
+        arrays.z[p] = planes[p].z;
+        arrays.w[p] = planes[p].w;
+        
+        arrays.cornerX[p] = (planes[p].x >= 0.0f) ? boxes.maxX : boxes.minX;
+        arrays.cornerY[p] = (planes[p].y >= 0.0f) ? boxes.maxY : boxes.minY;
+        arrays.cornerZ[p] = (planes[p].z >= 0.0f) ? boxes.maxZ : boxes.minZ;
+    }
+    
+    GetDispatch().check(0, count, arrays, visible);
+    
+    return;
+}
+
+Frustum::InstructionSet Frustum::GetInstructionSet(void) {
+    return GetDispatch().selected;
+}
+
+void Frustum::SetInstructionSet(InstructionSet instructionSet) {
+    
+    Dispatch& dispatch = GetDispatch();
+    
+    if ((int)instructionSet > (int)dispatch.supported) 
+        instructionSet = dispatch.supported;
+        
+    dispatch.selected = instructionSet;
+    dispatch.check    = GetCheckFunction(instructionSet);
+    
+    return;
+}
+
+Frustum::InstructionSet Frustum::GetSupportedInstructionSet(void) {
+    return GetDispatch().supported;
+}
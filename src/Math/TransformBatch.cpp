@@ -0,0 +1,594 @@
+#include <GameEngineFramework/Math/TransformBatch.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  #define TRANSFORM_BATCH_X86
+  #include <immintrin.h>
+#endif
+
+
+namespace {
+
+// Source arrays and destinations of a batch
+struct BatchArrays {
+    
+    const float* positionX;
+    const float* positionY;
+    const float* positionZ;
+    
+    const float* rotationX;
+    const float* rotationY;
+    const float* rotationZ;
+    const float* rotationW;
+    
+    const float* scaleX;
+    const float* scaleY;
+    const float* scaleZ;
+    
+    const float* rotateTranslation;
+    
+    glm::mat4* const* matrices;
+    glm::mat3* const* normalMatrices;
+};
+
+typedef void(*ComposeFunction)(unsigned int begin, unsigned int end, const BatchArrays& arrays);
+
+
+void ComposeScalar(unsigned int begin, unsigned int end, const BatchArrays& arrays) {
+    
+    for (unsigned int i=begin; i < end; i++) {
+        
+        glm::vec3 position(arrays.positionX[i], arrays.positionY[i], arrays.positionZ[i]);
+        glm::quat rotation(arrays.rotationW[i], arrays.rotationX[i], arrays.rotationY[i], arrays.rotationZ[i]);
+        glm::vec3 scale(arrays.scaleX[i], arrays.scaleY[i], arrays.scaleZ[i]);
+        
+        TransformBatch::ComposeMatrix(position, rotation, scale, arrays.rotateTranslation[i] != 0.0f, *arrays.matrices[i], *arrays.normalMatrices[i]);
+    }
+    
+    return;
+}
+
+
+#ifdef TRANSFORM_BATCH_X86
+
+// Scatter four composed transforms held one component per register. Inlined
+// so the AVX2 kernel stores with VEX encoded instructions
+__attribute__((target("sse2"), always_inline))
+inline void StoreSSE(const __m128* m, const __m128* n, glm::mat4* const* matrices, glm::mat3* const* normalMatrices) {
+    
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one  = _mm_set1_ps(1.0f);
+    
+    // Matrix columns
+    for (unsigned int c=0; c < 4; c++) {
+        
+        __m128 x = m[c * 3 + 0];
+        __m128 y = m[c * 3 + 1];
+        __m128 z = m[c * 3 + 2];
+        __m128 w = (c == 3) ? one : zero;
+        
+        _MM_TRANSPOSE4_PS(x, y, z, w);
+        
+        _mm_storeu_ps(&(*matrices[0])[c][0], x);
+        _mm_storeu_ps(&(*matrices[1])[c][0], y);
+        _mm_storeu_ps(&(*matrices[2])[c][0], z);
+        _mm_storeu_ps(&(*matrices[3])[c][0], w);
+    }
+    
+    // The nine normal matrix components are packed as two groups of four and one remainder
+    __m128 a0 = n[0];
+    __m128 a1 = n[1];
+    __m128 a2 = n[2];
+    __m128 a3 = n[3];
+    
+    _MM_TRANSPOSE4_PS(a0, a1, a2, a3);
+    
+    __m128 b0 = n[4];
+    __m128 b1 = n[5];
+    __m128 b2 = n[6];
+    __m128 b3 = n[7];
+    
+    _MM_TRANSPOSE4_PS(b0, b1, b2, b3);
+    
+    float last[4];
+    _mm_storeu_ps(last, n[8]);
+    
+    const __m128 low[4]  = {a0, a1, a2, a3};
+    const __m128 high[4] = {b0, b1, b2, b3};
+    
+    for (unsigned int e=0; e < 4; e++) {
+        
+        float* normal = &(*normalMatrices[e])[0][0];
+        
+        _mm_storeu_ps(normal,     low[e]);
+        _mm_storeu_ps(normal + 4, high[e]);
+        
+        normal[8] = last[e];
+    }
+    
+    return;
+}
+
+__attribute__((target("sse2")))
+void ComposeSSE(unsigned int begin, unsigned int end, const BatchArrays& arrays) {
+    
+    const __m128 one  = _mm_set1_ps(1.0f);
+    const __m128 two  = _mm_set1_ps(2.0f);
+    const __m128 zero = _mm_setzero_ps();
+    
+    unsigned int i = begin;
+    
+    for (; i + 4 <= end; i += 4) {
+        
+        __m128 px = _mm_loadu_ps(arrays.positionX + i);
+        __m128 py = _mm_loadu_ps(arrays.positionY + i);
+        __m128 pz = _mm_loadu_ps(arrays.positionZ + i);
+        
+        __m128 qx = _mm_loadu_ps(arrays.rotationX + i);
+        __m128 qy = _mm_loadu_ps(arrays.rotationY + i);
+        __m128 qz = _mm_loadu_ps(arrays.rotationZ + i);
+        __m128 qw = _mm_loadu_ps(arrays.rotationW + i);
+        
+        __m128 sx = _mm_loadu_ps(arrays.scaleX + i);
+        __m128 sy = _mm_loadu_ps(arrays.scaleY + i);
+        __m128 sz = _mm_loadu_ps(arrays.scaleZ + i);
+        
+        __m128 rotateTranslation = _mm_cmpneq_ps(_mm_loadu_ps(arrays.rotateTranslation + i), zero);
+        
+        // Rotation matrix from the quaternion
+        __m128 xx = _mm_mul_ps(qx, qx);
+        __m128 yy = _mm_mul_ps(qy, qy);
+        __m128 zz = _mm_mul_ps(qz, qz);
+        __m128 xy = _mm_mul_ps(qx, qy);
+        __m128 xz = _mm_mul_ps(qx, qz);
+        __m128 yz = _mm_mul_ps(qy, qz);
+        __m128 wx = _mm_mul_ps(qw, qx);
+        __m128 wy = _mm_mul_ps(qw, qy);
+        __m128 wz = _mm_mul_ps(qw, qz);
+        
+        __m128 r00 = _mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(yy, zz)));
+        __m128 r01 = _mm_mul_ps(two, _mm_add_ps(xy, wz));
+        __m128 r02 = _mm_mul_ps(two, _mm_sub_ps(xz, wy));
+        
+        __m128 r10 = _mm_mul_ps(two, _mm_sub_ps(xy, wz));
+        __m128 r11 = _mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, zz)));
+        __m128 r12 = _mm_mul_ps(two, _mm_add_ps(yz, wx));
+        
+        __m128 r20 = _mm_mul_ps(two, _mm_add_ps(xz, wy));
+        __m128 r21 = _mm_mul_ps(two, _mm_sub_ps(yz, wx));
+        __m128 r22 = _mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, yy)));
+        
+        __m128 m[12];
+        
+        // Rotation and scale
+        m[0] = _mm_mul_ps(r00, sx);  m[1]  = _mm_mul_ps(r01, sx);  m[2]  = _mm_mul_ps(r02, sx);
+        m[3] = _mm_mul_ps(r10, sy);  m[4]  = _mm_mul_ps(r11, sy);  m[5]  = _mm_mul_ps(r12, sy);
+        m[6] = _mm_mul_ps(r20, sz);  m[7]  = _mm_mul_ps(r21, sz);  m[8]  = _mm_mul_ps(r22, sz);
+        
+        // Translation, rotated when the rotation is applied first
+        __m128 tx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(r00, px), _mm_mul_ps(r10, py)), _mm_mul_ps(r20, pz));
+        __m128 ty = _mm_add_ps(_mm_add_ps(_mm_mul_ps(r01, px), _mm_mul_ps(r11, py)), _mm_mul_ps(r21, pz));
+        __m128 tz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(r02, px), _mm_mul_ps(r12, py)), _mm_mul_ps(r22, pz));
+        
+        m[9]  = _mm_or_ps(_mm_and_ps(rotateTranslation, tx), _mm_andnot_ps(rotateTranslation, px));
+        m[10] = _mm_or_ps(_mm_and_ps(rotateTranslation, ty), _mm_andnot_ps(rotateTranslation, py));
+        m[11] = _mm_or_ps(_mm_and_ps(rotateTranslation, tz), _mm_andnot_ps(rotateTranslation, pz));
+        
+        // Normal matrix columns are the cross products of the other two columns over the determinant
+        __m128 n[9];
+        
+        n[0] = _mm_sub_ps(_mm_mul_ps(m[4], m[8]), _mm_mul_ps(m[5], m[7]));
+        n[1] = _mm_sub_ps(_mm_mul_ps(m[5], m[6]), _mm_mul_ps(m[3], m[8]));
+        n[2] = _mm_sub_ps(_mm_mul_ps(m[3], m[7]), _mm_mul_ps(m[4], m[6]));
+        
+        n[3] = _mm_sub_ps(_mm_mul_ps(m[7], m[2]), _mm_mul_ps(m[8], m[1]));
+        n[4] = _mm_sub_ps(_mm_mul_ps(m[8], m[0]), _mm_mul_ps(m[6], m[2]));
+        n[5] = _mm_sub_ps(_mm_mul_ps(m[6], m[1]), _mm_mul_ps(m[7], m[0]));
+        
+        n[6] = _mm_sub_ps(_mm_mul_ps(m[1], m[5]), _mm_mul_ps(m[2], m[4]));
+        n[7] = _mm_sub_ps(_mm_mul_ps(m[2], m[3]), _mm_mul_ps(m[0], m[5]));
+        n[8] = _mm_sub_ps(_mm_mul_ps(m[0], m[4]), _mm_mul_ps(m[1], m[3]));
+        
+        __m128 determinant = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m[0], n[0]), _mm_mul_ps(m[1], n[1])), _mm_mul_ps(m[2], n[2]));
+        
+        // A degenerate scale leaves a zero normal matrix
+        __m128 isSingular = _mm_cmpeq_ps(determinant, zero);
+        __m128 inverse    = _mm_andnot_ps(isSingular, _mm_div_ps(one, _mm_or_ps(_mm_and_ps(isSingular, one), determinant)));
+        
+        for (unsigned int c=0; c < 9; c++) 
+            n[c] = _mm_mul_ps(n[c], inverse);
+            
+        StoreSSE(m, n, arrays.matrices + i, arrays.normalMatrices + i);
+    }
+    
+    ComposeScalar(i, end, arrays);
+    
+    return;
+}
+
+__attribute__((target("avx2,fma")))
+void ComposeAVX2(unsigned int begin, unsigned int end, const BatchArrays& arrays) {
+    
+    const __m256 one  = _mm256_set1_ps(1.0f);
+    const __m256 two  = _mm256_set1_ps(2.0f);
+    const __m256 zero = _mm256_setzero_ps();
+    
+    unsigned int i = begin;
+    
+    for (; i + 8 <= end; i += 8) {
+        
+        __m256 px = _mm256_loadu_ps(arrays.positionX + i);
+        __m256 py = _mm256_loadu_ps(arrays.positionY + i);
+        __m256 pz = _mm256_loadu_ps(arrays.positionZ + i);
+        
+        __m256 qx = _mm256_loadu_ps(arrays.rotationX + i);
+        __m256 qy = _mm256_loadu_ps(arrays.rotationY + i);
+        __m256 qz = _mm256_loadu_ps(arrays.rotationZ + i);
+        __m256 qw = _mm256_loadu_ps(arrays.rotationW + i);
+        
+        __m256 sx = _mm256_loadu_ps(arrays.scaleX + i);
+        __m256 sy = _mm256_loadu_ps(arrays.scaleY + i);
+        __m256 sz = _mm256_loadu_ps(arrays.scaleZ + i);
+        
+        __m256 rotateTranslation = _mm256_cmp_ps(_mm256_loadu_ps(arrays.rotateTranslation + i), zero, _CMP_NEQ_OQ);
+        
+        // Rotation matrix from the quaternion
+        __m256 xx = _mm256_mul_ps(qx, qx);
+        __m256 yy = _mm256_mul_ps(qy, qy);
+        __m256 zz = _mm256_mul_ps(qz, qz);
+        __m256 xy = _mm256_mul_ps(qx, qy);
+        __m256 xz = _mm256_mul_ps(qx, qz);
+        __m256 yz = _mm256_mul_ps(qy, qz);
+        __m256 wx = _mm256_mul_ps(qw, qx);
+        __m256 wy = _mm256_mul_ps(qw, qy);
+        __m256 wz = _mm256_mul_ps(qw, qz);
+        
+        __m256 r00 = _mm256_fnmadd_ps(two, _mm256_add_ps(yy, zz), one);
+        __m256 r01 = _mm256_mul_ps(two, _mm256_add_ps(xy, wz));
+        __m256 r02 = _mm256_mul_ps(two, _mm256_sub_ps(xz, wy));
+        
+        __m256 r10 = _mm256_mul_ps(two, _mm256_sub_ps(xy, wz));
+        __m256 r11 = _mm256_fnmadd_ps(two, _mm256_add_ps(xx, zz), one);
+        __m256 r12 = _mm256_mul_ps(two, _mm256_add_ps(yz, wx));
+        
+        __m256 r20 = _mm256_mul_ps(two, _mm256_add_ps(xz, wy));
+        __m256 r21 = _mm256_mul_ps(two, _mm256_sub_ps(yz, wx));
+        __m256 r22 = _mm256_fnmadd_ps(two, _mm256_add_ps(xx, yy), one);
+        
+        __m256 m[12];
+        
+        // Rotation and scale
+        m[0] = _mm256_mul_ps(r00, sx);  m[1]  = _mm256_mul_ps(r01, sx);  m[2]  = _mm256_mul_ps(r02, sx);
+        m[3] = _mm256_mul_ps(r10, sy);  m[4]  = _mm256_mul_ps(r11, sy);  m[5]  = _mm256_mul_ps(r12, sy);
+        m[6] = _mm256_mul_ps(r20, sz);  m[7]  = _mm256_mul_ps(r21, sz);  m[8]  = _mm256_mul_ps(r22, sz);
+        
+        // Translation, rotated when the rotation is applied first
+        __m256 tx = _mm256_fmadd_ps(r20, pz, _mm256_fmadd_ps(r10, py, _mm256_mul_ps(r00, px)));
+        __m256 ty = _mm256_fmadd_ps(r21, pz, _mm256_fmadd_ps(r11, py, _mm256_mul_ps(r01, px)));
+        __m256 tz = _mm256_fmadd_ps(r22, pz, _mm256_fmadd_ps(r12, py, _mm256_mul_ps(r02, px)));
+        
+        m[9]  = _mm256_blendv_ps(px, tx, rotateTranslation);
+        m[10] = _mm256_blendv_ps(py, ty, rotateTranslation);
+        m[11] = _mm256_blendv_ps(pz, tz, rotateTranslation);
+        
+        // Normal matrix columns are the cross products of the other two columns over the determinant
+        __m256 n[9];
+        
+        n[0] = _mm256_fmsub_ps(m[4], m[8], _mm256_mul_ps(m[5], m[7]));
+        n[1] = _mm256_fmsub_ps(m[5], m[6], _mm256_mul_ps(m[3], m[8]));
+        n[2] = _mm256_fmsub_ps(m[3], m[7], _mm256_mul_ps(m[4], m[6]));
+        
+        n[3] = _mm256_fmsub_ps(m[7], m[2], _mm256_mul_ps(m[8], m[1]));
+        n[4] = _mm256_fmsub_ps(m[8], m[0], _mm256_mul_ps(m[6], m[2]));
+        n[5] = _mm256_fmsub_ps(m[6], m[1], _mm256_mul_ps(m[7], m[0]));
+        
+        n[6] = _mm256_fmsub_ps(m[1], m[5], _mm256_mul_ps(m[2], m[4]));
+        n[7] = _mm256_fmsub_ps(m[2], m[3], _mm256_mul_ps(m[0], m[5]));
+        n[8] = _mm256_fmsub_ps(m[0], m[4], _mm256_mul_ps(m[1], m[3]));
+        
+        __m256 determinant = _mm256_fmadd_ps(m[2], n[2], _mm256_fmadd_ps(m[1], n[1], _mm256_mul_ps(m[0], n[0])));
+        
+        // A degenerate scale leaves a zero normal matrix
+        __m256 isSingular = _mm256_cmp_ps(determinant, zero, _CMP_EQ_OQ);
+        __m256 inverse    = _mm256_andnot_ps(isSingular, _mm256_div_ps(one, _mm256_blendv_ps(determinant, one, isSingular)));
+        
+        for (unsigned int c=0; c < 9; c++) 
+            n[c] = _mm256_mul_ps(n[c], inverse);
+            
+        // Store as two groups of four
+        __m128 lowMatrix[12];
+        __m128 highMatrix[12];
+        
+        for (unsigned int c=0; c < 12; c++) {
+            
+            lowMatrix[c]  = _mm256_castps256_ps128(m[c]);
+            highMatrix[c] = _mm256_extractf128_ps(m[c], 1);
+        }
+        
+        __m128 lowNormal[9];
+        __m128 highNormal[9];
+        
+        for (unsigned int c=0; c < 9; c++) {
+            
+            lowNormal[c]  = _mm256_castps256_ps128(n[c]);
+            highNormal[c] = _mm256_extractf128_ps(n[c], 1);
+        }
+        
+        StoreSSE(lowMatrix,  lowNormal,  arrays.matrices + i,     arrays.normalMatrices + i);
+        StoreSSE(highMatrix, highNormal, arrays.matrices + i + 4, arrays.normalMatrices + i + 4);
+    }
+    
+    ComposeSSE(i, end, arrays);
+    
+    return;
+}
+
+#endif
+
+
+TransformBatch::InstructionSet DetectInstructionSet(void) {
+    
+#ifdef TRANSFORM_BATCH_X86
+    __builtin_cpu_init();
+    
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) 
+        return TransformBatch::InstructionSet::AVX2;
+        
+    if (__builtin_cpu_supports("sse2")) 
+        return TransformBatch::InstructionSet::SSE;
+#endif
+        
+    return TransformBatch::InstructionSet::Scalar;
+}
+
+ComposeFunction GetComposeFunction(TransformBatch::InstructionSet instructionSet) {
+    
+#ifdef TRANSFORM_BATCH_X86
+    switch (instructionSet) {
+        
+        case TransformBatch::InstructionSet::AVX2: return ComposeAVX2;
+        case TransformBatch::InstructionSet::SSE:  return ComposeSSE;
+        
+        default: break;
+    }
+#endif
+    
+    return ComposeScalar;
+}
+
+// Selected on first use
+struct Dispatch {
+    
+    TransformBatch::InstructionSet supported;
+    TransformBatch::InstructionSet selected;
+    ComposeFunction                compose;
+    
+    Dispatch() : 
+        supported(DetectInstructionSet()),
+        selected(supported),
+        compose(GetComposeFunction(supported))
+    {}
+};
+
+Dispatch& GetDispatch(void) {
+    
+    static Dispatch dispatch;
+    
+    return dispatch;
+}
+
+}
+
+
+void TransformBatch::Add(glm::vec3 position, glm::quat rotation, glm::vec3 scale, bool rotateTranslation, glm::mat4* matrix, glm::mat3* normalMatrix) {
+    
+    mPositionX.push_back(position.x);
+    mPositionY.push_back(position.y);
+    mPositionZ.push_back(position.z);
+    
+    mRotationX.push_back(rotation.x);
+    mRotationY.push_back(rotation.y);
+    mRotationZ.push_back(rotation.z);
+    mRotationW.push_back(rotation.w);
+    
+    mScaleX.push_back(scale.x);
+    mScaleY.push_back(scale.y);
+    mScaleZ.push_back(scale.z);
+    
+    mRotateTranslation.push_back(rotateTranslation ? 1.0f : 0.0f);
+    
+    mMatrices.push_back(matrix);
+    mNormalMatrices.push_back(normalMatrix);
+    
+    return;
+}
+
+void TransformBatch::Compose(void) {
+    
+    if (mMatrices.size() == 0) 
+        return;
+        
+    BatchArrays arrays;
+    
+    arrays.positionX = mPositionX.data();
+    arrays.positionY = mPositionY.data();
+    arrays.positionZ = mPositionZ.data();
+    
+    arrays.rotationX = mRotationX.data();
+    arrays.rotationY = mRotationY.data();
+    arrays.rotationZ = mRotationZ.data();
+    arrays.rotationW = mRotationW.data();
+    
+    arrays.scaleX = mScaleX.data();
+    arrays.scaleY = mScaleY.data();
+    arrays.scaleZ = mScaleZ.data();
+    
+    arrays.rotateTranslation = mRotateTranslation.data();
+    
+    arrays.matrices       = mMatrices.data();
+    arrays.normalMatrices = mNormalMatrices.data();
+    
+    GetDispatch().compose(0, mMatrices.size(), arrays);
+    
+    Clear();
+    
+    return;
+}
+
+void TransformBatch::Reserve(unsigned int count) {
+    
+    mPositionX.reserve(count);
+    mPositionY.reserve(count);
+    mPositionZ.reserve(count);
+    
+    mRotationX.reserve(count);
+    mRotationY.reserve(count);
+    mRotationZ.reserve(count);
+    mRotationW.reserve(count);
+    
+    mScaleX.reserve(count);
+    mScaleY.reserve(count);
+    mScaleZ.reserve(count);
+    
+    mRotateTranslation.reserve(count);
+    
+    mMatrices.reserve(count);
+    mNormalMatrices.reserve(count);
+    
+    return;
+}
+
+void TransformBatch::Clear(void) {
+    
+    mPositionX.clear();
+    mPositionY.clear();
+    mPositionZ.clear();
+    
+    mRotationX.clear();
+    mRotationY.clear();
+    mRotationZ.clear();
+    mRotationW.clear();
+    
+    mScaleX.clear();
+    mScaleY.clear();
+    mScaleZ.clear();
+    
+    mRotateTranslation.clear();
+    
+    mMatrices.clear();
+    mNormalMatrices.clear();
+    
+    return;
+}
+
+unsigned int TransformBatch::Size(void) {
+    return mMatrices.size();
+}
+
+void TransformBatch::ComposeMatrix(glm::vec3 position, glm::quat rotation, glm::vec3 scale, bool rotateTranslation, glm::mat4& matrix, glm::mat3& normalMatrix) {
+    
+    float xx = rotation.x * rotation.x;
+    float yy = rotation.y * rotation.y;
+    float zz = rotation.z * rotation.z;
+    float xy = rotation.x * rotation.y;
+    float xz = rotation.x * rotation.z;
+    float yz = rotation.y * rotation.z;
+    float wx = rotation.w * rotation.x;
+    float wy = rotation.w * rotation.y;
+    float wz = rotation.w * rotation.z;
+    
+    glm::vec3 column0(1.0f - 2.0f * (yy + zz), 2.0f * (xy + wz), 2.0f * (xz - wy));
+    glm::vec3 column1(2.0f * (xy - wz), 1.0f - 2.0f * (xx + zz), 2.0f * (yz + wx));
+    glm::vec3 column2(2.0f * (xz + wy), 2.0f * (yz - wx), 1.0f - 2.0f * (xx + yy));
+    
+    glm::vec3 translation = position;
+    
+    if (rotateTranslation) 
+        translation = column0 * position.x + column1 * position.y + column2 * position.z;
+        
+    matrix[0] = glm::vec4(column0 * scale.x, 0.0f);
+    matrix[1] = glm::vec4(column1 * scale.y, 0.0f);
+    matrix[2] = glm::vec4(column2 * scale.z, 0.0f);
+    matrix[3] = glm::vec4(translation, 1.0f);
+    
+    normalMatrix = CalculateNormalMatrix(matrix);
+    
+    return;
+}
+
+glm::mat3 TransformBatch::CalculateNormalMatrix(const glm::mat4& matrix) {
+    
+    glm::vec3 column0(matrix[0]);
+    glm::vec3 column1(matrix[1]);
+    glm::vec3 column2(matrix[2]);
+    
+    // The inverse transpose columns are the cross products of the other two columns over the determinant
+    glm::vec3 normal0 = glm::cross(column1, column2);
+    glm::vec3 normal1 = glm::cross(column2, column0);
+    glm::vec3 normal2 = glm::cross(column0, column1);
+    
+    float determinant = glm::dot(column0, normal0);
+    
+    // A degenerate scale leaves a zero normal matrix
+    float inverse = (determinant != 0.0f) ? (1.0f / determinant) : 0.0f;
+    
+    return glm::mat3(normal0 * inverse, normal1 * inverse, normal2 * inverse);
+}
+
+glm::mat4 TransformBatch::InterpolateMatrix(const glm::mat4& from, const glm::mat4& to, float factor) {
+    
+    if (factor <= 0.0f) 
+        return from;
+    
+    if (factor >= 1.0f) 
+        return to;
+    
+    glm::vec3 fromScale( glm::length(glm::vec3(from[0])), glm::length(glm::vec3(from[1])), glm::length(glm::vec3(from[2])) );
+    glm::vec3 toScale  ( glm::length(glm::vec3(to[0])),   glm::length(glm::vec3(to[1])),   glm::length(glm::vec3(to[2])) );
+    
+    // A collapsed axis has no rotation to recover
+    if ((fromScale.x == 0.0f) | (fromScale.y == 0.0f) | (fromScale.z == 0.0f) | 
+        (toScale.x   == 0.0f) | (toScale.y   == 0.0f) | (toScale.z   == 0.0f)) 
+        return (factor < 0.5f) ? from : to;
+    
+    // Mirrored matrices keep the reflection in the scale
+    if (glm::determinant(glm::mat3(from)) < 0.0f) fromScale.x = -fromScale.x;
+    if (glm::determinant(glm::mat3(to))   < 0.0f) toScale.x   = -toScale.x;
+    
+    glm::quat fromRotation = glm::quat_cast( glm::mat3(glm::vec3(from[0]) / fromScale.x, glm::vec3(from[1]) / fromScale.y, glm::vec3(from[2]) / fromScale.z) );
+    glm::quat toRotation   = glm::quat_cast( glm::mat3(glm::vec3(to[0])   / toScale.x,   glm::vec3(to[1])   / toScale.y,   glm::vec3(to[2])   / toScale.z) );
+    
+    glm::quat rotation    = glm::slerp(fromRotation, toRotation, factor);
+    glm::vec3 scale       = glm::mix(fromScale, toScale, factor);
+    glm::vec3 translation = glm::mix(glm::vec3(from[3]), glm::vec3(to[3]), factor);
+    
+    glm::mat3 basis = glm::mat3_cast(rotation);
+    
+    glm::mat4 matrix(1.0f);
+    matrix[0] = glm::vec4(basis[0] * scale.x, 0.0f);
+    matrix[1] = glm::vec4(basis[1] * scale.y, 0.0f);
+    matrix[2] = glm::vec4(basis[2] * scale.z, 0.0f);
+    matrix[3] = glm::vec4(translation, 1.0f);
+    
+    return matrix;
+}
+
+TransformBatch::InstructionSet TransformBatch::GetInstructionSet(void) {
+    return GetDispatch().selected;
+}
+
+void TransformBatch::SetInstructionSet(InstructionSet instructionSet) {
+    
+    Dispatch& dispatch = GetDispatch();
+    
+    if ((int)instructionSet > (int)dispatch.supported) 
+        instructionSet = dispatch.supported;
+        
+    dispatch.selected = instructionSet;
+    dispatch.compose  = GetComposeFunction(instructionSet);
+    
+    return;
+}
+
+TransformBatch::InstructionSet TransformBatch::GetSupportedInstructionSet(void) {
+    return GetDispatch().supported;
+}
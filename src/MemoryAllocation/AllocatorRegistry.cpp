@@ -0,0 +1,187 @@
+#include <GameEngineFramework/MemoryAllocation/AllocatorRegistry.h>
+
+#include <cstdlib>
+#include <fstream>
+
+#ifdef __GNUC__
+ #include <cxxabi.h>
+#endif
+
+
+AllocatorRegistry::AllocatorRegistry() : 
+    mLastSample(std::chrono::steady_clock::now())
+{
+}
+
+AllocatorRegistry& AllocatorRegistry::Get(void) {
+    
+    // Constructed on first use so allocators in static
+    // storage may register during static initialization
+    static AllocatorRegistry registry;
+    
+    return registry;
+}
+
+std::string AllocatorRegistry::GetTypeName(const char* typeName) {
+    
+#ifdef __GNUC__
+    int status = 0;
+    char* demangled = abi::__cxa_demangle(typeName, nullptr, nullptr, &status);
+    
+    if ((status == 0) & (demangled != nullptr)) {
+        
+        std::string name(demangled);
+        
+        free(demangled);
+        
+        return name;
+    }
+#endif
+    
+    return std::string(typeName);
+}
+
+void AllocatorRegistry::Register(void* allocator, const std::string& name, AllocatorQueryFunction query) {
+    
+    std::lock_guard<std::mutex> lock(mux);
+    
+    Entry entry;
+    entry.allocator     = allocator;
+    entry.name          = name;
+    entry.query         = query;
+    entry.lastCreated   = 0;
+    entry.lastDestroyed = 0;
+    entry.createRate    = 0;
+    entry.destroyRate   = 0;
+    
+    mEntries.push_back(entry);
+    
+    return;
+}
+
+void AllocatorRegistry::Unregister(void* allocator) {
+    
+    std::lock_guard<std::mutex> lock(mux);
+    
+    for (unsigned int i=0; i < mEntries.size(); i++) {
+        
+        if (mEntries[i].allocator != allocator) 
+            continue;
+            
+        mEntries.erase( mEntries.begin() + i );
+        
+        break;
+    }
+    
+    return;
+}
+
+void AllocatorRegistry::SetName(void* allocator, const std::string& name) {
+    
+    std::lock_guard<std::mutex> lock(mux);
+    
+    for (unsigned int i=0; i < mEntries.size(); i++) {
+        
+        if (mEntries[i].allocator != allocator) 
+            continue;
+            
+        mEntries[i].name = name;
+        
+        break;
+    }
+    
+    return;
+}
+
+void AllocatorRegistry::Sample(void) {
+    
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    
+    double elapsed = std::chrono::duration<double>(now - mLastSample).count();
+    
+    if (elapsed < ALLOCATOR_SAMPLE_INTERVAL) 
+        return;
+        
+    mLastSample = now;
+    
+    std::lock_guard<std::mutex> lock(mux);
+    
+    for (unsigned int i=0; i < mEntries.size(); i++) {
+        
+        Entry& entry = mEntries[i];
+        
+        AllocatorStatistics statistics;
+        entry.query(entry.allocator, statistics);
+        
+        entry.createRate  = (float)((double)(statistics.totalCreated   - entry.lastCreated)   / elapsed);
+        entry.destroyRate = (float)((double)(statistics.totalDestroyed - entry.lastDestroyed) / elapsed);
+        
+        entry.lastCreated   = statistics.totalCreated;
+        entry.lastDestroyed = statistics.totalDestroyed;
+    }
+    
+    return;
+}
+
+std::vector<AllocatorStatistics> AllocatorRegistry::GetStatistics(void) {
+    
+    std::lock_guard<std::mutex> lock(mux);
+    
+    std::vector<AllocatorStatistics> statisticsList;
+    statisticsList.reserve( mEntries.size() );
+    
+    for (unsigned int i=0; i < mEntries.size(); i++) {
+        
+        AllocatorStatistics statistics;
+        mEntries[i].query(mEntries[i].allocator, statistics);
+        
+        statistics.name        = mEntries[i].name;
+        statistics.createRate  = mEntries[i].createRate;
+        statistics.destroyRate = mEntries[i].destroyRate;
+        
+        statisticsList.push_back(statistics);
+    }
+    
+    return statisticsList;
+}
+
+unsigned int AllocatorRegistry::GetNumberOfAllocators(void) {
+    
+    std::lock_guard<std::mutex> lock(mux);
+    
+    return mEntries.size();
+}
+
+bool AllocatorRegistry::WriteCSV(const std::string& filename) {
+    
+    std::vector<AllocatorStatistics> statisticsList = GetStatistics();
+    
+    std::ofstream file(filename, std::ofstream::trunc);
+    
+    if (!file.is_open()) 
+        return false;
+        
+    file << "type,live,capacity,slabs,high_water_mark,object_size,bytes_reserved,bytes_wasted,total_created,total_destroyed,create_rate,destroy_rate\n";
+    
+    for (unsigned int i=0; i < statisticsList.size(); i++) {
+        
+        AllocatorStatistics& statistics = statisticsList[i];
+        
+        file << "\"" << statistics.name << "\","
+             << statistics.liveCount      << ","
+             << statistics.capacity       << ","
+             << statistics.slabCount      << ","
+             << statistics.highWaterMark  << ","
+             << statistics.objectSize     << ","
+             << statistics.bytesReserved  << ","
+             << statistics.bytesWasted    << ","
+             << statistics.totalCreated   << ","
+             << statistics.totalDestroyed << ","
+             << statistics.createRate     << ","
+             << statistics.destroyRate    << "\n";
+    }
+    
+    file.close();
+    
+    return true;
+}
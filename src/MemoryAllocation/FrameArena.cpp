@@ -0,0 +1,180 @@
+#include <GameEngineFramework/MemoryAllocation/FrameArena.h>
+
+#include <cstdint>
+#include <cstdlib>
+
+
+FrameArena::FrameArena(std::size_t blockSize) : 
+    mCurrentBlock(0),
+    mOffset(0),
+    mBytesPrevious(0),
+    mBlockSize(blockSize),
+    mHighWaterMark(0),
+    mNumberOfBlockAllocations(0)
+{
+    if (mBlockSize < 1024) 
+        mBlockSize = 1024;
+        
+    return;
+}
+
+FrameArena::~FrameArena() {
+    
+    for (unsigned int i=0; i < mBlocks.size(); i++) 
+        free(mBlocks[i].memory);
+        
+    return;
+}
+
+FrameArena& FrameArena::GetThreadArena(void) {
+    
+    static thread_local FrameArena threadArena;
+    
+    return threadArena;
+}
+
+bool FrameArena::AllocateBlock(std::size_t size) {
+    
+    Block block;
+    block.size   = size;
+    block.memory = (unsigned char*)malloc(size);
+    
+    if (block.memory == nullptr) 
+        return false;
+        
+    mBlocks.push_back(block);
+    
+    mNumberOfBlockAllocations++;
+    
+    return true;
+}
+
+void* FrameArena::Allocate(std::size_t size, std::size_t alignment) {
+    
+    if (alignment == 0) 
+        alignment = 1;
+        
+    for (;;) {
+        
+        if (mCurrentBlock < mBlocks.size()) {
+            
+            Block& block = mBlocks[mCurrentBlock];
+            
+            std::uintptr_t base    = (std::uintptr_t)block.memory;
+            std::uintptr_t address = (base + mOffset + (alignment - 1)) & ~(std::uintptr_t)(alignment - 1);
+            
+            std::size_t end = (address - base) + size;
+            
+            if (end <= block.size) {
+                
+                mOffset = end;
+                
+                std::size_t bytesUsed = mBytesPrevious + mOffset;
+                if (mHighWaterMark < bytesUsed) 
+                    mHighWaterMark = bytesUsed;
+                    
+                return (void*)address;
+            }
+            
+            // Move on to the next block
+            if (mCurrentBlock + 1 < mBlocks.size()) {
+                
+                mBytesPrevious += block.size;
+                
+                mCurrentBlock++;
+                mOffset = 0;
+                
+                continue;
+            }
+            
+        }
+        
+        // Out of blocks, allocate one large enough for the request
+        std::size_t blockSize = mBlockSize;
+        if (blockSize < size + alignment) 
+            blockSize = size + alignment;
+            
+        if (!AllocateBlock(blockSize)) 
+            return nullptr;
+            
+        if (mBlocks.size() > 1) {
+            
+            mBytesPrevious += mBlocks[mCurrentBlock].size;
+            
+            mCurrentBlock = mBlocks.size() - 1;
+        }
+        
+        mOffset = 0;
+        
+        continue;
+    }
+    
+}
+
+void FrameArena::Reset(void) {
+    
+    // Merge the blocks into a single block so the
+    // next frame fits without spilling over
+    if (mCurrentBlock > 0) {
+        
+        std::size_t capacity = GetCapacity();
+        
+        for (unsigned int i=0; i < mBlocks.size(); i++) 
+            free(mBlocks[i].memory);
+            
+        mBlocks.clear();
+        
+        AllocateBlock(capacity);
+    }
+    
+    mCurrentBlock  = 0;
+    mOffset        = 0;
+    mBytesPrevious = 0;
+    
+    return;
+}
+
+FrameArenaMarker FrameArena::GetMarker(void) {
+    
+    FrameArenaMarker marker;
+    marker.block  = mCurrentBlock;
+    marker.offset = mOffset;
+    
+    return marker;
+}
+
+void FrameArena::Rewind(FrameArenaMarker marker) {
+    
+    while (mCurrentBlock > marker.block) {
+        
+        mCurrentBlock--;
+        
+        mBytesPrevious -= mBlocks[mCurrentBlock].size;
+    }
+    
+    mOffset = marker.offset;
+    
+    return;
+}
+
+std::size_t FrameArena::GetBytesUsed(void) {
+    return mBytesPrevious + mOffset;
+}
+
+std::size_t FrameArena::GetCapacity(void) {
+    
+    std::size_t capacity = 0;
+    
+    for (unsigned int i=0; i < mBlocks.size(); i++) 
+        capacity += mBlocks[i].size;
+        
+    return capacity;
+}
+
+std::size_t FrameArena::GetHighWaterMark(void) {
+    return mHighWaterMark;
+}
+
+unsigned int FrameArena::GetNumberOfBlockAllocations(void) {
+    return mNumberOfBlockAllocations;
+}
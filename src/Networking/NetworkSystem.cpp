@@ -1,6 +1,29 @@
 #include <GameEngineFramework/Networking/NetworkSystem.h>
 #include <GameEngineFramework/Logging/Logging.h>
 
+#ifndef _WIN32
+  #include <sys/ioctl.h>
+  #include <unistd.h>
+  
+  // Berkeley sockets under the WinSock names used below
+  #define  INVALID_SOCKET  -1
+  #define  SOCKET_ERROR    -1
+  #define  NO_ERROR         0
+  
+  #define  MAKEWORD(low, high)  0
+  
+  typedef sockaddr     SOCKADDR;
+  typedef sockaddr_in  SOCKADDR_IN;
+  
+  struct WSADATA {};
+  
+  static int  WSAStartup(int, WSADATA*) {return NO_ERROR;}
+  static void WSACleanup(void) {}
+  
+  static int closesocket(SOCKET socket) {return close(socket);}
+  static int ioctlsocket(SOCKET socket, unsigned long command, u_long* argument) {int value = (int)*argument; return ioctl(socket, command, &value);}
+#endif
+
 extern NetworkSystem Network;
 extern Logger Log;
 
@@ -196,7 +219,7 @@ void NetworkSystem::Update(void) {
         //
         
         SOCKADDR_IN addrClient;
-        int length = sizeof(SOCKADDR);
+        socklen_t length = sizeof(SOCKADDR);
         
         SOCKET newSocket = accept( mSocket, (SOCKADDR*)&addrClient, &length );
         
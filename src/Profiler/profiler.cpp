@@ -1,11 +1,107 @@
 #include <GameEngineFramework/Profiler/profiler.h>
+#include <GameEngineFramework/Timer/Clock.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+
+extern ProfilerTimer Profiler;
+
+
+struct ProfilerZoneRecord {
+    
+    const char* name;
+    
+    unsigned long long int begin;
+    unsigned long long int end;
+};
+
+// Zone slot which the exporting thread may read while the owning thread overwrites it
+struct ProfilerZoneSlot {
+    
+    std::atomic<const char*> name;
+    
+    std::atomic<unsigned long long int> begin;
+    std::atomic<unsigned long long int> end;
+};
+
+struct ProfilerThreadBuffer {
+    
+    ProfilerZoneSlot zones[PROFILER_ZONES_PER_THREAD];
+    
+    // Number of zones written. Only the owning thread advances the head
+    std::atomic<unsigned long long int> head;
+    
+    // Zones before this count were discarded by a clear
+    std::atomic<unsigned long long int> tail;
+    
+    unsigned int threadID;
+    
+    std::string name;
+    
+    ProfilerThreadBuffer() : 
+        head(0),
+        tail(0),
+        threadID(0)
+    {}
+};
+
+static thread_local ProfilerThreadBuffer* profilerThreadBuffer = nullptr;
+
+static const unsigned long long int profilerEpoch = Clock::GetTime();
+
+// Frames before this count were discarded by a clear
+static std::atomic<unsigned long long int> profilerFrameTail(0);
+
+
+// Return the first index still held by a ring buffer of the given size
+static unsigned long long int GetRingBegin(unsigned long long int head, unsigned long long int tail, unsigned long long int size) {
+    
+    unsigned long long int begin = (head > size) ? head - size : 0;
+    
+    if (begin < tail) 
+        begin = tail;
+        
+    return begin;
+}
+
+// Escape a name so it can be written into a JSON string
+static std::string EscapeTraceName(const char* name) {
+    
+    std::string escaped;
+    
+    for (const char* character = name; *character != '\0'; character++) {
+        
+        if ((*character == '"') | (*character == '\\')) 
+            escaped += '\\';
+            
+        escaped += *character;
+    }
+    
+    return escaped;
+}
+
 
 ProfilerTimer::ProfilerTimer() : 
     profileRenderSystem(0),
     profilePhysicsSystem(0),
     profileGameEngineUpdate(0),
-    profileActorAI(0)
+    profileActorAI(0),
+    
+    mIsCapturing(false),
+    mNumberOfFrames(0)
 {
+#ifdef PROFILE_ENGINE_CORE
+    mIsCapturing = true;
+#endif
+}
+
+ProfilerTimer::~ProfilerTimer() {
+    
+    for (unsigned int i=0; i < mThreadBuffers.size(); i++) 
+        delete mThreadBuffers[i];
+        
 }
 
 void ProfilerTimer::Begin(void) {
@@ -16,3 +112,442 @@ void ProfilerTimer::Begin(void) {
 float ProfilerTimer::Query(void) {
     return timer.GetCurrentDelta();
 }
+
+void ProfilerTimer::AddSample(ProfilerChannel channel, float milliseconds) {
+    mHistograms[ (unsigned int)channel ].AddSample(milliseconds);
+    return;
+}
+
+ProfilerHistogram& ProfilerTimer::GetHistogram(ProfilerChannel channel) {
+    return mHistograms[ (unsigned int)channel ];
+}
+
+std::string ProfilerTimer::GetChannelName(ProfilerChannel channel) {
+    
+    switch (channel) {
+        
+        case ProfilerChannel::Frame:    return "Frame";
+        case ProfilerChannel::Engine:   return "Engine";
+        case ProfilerChannel::Renderer: return "Renderer";
+        case ProfilerChannel::Physics:  return "Physics";
+        case ProfilerChannel::ActorAI:  return "ActorAI";
+        
+    }
+    
+    return "";
+}
+
+void ProfilerTimer::SetHistogramWindow(unsigned int numberOfSamples) {
+    
+    for (unsigned int i=0; i < PROFILER_NUMBER_OF_CHANNELS; i++) 
+        mHistograms[i].SetWindow(numberOfSamples);
+    
+    return;
+}
+
+bool ProfilerTimer::WriteHistogramCSV(std::string filename) {
+    
+    std::ofstream file(filename, std::ofstream::trunc);
+    
+    if (!file.is_open()) 
+        return false;
+    
+    file << "channel,window,samples,mean,p50,p95,p99,max";
+    
+    // Buckets are named by their upper edge in milliseconds
+    for (unsigned int b=0; b < PROFILER_HISTOGRAM_NUMBER_OF_BUCKETS; b++) 
+        file << "," << ((b + 1) * PROFILER_HISTOGRAM_BUCKET_SIZE);
+    
+    file << "\n";
+    
+    for (unsigned int i=0; i < PROFILER_NUMBER_OF_CHANNELS; i++) {
+        
+        ProfilerHistogram& histogram = mHistograms[i];
+        
+        file << GetChannelName( (ProfilerChannel)i ) << ","
+             << histogram.GetWindow()            << ","
+             << histogram.GetNumberOfSamples()   << ","
+             << histogram.GetMean()              << ","
+             << histogram.GetPercentile(50.0f)   << ","
+             << histogram.GetPercentile(95.0f)   << ","
+             << histogram.GetPercentile(99.0f)   << ","
+             << histogram.GetMax();
+        
+        for (unsigned int b=0; b < PROFILER_HISTOGRAM_NUMBER_OF_BUCKETS; b++) 
+            file << "," << histogram.GetBucketCount(b);
+        
+        file << "\n";
+    }
+    
+    file.close();
+    
+    return true;
+}
+
+void ProfilerTimer::EnableCapture(void) {
+    mIsCapturing.store(true);
+    return;
+}
+
+void ProfilerTimer::DisableCapture(void) {
+    mIsCapturing.store(false);
+    return;
+}
+
+bool ProfilerTimer::CheckIsCapturing(void) {
+    return mIsCapturing.load(std::memory_order_relaxed);
+}
+
+unsigned long long int ProfilerTimer::GetTraceTime(void) {
+    return Clock::GetTime() - profilerEpoch;
+}
+
+void ProfilerTimer::MarkFrame(void) {
+    
+    if (!CheckIsCapturing()) 
+        return;
+        
+    unsigned long long int index = mNumberOfFrames.load(std::memory_order_relaxed);
+    
+    mFrames[index & (PROFILER_NUMBER_OF_FRAMES - 1)].store(GetTraceTime(), std::memory_order_relaxed);
+    
+    mNumberOfFrames.store(index + 1, std::memory_order_release);
+    
+    return;
+}
+
+void ProfilerTimer::RecordZone(const char* name, unsigned long long int begin, unsigned long long int end) {
+    
+    ProfilerThreadBuffer* buffer = GetThreadBuffer();
+    
+    unsigned long long int index = buffer->head.load(std::memory_order_relaxed);
+    
+    ProfilerZoneSlot& zone = buffer->zones[index & (PROFILER_ZONES_PER_THREAD - 1)];
+    
+    zone.name.store(name, std::memory_order_relaxed);
+    zone.begin.store(begin, std::memory_order_relaxed);
+    zone.end.store(end, std::memory_order_relaxed);
+    
+    // Publish the zone to the exporting thread
+    buffer->head.store(index + 1, std::memory_order_release);
+    
+    return;
+}
+
+void ProfilerTimer::SetThreadName(std::string name) {
+    
+    ProfilerThreadBuffer* buffer = GetThreadBuffer();
+    
+    std::lock_guard<std::mutex> lock(mux);
+    
+    buffer->name = name;
+    
+    return;
+}
+
+void ProfilerTimer::ClearTrace(void) {
+    
+    std::lock_guard<std::mutex> lock(mux);
+    
+    for (unsigned int i=0; i < mThreadBuffers.size(); i++) 
+        mThreadBuffers[i]->tail.store( mThreadBuffers[i]->head.load() );
+        
+    profilerFrameTail.store( mNumberOfFrames.load() );
+    
+    return;
+}
+
+ProfilerThreadBuffer* ProfilerTimer::GetThreadBuffer(void) {
+    
+    if (profilerThreadBuffer != nullptr) 
+        return profilerThreadBuffer;
+        
+    ProfilerThreadBuffer* buffer = new ProfilerThreadBuffer();
+    
+    std::lock_guard<std::mutex> lock(mux);
+    
+    buffer->threadID = mThreadBuffers.size() + 1;
+    buffer->name     = "Thread " + std::to_string( buffer->threadID );
+    
+    mThreadBuffers.push_back( buffer );
+    
+    profilerThreadBuffer = buffer;
+    
+    return buffer;
+}
+
+bool ProfilerTimer::ExportTrace(std::string filename) {
+    
+    std::ofstream file(filename);
+    
+    if (!file.is_open()) 
+        return false;
+        
+    // Times are recorded in nanoseconds and written in microseconds
+    file << std::fixed << std::setprecision(3);
+    
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    file << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"Engine\"}}";
+    
+    //
+    // Frame markers are drawn on their own track
+    //
+    
+    file << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"Frames\"}}";
+    
+    unsigned long long int frameHead  = mNumberOfFrames.load(std::memory_order_acquire);
+    unsigned long long int frameBegin = GetRingBegin(frameHead, profilerFrameTail.load(), PROFILER_NUMBER_OF_FRAMES);
+    
+    std::vector<unsigned long long int> frames;
+    
+    for (unsigned long long int i=frameBegin; i < frameHead; i++) 
+        frames.push_back( mFrames[i & (PROFILER_NUMBER_OF_FRAMES - 1)].load(std::memory_order_relaxed) );
+        
+    // Frames marked while copying may have overwritten the oldest entries. The slot at the
+    // head may be mid write, so one past it is the first entry known to be intact
+    unsigned long long int frameSkip = GetRingBegin(mNumberOfFrames.load(std::memory_order_acquire) + 1, 0, PROFILER_NUMBER_OF_FRAMES);
+    
+    for (unsigned long long int i=frameBegin; (i + 1) < frameHead; i++) {
+        
+        if (i < frameSkip) 
+            continue;
+            
+        unsigned long long int begin = frames[i - frameBegin];
+        unsigned long long int end   = frames[i - frameBegin + 1];
+        
+        file << ",\n{\"name\":\"Frame " << i << "\",\"ph\":\"X\",\"pid\":1,\"tid\":0,\"ts\":" << (begin / 1000.0) << ",\"dur\":" << ((end - begin) / 1000.0) << "}";
+    }
+    
+    //
+    // Zones of each thread
+    //
+    
+    std::lock_guard<std::mutex> lock(mux);
+    
+    for (unsigned int t=0; t < mThreadBuffers.size(); t++) {
+        
+        ProfilerThreadBuffer* buffer = mThreadBuffers[t];
+        
+        file << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->threadID << ",\"args\":{\"name\":\"" << EscapeTraceName( buffer->name.c_str() ) << "\"}}";
+        
+        unsigned long long int head  = buffer->head.load(std::memory_order_acquire);
+        unsigned long long int begin = GetRingBegin(head, buffer->tail.load(), PROFILER_ZONES_PER_THREAD);
+        
+        std::vector<ProfilerZoneRecord> zones;
+        
+        for (unsigned long long int i=begin; i < head; i++) {
+            
+            ProfilerZoneSlot& slot = buffer->zones[i & (PROFILER_ZONES_PER_THREAD - 1)];
+            
+            ProfilerZoneRecord zone;
+            zone.name  = slot.name.load(std::memory_order_relaxed);
+            zone.begin = slot.begin.load(std::memory_order_relaxed);
+            zone.end   = slot.end.load(std::memory_order_relaxed);
+            
+            zones.push_back( zone );
+        }
+            
+        // The owning thread keeps recording so drop any zones it overwrote during the copy,
+        // including the slot at the head which it may still be writing
+        unsigned long long int skip = GetRingBegin(buffer->head.load(std::memory_order_acquire) + 1, 0, PROFILER_ZONES_PER_THREAD);
+        
+        for (unsigned long long int i=begin; i < head; i++) {
+            
+            if (i < skip) 
+                continue;
+                
+            ProfilerZoneRecord& zone = zones[i - begin];
+            
+            file << ",\n{\"name\":\"" << EscapeTraceName( zone.name ) << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->threadID << 
+                    ",\"ts\":" << (zone.begin / 1000.0) << ",\"dur\":" << ((zone.end - zone.begin) / 1000.0) << "}";
+        }
+        
+    }
+    
+    file << "\n]}\n";
+    
+    return file.good();
+}
+
+
+ProfilerZone::ProfilerZone(const char* name) : 
+    mName(name),
+    mBegin(0)
+{
+    if (Profiler.CheckIsCapturing()) 
+        mBegin = Profiler.GetTraceTime();
+}
+
+ProfilerZone::~ProfilerZone() {
+    
+    if (mBegin == 0) 
+        return;
+        
+    Profiler.RecordZone(mName, mBegin, Profiler.GetTraceTime());
+}
+
+
+ProfilerHistogram::ProfilerHistogram() : 
+    mSampleIndex(0),
+    mNumberOfSamples(0),
+    mSampleSum(0)
+{
+    mSamples.resize(PROFILER_HISTOGRAM_WINDOW);
+    
+    for (unsigned int i=0; i < PROFILER_HISTOGRAM_NUMBER_OF_BUCKETS; i++) 
+        mBuckets[i] = 0;
+}
+
+// Return the bucket a sample is counted in
+static unsigned int GetHistogramBucket(float milliseconds) {
+    
+    if (milliseconds <= 0.0f) 
+        return 0;
+    
+    unsigned int bucket = (unsigned int)(milliseconds / PROFILER_HISTOGRAM_BUCKET_SIZE);
+    
+    if (bucket >= PROFILER_HISTOGRAM_NUMBER_OF_BUCKETS) 
+        bucket = PROFILER_HISTOGRAM_NUMBER_OF_BUCKETS - 1;
+    
+    return bucket;
+}
+
+void ProfilerHistogram::AddSample(float milliseconds) {
+    
+    std::lock_guard<std::mutex> lock(mux);
+    
+    if (mSamples.size() == 0) 
+        return;
+    
+    // Evict the oldest sample once the window is full
+    if (mNumberOfSamples == mSamples.size()) {
+        
+        float oldSample = mSamples[mSampleIndex];
+        
+        mBuckets[ GetHistogramBucket(oldSample) ]--;
+        
+        mSampleSum -= oldSample;
+        
+    } else {
+        
+        mNumberOfSamples++;
+    }
+    
+    mSamples[mSampleIndex] = milliseconds;
+    
+    mBuckets[ GetHistogramBucket(milliseconds) ]++;
+    
+    mSampleSum += milliseconds;
+    
+    mSampleIndex++;
+    if (mSampleIndex >= mSamples.size()) 
+        mSampleIndex = 0;
+    
+    return;
+}
+
+float ProfilerHistogram::GetPercentile(float percentage) {
+    
+    std::lock_guard<std::mutex> lock(mux);
+    
+    if (mNumberOfSamples == 0) 
+        return 0.0f;
+    
+    // Rank of the sample the percentile falls on
+    unsigned int rank = (unsigned int)std::ceil( (percentage / 100.0f) * mNumberOfSamples );
+    
+    if (rank < 1) 
+        rank = 1;
+    
+    float max = 0.0f;
+    for (unsigned int i=0; i < mNumberOfSamples; i++) 
+        max = std::max(max, mSamples[i]);
+    
+    unsigned int count = 0;
+    
+    for (unsigned int b=0; b < PROFILER_HISTOGRAM_NUMBER_OF_BUCKETS; b++) {
+        
+        count += mBuckets[b];
+        
+        if (count < rank) 
+            continue;
+        
+        // The last bucket has no upper edge
+        if (b == PROFILER_HISTOGRAM_NUMBER_OF_BUCKETS - 1) 
+            return max;
+        
+        // Report the upper edge of the bucket without passing the largest sample
+        return std::min((b + 1) * PROFILER_HISTOGRAM_BUCKET_SIZE, max);
+    }
+    
+    return max;
+}
+
+float ProfilerHistogram::GetMax(void) {
+    
+    std::lock_guard<std::mutex> lock(mux);
+    
+    float max = 0.0f;
+    
+    for (unsigned int i=0; i < mNumberOfSamples; i++) 
+        max = std::max(max, mSamples[i]);
+    
+    return max;
+}
+
+float ProfilerHistogram::GetMean(void) {
+    
+    std::lock_guard<std::mutex> lock(mux);
+    
+    if (mNumberOfSamples == 0) 
+        return 0.0f;
+    
+    return (float)(mSampleSum / mNumberOfSamples);
+}
+
+unsigned int ProfilerHistogram::GetNumberOfSamples(void) {
+    
+    std::lock_guard<std::mutex> lock(mux);
+    
+    return mNumberOfSamples;
+}
+
+unsigned int ProfilerHistogram::GetBucketCount(unsigned int index) {
+    
+    std::lock_guard<std::mutex> lock(mux);
+    
+    if (index >= PROFILER_HISTOGRAM_NUMBER_OF_BUCKETS) 
+        return 0;
+    
+    return mBuckets[index];
+}
+
+void ProfilerHistogram::SetWindow(unsigned int numberOfSamples) {
+    
+    std::lock_guard<std::mutex> lock(mux);
+    
+    mSamples.assign(numberOfSamples, 0.0f);
+    
+    mSampleIndex     = 0;
+    mNumberOfSamples = 0;
+    mSampleSum       = 0;
+    
+    for (unsigned int i=0; i < PROFILER_HISTOGRAM_NUMBER_OF_BUCKETS; i++) 
+        mBuckets[i] = 0;
+    
+    return;
+}
+
+unsigned int ProfilerHistogram::GetWindow(void) {
+    
+    std::lock_guard<std::mutex> lock(mux);
+    
+    return mSamples.size();
+}
+
+void ProfilerHistogram::Clear(void) {
+    
+    SetWindow( GetWindow() );
+    
+    return;
+}
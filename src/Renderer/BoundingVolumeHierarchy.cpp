@@ -0,0 +1,320 @@
+#include <GameEngineFramework/Renderer/BoundingVolumeHierarchy.h>
+#include <GameEngineFramework/Renderer/components/meshrenderer.h>
+
+#include <algorithm>
+#include <cfloat>
+
+// Mask selecting every frustum plane
+#define  BVH_ALL_PLANES    0x3F
+
+// Nodes waiting to be visited. Median splits keep the depth near the log of the renderer count
+#define  BVH_STACK_SIZE    64
+
+
+namespace {
+
+inline glm::vec3 GetCenter(MeshRenderer* meshRenderer) {
+    return (meshRenderer->GetBoundingBoxMin() + meshRenderer->GetBoundingBoxMax()) * 0.5f;
+}
+
+}
+
+
+BoundingVolumeHierarchy::BoundingVolumeHierarchy() : 
+    mNeedsRebuild(false),
+    mNeedsRefit(false),
+    mNumberOfRefits(0),
+    mNumberOfTests(0)
+{
+}
+
+BoundingVolumeHierarchy::~BoundingVolumeHierarchy() {
+    
+    Clear();
+    
+    return;
+}
+
+bool BoundingVolumeHierarchy::Insert(MeshRenderer* meshRenderer) {
+    
+    if (meshRenderer == nullptr) 
+        return false;
+        
+    if (meshRenderer->mStaticTree != nullptr) 
+        return false;
+        
+    if (meshRenderer->CheckBoundsAreStale()) 
+        meshRenderer->UpdateBounds();
+        
+    meshRenderer->mStaticTree = this;
+    
+    mRenderers.push_back( meshRenderer );
+    
+    mNeedsRebuild = true;
+    
+    return true;
+}
+
+bool BoundingVolumeHierarchy::Remove(MeshRenderer* meshRenderer) {
+    
+    for (std::vector<MeshRenderer*>::iterator it = mRenderers.begin(); it != mRenderers.end(); ++it) {
+        
+        if (*it != meshRenderer) 
+            continue;
+            
+        mRenderers.erase(it);
+        
+        meshRenderer->mStaticTree = nullptr;
+        
+        mNeedsRebuild = true;
+        
+        return true;
+    }
+    
+    return false;
+}
+
+void BoundingVolumeHierarchy::Clear(void) {
+    
+    for (unsigned int i=0; i < mRenderers.size(); i++) 
+        mRenderers[i]->mStaticTree = nullptr;
+        
+    mRenderers.clear();
+    mLeafRenderers.clear();
+    mNodes.clear();
+    
+    mNeedsRebuild   = false;
+    mNeedsRefit     = false;
+    mNumberOfRefits = 0;
+    
+    return;
+}
+
+void BoundingVolumeHierarchy::Cull(const Frustum& frustum, FrameVector<MeshRenderer*>& visible) {
+    
+    Update();
+    
+    mNumberOfTests = 0;
+    
+    if (mNodes.size() == 0) 
+        return;
+        
+    unsigned int stackNode[BVH_STACK_SIZE];
+    unsigned int stackMask[BVH_STACK_SIZE];
+    unsigned int stackSize = 1;
+    
+    stackNode[0] = 0;
+    stackMask[0] = BVH_ALL_PLANES;
+    
+    while (stackSize > 0) {
+        
+        stackSize--;
+        
+        const Node& node = mNodes[ stackNode[stackSize] ];
+        unsigned int planeMask = stackMask[stackSize];
+        
+        mNumberOfTests++;
+        
+        if (!frustum.CheckBoxPlanes(node.boundsMin, node.boundsMax, planeMask)) 
+            continue;
+            
+        // Entirely inside so every renderer below is accepted
+        if (planeMask == 0) {
+            
+            for (unsigned int i=node.first; i < node.first + node.count; i++) 
+                visible.push_back( mLeafRenderers[i] );
+                
+            continue;
+        }
+        
+        if (node.child != 0) {
+            
+            stackNode[stackSize] = node.child + 1;
+            stackMask[stackSize] = planeMask;
+            stackSize++;
+            
+            stackNode[stackSize] = node.child;
+            stackMask[stackSize] = planeMask;
+            stackSize++;
+            
+            continue;
+        }
+        
+        // Test the renderers of a leaf against the planes left over
+        for (unsigned int i=node.first; i < node.first + node.count; i++) {
+            
+            MeshRenderer* meshRenderer = mLeafRenderers[i];
+            
+            // Refitted on the next update
+            if (meshRenderer->CheckBoundsAreStale()) 
+                meshRenderer->UpdateBounds();
+                
+            unsigned int rendererMask = planeMask;
+            
+            mNumberOfTests++;
+            
+            if (frustum.CheckBoxPlanes(meshRenderer->mBoundingBoxMin, meshRenderer->mBoundingBoxMax, rendererMask)) 
+                visible.push_back( meshRenderer );
+                
+        }
+        
+    }
+    
+    return;
+}
+
+void BoundingVolumeHierarchy::Update(void) {
+    
+    // Refitting loosens the tree as renderers move so it is built again now and then
+    if ((mNeedsRebuild) | (mNeedsRefit & (mNumberOfRefits >= BVH_REFITS_BEFORE_REBUILD))) {
+        Build();
+        return;
+    }
+    
+    if (mNeedsRefit) 
+        Refit();
+        
+    return;
+}
+
+void BoundingVolumeHierarchy::MarkBoundsChanged(void) {
+    mNeedsRefit = true;
+    return;
+}
+
+unsigned int BoundingVolumeHierarchy::GetNumberOfRenderers(void) {
+    return mRenderers.size();
+}
+
+MeshRenderer* BoundingVolumeHierarchy::GetRenderer(unsigned int index) {
+    return mRenderers[index];
+}
+
+unsigned int BoundingVolumeHierarchy::GetNumberOfNodes(void) {
+    return mNodes.size();
+}
+
+unsigned int BoundingVolumeHierarchy::GetNumberOfTests(void) {
+    return mNumberOfTests;
+}
+
+void BoundingVolumeHierarchy::Build(void) {
+    
+    mNeedsRebuild   = false;
+    mNeedsRefit     = false;
+    mNumberOfRefits = 0;
+    
+    mLeafRenderers = mRenderers;
+    
+    mNodes.clear();
+    
+    if (mLeafRenderers.size() == 0) 
+        return;
+        
+    Node root;
+    root.first = 0;
+    root.count = mLeafRenderers.size();
+    root.child = 0;
+    
+    mNodes.push_back( root );
+    
+    BuildNode(0);
+    
+    return;
+}
+
+void BoundingVolumeHierarchy::BuildNode(unsigned int index) {
+    
+    unsigned int first = mNodes[index].first;
+    unsigned int count = mNodes[index].count;
+    
+    if (count <= BVH_LEAF_SIZE) {
+        FitNode( mNodes[index] );
+        return;
+    }
+    
+    // Split along the longest axis of the renderer centers
+    glm::vec3 centerMin(FLT_MAX);
+    glm::vec3 centerMax(-FLT_MAX);
+    
+    for (unsigned int i=first; i < first + count; i++) {
+        
+        glm::vec3 center = GetCenter( mLeafRenderers[i] );
+        
+        centerMin = glm::min(centerMin, center);
+        centerMax = glm::max(centerMax, center);
+    }
+    
+    glm::vec3 extent = centerMax - centerMin;
+    
+    unsigned int axis = 0;
+    if (extent.y > extent[axis]) axis = 1;
+    if (extent.z > extent[axis]) axis = 2;
+    
+    // Half the renderers go to each side of the median center
+    std::vector<MeshRenderer*>::iterator begin = mLeafRenderers.begin() + first;
+    
+    std::nth_element(begin, begin + count / 2, begin + count, [axis](MeshRenderer* a, MeshRenderer* b) {
+        return GetCenter(a)[axis] < GetCenter(b)[axis];
+    });
+    
+    unsigned int child = mNodes.size();
+    
+    Node left;
+    left.first = first;
+    left.count = count / 2;
+    left.child = 0;
+    
+    Node right;
+    right.first = first + left.count;
+    right.count = count - left.count;
+    right.child = 0;
+    
+    mNodes.push_back( left );
+    mNodes.push_back( right );
+    
+    mNodes[index].child = child;
+    
+    BuildNode(child);
+    BuildNode(child + 1);
+    
+    FitNode( mNodes[index] );
+    
+    return;
+}
+
+void BoundingVolumeHierarchy::Refit(void) {
+    
+    mNeedsRefit = false;
+    mNumberOfRefits++;
+    
+    // Children always follow their parent so a reverse walk fits them first
+    for (unsigned int i=mNodes.size(); i > 0; i--) 
+        FitNode( mNodes[i - 1] );
+        
+    return;
+}
+
+void BoundingVolumeHierarchy::FitNode(Node& node) {
+    
+    if (node.child != 0) {
+        
+        const Node& left  = mNodes[node.child];
+        const Node& right = mNodes[node.child + 1];
+        
+        node.boundsMin = glm::min(left.boundsMin, right.boundsMin);
+        node.boundsMax = glm::max(left.boundsMax, right.boundsMax);
+        
+        return;
+    }
+    
+    node.boundsMin = glm::vec3(FLT_MAX);
+    node.boundsMax = glm::vec3(-FLT_MAX);
+    
+    for (unsigned int i=node.first; i < node.first + node.count; i++) {
+        node.boundsMin = glm::min(node.boundsMin, mLeafRenderers[i]->mBoundingBoxMin);
+        node.boundsMax = glm::max(node.boundsMax, mLeafRenderers[i]->mBoundingBoxMax);
+    }
+    
+    return;
+}
@@ -1,4 +1,5 @@
 #include <GameEngineFramework/Renderer/RenderSystem.h>
+#include <GameEngineFramework/Profiler/profiler.h>
 
 
 //
@@ -8,10 +9,23 @@ int dbgCounter = 0;
 
 void RenderSystem::RenderFrame(void) {
     
+    PROFILE_ZONE("Render frame");
+    
+    if (isHeadless) 
+        return;
+    
     glm::mat4 viewProjection;
     glm::vec3 eye;
     
-    mNumberOfDrawCalls = 0;
+    mNumberOfDrawCalls      = 0;
+    mNumberOfInstances      = 0;
+    mNumberOfShaderBinds    = 0;
+    mNumberOfMaterialBinds  = 0;
+    mNumberOfMeshBinds      = 0;
+    mNumberOfUniformUploads = 0;
+    
+    // Publish materials created and destruct materials destroyed on other threads
+    mMaterial.Synchronize();
     
     if (doUpdateLightsEveryFrame) {
         mNumberOfLights = 0;
@@ -39,9 +53,13 @@ void RenderSystem::RenderFrame(void) {
         // Set the camera projection angle
         setTargetCamera( scenePtr->camera, eye, viewProjection );
         
+        mFrustum.SetViewProjection( viewProjection );
+        
         // Gather active lights in this scene
         if (scenePtr->doUpdateLights) {
             
+            PROFILE_ZONE("Accumulate lights");
+            
             // Update the lights list 
             accumulateSceneLights( scenePtr, eye );
             
@@ -54,6 +72,9 @@ void RenderSystem::RenderFrame(void) {
             
         }
         
+        // Shaders receive the camera and lights again for this scene
+        mUniformEpoch++;
+        
         
         //
         // Draw the render queues
@@ -75,40 +96,79 @@ void RenderSystem::RenderFrame(void) {
             }
             
             
-            if (renderQueueGroup->size() == 0) 
-                continue;
-            
-            //
-            // Sorting
+            BoundingVolumeHierarchy* staticRenderQueue = &scenePtr->mStaticRenderQueue[group];
             
-            SortingPass( eye, renderQueueGroup, group );
+            if ((renderQueueGroup->size() == 0) & (staticRenderQueue->GetNumberOfRenderers() == 0)) 
+                continue;
             
+            FrameArena& arena = FrameArena::GetThreadArena();
+            FrameArenaMarker marker = arena.GetMarker();
             
-            //
-            // Geometry pass
-            
-            for (unsigned int i=0; i < renderQueueGroup->size(); i++) {
+            {
+                // Static renderers inside the view
+                FrameVector<MeshRenderer*> staticRenderers;
+                
+                {
+                    PROFILE_ZONE("Hierarchy culling");
+                    
+                    staticRenderQueue->Cull( mFrustum, staticRenderers );
+                }
                 
-                MeshRenderer* currentEntity = *(renderQueueGroup->data() + i);
+                //
+                // Sorting
+                // Groups are numbered from the sky queue
                 
-                bool isCulled = false;
+                {
+                    PROFILE_ZONE("Sorting pass");
+                    
+                    SortingPass( eye, renderQueueGroup->data(), renderQueueGroup->size(), group );
+                    SortingPass( eye, staticRenderers.data(), staticRenderers.size(), group );
+                }
                 
-                if (currentEntity->mDoCulling) 
-                    isCulled = CullingPass(currentEntity, scenePtr->camera);
                 
-                // Render geometry if not culled
-                if (!isCulled) 
-                    GeometryPass( currentEntity, eye, scenePtr->camera->forward, viewProjection );
+                //
+                // Geometry pass
+                
+                PROFILE_ZONE("Geometry pass");
+                
+                {
+                    // Visible renderers ordered to minimize state changes
+                    FrameVector<RenderQueueSort::Entry> drawList;
+                    
+                    unsigned int numberOfDraws = DrawListPass( renderQueueGroup, staticRenderers, group, drawList );
+                    
+                    unsigned int index = 0;
+                    
+                    while (index < numberOfDraws) {
+                        
+                        MeshRenderer* currentEntity = drawList[index].renderer;
+                        
+                        // Runs sharing an instanced shader are drawn in one call
+                        if (currentEntity->material->shader->CheckIsInstanced()) {
+                            
+                            index += InstancingPass( drawList.data() + index, numberOfDraws - index, eye, scenePtr->camera->forward, viewProjection );
+                            
+                            continue;
+                        }
+                        
+                        GeometryPass( currentEntity, eye, scenePtr->camera->forward, viewProjection );
+                        
+                        index++;
+                    }
+                }
                 
-                continue;
             }
             
+            arena.Rewind( marker );
+            
             
             //
             // Shadow pass
             
             if (mNumberOfShadows > 0) {
                 
+                PROFILE_ZONE("Shadow pass");
+                
                 shaders.shadowCaster->Bind();
                 
                 for (unsigned int i=0; i < renderQueueGroup->size(); i++) {
@@ -120,6 +180,13 @@ void RenderSystem::RenderFrame(void) {
                     continue;
                 }
                 
+                // Shadows may fall into view from static renderers outside it
+                for (unsigned int i=0; i < staticRenderQueue->GetNumberOfRenderers(); i++) 
+                    ShadowVolumePass( staticRenderQueue->GetRenderer(i), eye, scenePtr->camera->forward, viewProjection );
+                    
+                // The shadow data was sent through the light uniforms
+                shaders.shadowCaster->mUniformEpoch = 0;
+                
                 mCurrentShader->Bind();
                 
             }
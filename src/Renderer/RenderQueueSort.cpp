@@ -0,0 +1,178 @@
+#include <GameEngineFramework/Renderer/RenderQueueSort.h>
+
+#include <algorithm>
+#include <cstring>
+#include <cstdint>
+
+#define RENDER_SORT_SHADER_BITS    14
+#define RENDER_SORT_MATERIAL_BITS  15
+#define RENDER_SORT_MESH_BITS      15
+
+// Shader, material and mesh bits at the bottom of a key
+#define RENDER_SORT_STATE_MASK     ((1ULL << (RENDER_SORT_SHADER_BITS + RENDER_SORT_MATERIAL_BITS + RENDER_SORT_MESH_BITS)) - 1)
+
+
+unsigned long long int RenderQueueSort::BuildKey(unsigned int queueGroup, unsigned int depthBucket, const void* shader, const void* material, const void* mesh) {
+    
+    unsigned long long int key = queueGroup & 0xf;
+    
+    key = (key << 16) | (depthBucket & 0xffff);
+    key = (key << RENDER_SORT_SHADER_BITS)   | GetResourceId(shader,   RENDER_SORT_SHADER_BITS);
+    key = (key << RENDER_SORT_MATERIAL_BITS) | GetResourceId(material, RENDER_SORT_MATERIAL_BITS);
+    key = (key << RENDER_SORT_MESH_BITS)     | GetResourceId(mesh,     RENDER_SORT_MESH_BITS);
+    
+    return key;
+}
+
+unsigned int RenderQueueSort::GetDepthBucket(float distanceSquared, bool isBackToFront) {
+    
+    // Negative zero and NaN fall into the nearest bucket
+    if (!(distanceSquared > 0.0f)) 
+        distanceSquared = 0.0f;
+        
+    // Positive floats order the same as their bit patterns
+    uint32_t bits;
+    std::memcpy(&bits, &distanceSquared, sizeof(bits));
+    
+    unsigned int bucket = bits >> 15;
+    
+    if (isBackToFront) 
+        bucket = 0xffff - bucket;
+        
+    return bucket;
+}
+
+unsigned int RenderQueueSort::GetResourceId(const void* resource, unsigned int numberOfBits) {
+    
+    if (resource == nullptr) 
+        return 0;
+        
+    // Fibonacci hash of the address with the allocation alignment shifted out
+    unsigned long long int address = (unsigned long long int)(uintptr_t)resource >> 4;
+    
+    unsigned int id = (unsigned int)((address * 0x9e3779b97f4a7c15ULL) >> (64 - numberOfBits));
+    
+    // Keep zero for null
+    return (id == 0) ? 1 : id;
+}
+
+void RenderQueueSort::Sort(Entry* entries, Entry* scratch, unsigned int count) {
+    
+    if (count < 2) 
+        return;
+        
+    // Already in order from the previous frame
+    unsigned int numberOfDescents = 0;
+    
+    for (unsigned int i=1; i < count; i++) 
+        if (entries[i].key < entries[i - 1].key) 
+            numberOfDescents++;
+            
+    if (numberOfDescents == 0) 
+        return;
+        
+    // Nearly in order. Insertion sort until the move budget runs out
+    if (numberOfDescents * 16 < count) {
+        
+        unsigned long long int budget = (unsigned long long int)count * RENDER_SORT_INSERTION_BUDGET;
+        unsigned long long int numberOfMoves = 0;
+        
+        unsigned int i = 1;
+        
+        for (; i < count; i++) {
+            
+            if (entries[i].key >= entries[i - 1].key) 
+                continue;
+                
+            Entry entry = entries[i];
+            
+            unsigned int j = i;
+            
+            while ((j > 0) && (entries[j - 1].key > entry.key)) {
+                entries[j] = entries[j - 1];
+                j--;
+            }
+            
+            entries[j] = entry;
+            
+            numberOfMoves += i - j;
+            
+            if (numberOfMoves > budget) 
+                break;
+        }
+        
+        if (i >= count) 
+            return;
+    }
+    
+    // Least significant digit first radix sort over eight bit digits
+    unsigned int histogram[8][256];
+    std::memset(histogram, 0, sizeof(histogram));
+    
+    for (unsigned int i=0; i < count; i++) {
+        
+        unsigned long long int key = entries[i].key;
+        
+        for (unsigned int d=0; d < 8; d++) 
+            histogram[d][(key >> (d * 8)) & 0xff]++;
+    }
+    
+    Entry* source      = entries;
+    Entry* destination = scratch;
+    
+    for (unsigned int d=0; d < 8; d++) {
+        
+        unsigned int* counts = histogram[d];
+        
+        // Every key shares this digit
+        if (counts[(source[0].key >> (d * 8)) & 0xff] == count) 
+            continue;
+            
+        unsigned int offset = 0;
+        for (unsigned int b=0; b < 256; b++) {
+            unsigned int bucketCount = counts[b];
+            counts[b] = offset;
+            offset += bucketCount;
+        }
+        
+        for (unsigned int i=0; i < count; i++) {
+            
+            unsigned int digit = (source[i].key >> (d * 8)) & 0xff;
+            
+            destination[ counts[digit]++ ] = source[i];
+        }
+        
+        Entry* swap = source;
+        source      = destination;
+        destination = swap;
+    }
+    
+    if (source != entries) 
+        std::memcpy(entries, source, sizeof(Entry) * count);
+        
+    return;
+}
+
+void RenderQueueSort::SortDrawList(Entry* entries, Entry* scratch, unsigned int numberOfDynamic, unsigned int count, bool doMergeByDepth, bool doGroupByState) {
+    
+    // Dynamic and static entries were each sorted by depth. Merge them
+    // so the whole list keeps the depth order
+    if (doMergeByDepth & (numberOfDynamic < count)) {
+        
+        std::merge(entries, entries + numberOfDynamic, 
+                   entries + numberOfDynamic, entries + count, 
+                   scratch, 
+                   [](const Entry& a, const Entry& b) {return a.key < b.key;});
+        
+        std::memcpy(entries, scratch, sizeof(Entry) * count);
+    }
+    
+    for (unsigned int i=0; i < count; i++) 
+        entries[i].key &= RENDER_SORT_STATE_MASK;
+        
+    // The stable sort keeps the depth order within each group
+    if (doGroupByState) 
+        Sort(entries, scratch, count);
+        
+    return;
+}
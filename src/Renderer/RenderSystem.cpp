@@ -1,7 +1,7 @@
-#include <GameEngineFramework/Renderer/rendersystem.h>
+#include <GameEngineFramework/Renderer/RenderSystem.h>
 #include <GameEngineFramework/Logging/Logging.h>
 
-#include <GameEngineFramework/Types/types.h>
+#include <GameEngineFramework/Types/Types.h>
 
 #include <iostream>
 
@@ -10,11 +10,6 @@ extern Logger Log;
 extern IntType Int;
 
 
-// Render thread
-bool isThreadActive = true;
-void RenderThreadMain(void);
-
-
 RenderSystem::RenderSystem() : 
     viewport(Viewport(0, 0, 0, 0)),
     
@@ -22,14 +17,26 @@ RenderSystem::RenderSystem() :
     displayCenter(glm::vec2(0, 0)),
     
     doUpdateLightsEveryFrame(true),
+    isHeadless(false),
     
     mNumberOfDrawCalls(0),
+    mNumberOfInstances(0),
+    mNumberOfShaderBinds(0),
+    mNumberOfMaterialBinds(0),
+    mNumberOfMeshBinds(0),
+    mNumberOfUniformUploads(0),
+    mUniformEpoch(0),
     mNumberOfFrames(0),
     
+    mInterpolationFactor(1.0f),
+    mInterpolationStep(0),
+    
     mCurrentMesh(nullptr),
     mCurrentMaterial(nullptr),
     mCurrentShader(nullptr),
     
+    mInstanceBuffer(0),
+    
     mNumberOfLights(0),
     mNumberOfShadows(0),
     
@@ -42,6 +49,8 @@ MeshRenderer* RenderSystem::CreateMeshRenderer(void) {
     return meshRendererPtr;
 }
 bool RenderSystem::DestroyMeshRenderer(MeshRenderer* meshRendererPtr) {
+    if (meshRendererPtr->mStaticTree != nullptr) 
+        meshRendererPtr->mStaticTree->Remove(meshRendererPtr);
     if (meshRendererPtr->mesh != nullptr) 
         if (meshRendererPtr->mesh->isShared == false) 
             mMesh.Destroy(meshRendererPtr->mesh);
@@ -97,7 +106,7 @@ bool RenderSystem::DestroyMaterial(Material* materialPtr) {
     return mMaterial.Destroy(materialPtr);
 }
 unsigned int RenderSystem::GetNumberOfMaterials(void) {
-    return mMaterial.Size();
+    return mMaterial.GetObjectCount();
 }
 
 Light* RenderSystem::CreateLight(void) {
@@ -146,22 +155,22 @@ unsigned int RenderSystem::GetNumberOfFrameBuffers(void) {
 
 void RenderSystem::Initiate(void) {
     
+    if (!isHeadless) 
+        glGenBuffers(1, &mInstanceBuffer);
+    
 #ifdef RENDERER_CHECK_OPENGL_ERRORS
     GetGLErrorCodes("OnInitiate::");
 #endif
     
-    renderThreadMain = new std::thread( RenderThreadMain );
-    
-    Log.Write( " >> Starting thread renderer" );
-    
     return;
 }
 
 void RenderSystem::Shutdown(void) {
     
-    isThreadActive = false;
+    if (mInstanceBuffer != 0) 
+        glDeleteBuffers(1, &mInstanceBuffer);
     
-    renderThreadMain->join();
+    mInstanceBuffer = 0;
     
     return;
 }
@@ -235,24 +244,47 @@ unsigned int RenderSystem::GetNumberOfDrawCalls(void) {
     return mNumberOfDrawCalls;
 }
 
+unsigned int RenderSystem::GetNumberOfInstances(void) {
+    return mNumberOfInstances;
+}
 
+unsigned int RenderSystem::GetNumberOfShaderBinds(void) {
+    return mNumberOfShaderBinds;
+}
 
-//
-// Render thread
-//
+unsigned int RenderSystem::GetNumberOfMaterialBinds(void) {
+    return mNumberOfMaterialBinds;
+}
 
-void RenderThreadMain(void) {
-    
-    while (isThreadActive) {
-        
-        std::this_thread::sleep_for( std::chrono::duration<float, std::milli>(1) );
-        
-        continue;
-    }
-    
-    std::this_thread::sleep_for( std::chrono::duration<float, std::milli>(3) );
-    Log.Write( " >> Shutting down on thread renderer" );
-    
+unsigned int RenderSystem::GetNumberOfMeshBinds(void) {
+    return mNumberOfMeshBinds;
+}
+
+unsigned int RenderSystem::GetNumberOfUniformUploads(void) {
+    return mNumberOfUniformUploads;
+}
+
+void RenderSystem::SetInterpolationFactor(float factor) {
+    if (factor < 0.0f) factor = 0.0f;
+    if (factor > 1.0f) factor = 1.0f;
+    mInterpolationFactor = factor;
+    return;
+}
+
+float RenderSystem::GetInterpolationFactor(void) {
+    return mInterpolationFactor;
+}
+
+void RenderSystem::ReleaseFreeMemory(void) {
+    mEntity.Shrink();
+    mMesh.Shrink();
+    mMaterial.Shrink();
+    mShader.Shrink();
+    mCamera.Shrink();
+    mLight.Shrink();
+    mScene.Shrink();
+    mFrameBuffer.Shrink();
+    mTexture.Shrink();
     return;
 }
 
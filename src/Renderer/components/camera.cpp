@@ -21,14 +21,14 @@ Camera::Camera() :
     clipNear(0.1),
     clipFar(10000000),
     
-    frustumOverlap(30.0f),
-    frustumOffset(100.0f),
-    
     mouseLimitPitchMax(180),
     mouseLimitPitchMin(180),
     
     mouseSensitivityYaw(1.3),
-    mouseSensitivityPitch(1.15)
+    mouseSensitivityPitch(1.15),
+    
+    mInterpolationStep(0),
+    mPreviousPosition(glm::vec3(0, 0, 0))
 {
 }
 
@@ -1,15 +1,24 @@
 #include <GameEngineFramework/Renderer/components/framebuffer.h>
+#include <GameEngineFramework/Renderer/RenderSystem.h>
 
 #define GLEW_STATIC
-#include <gl/glew.h>
+#include "../../../vendor/gl/glew.h"
 
+extern RenderSystem Renderer;
 
-FrameBuffer::FrameBuffer() {
+
+FrameBuffer::FrameBuffer() : 
+    mFrameBuffer(0)
+{
+    if (Renderer.isHeadless) 
+        return;
     glGenFramebuffers(1, &mFrameBuffer);
     return;
 }
 
 FrameBuffer::~FrameBuffer() {
+    if (Renderer.isHeadless) 
+        return;
     glDeleteFramebuffers(1, &mFrameBuffer);
     return;
 }
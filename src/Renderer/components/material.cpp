@@ -1,7 +1,7 @@
 #include <GameEngineFramework/Renderer/components/material.h>
 
 #define GLEW_STATIC
-#include <gl/glew.h>
+#include "../../../vendor/gl/glew.h"
 
 
 Material::Material() : 
@@ -1,25 +1,45 @@
 #include <GameEngineFramework/Renderer/components/mesh.h>
+#include <GameEngineFramework/Renderer/RenderSystem.h>
 #include <GameEngineFramework/Math/Math.h>
+#include <GameEngineFramework/MemoryAllocation/FrameArena.h>
 
 #include <GameEngineFramework/Math/Random.h>
 
+#include <cstddef>
+
 #define GLEW_STATIC
-#include <gl/glew.h>
+#include "../../../vendor/gl/glew.h"
 
 extern MathCore Math;
 extern NumberGeneration Random;
+extern RenderSystem Renderer;
 
 
 Mesh::Mesh() : 
     
     isShared(false),
     
+    mVertexArray(0),
+    mBufferVertex(0),
+    mBufferIndex(0),
+    
+    mInstanceBuffer(0),
+    
     mPrimitive(GL_TRIANGLES),
     
     mVertexBufferSz(0),
     mIndexBufferSz(0),
     
-    mAreBuffersAllocated(true)
+    mAreBuffersAllocated(true),
+    
+    mBoundingBoxMin(0),
+    mBoundingBoxMax(0),
+    
+    mBoundingSphereCenter(0),
+    mBoundingSphereRadius(0),
+    
+    mHasBounds(false),
+    mBoundsVersion(0)
 {
     
     AllocateBuffers();
@@ -47,22 +67,9 @@ void Mesh::AddPlain(float x, float y, float z, float width, float height, Color
     vertex[2] = Vertex( x+width, y, z-height,   color.r, color.g, color.b,   0, 1, 0,   uStart + (uOffset * uCoord) + uCoord, vStart + (vOffset * vCoord) + 0 );
     vertex[3] = Vertex( x-width, y, z-height,   color.r, color.g, color.b,   0, 1, 0,   uStart + (uOffset * uCoord) + uCoord, vStart + (vOffset * vCoord) + vCoord);
     
-    SubMesh subBuffer;
+    Index index[6] = {0, 1, 2,   0, 2, 3};
     
-    subBuffer.vertexBuffer.push_back(vertex[0]);
-    subBuffer.vertexBuffer.push_back(vertex[1]);
-    subBuffer.vertexBuffer.push_back(vertex[2]);
-    subBuffer.vertexBuffer.push_back(vertex[3]);
-    
-    subBuffer.indexBuffer.push_back(0);
-    subBuffer.indexBuffer.push_back(1);
-    subBuffer.indexBuffer.push_back(2);
-    
-    subBuffer.indexBuffer.push_back(0);
-    subBuffer.indexBuffer.push_back(2);
-    subBuffer.indexBuffer.push_back(3);
-    
-    AddSubMesh(x, y, x, subBuffer.vertexBuffer, subBuffer.indexBuffer, false);
+    AddSubMesh(x, y, x, vertex, 4, index, 6, false);
     return;
 }
 
@@ -94,22 +101,9 @@ void Mesh::AddWall(float x, float y, float z, float width, float height, Color c
     vertex[2] = Vertex( x+width, y-height, z,   color.r, color.g, color.b,   0,0,1,  1, 0 );
     vertex[3] = Vertex( x-width, y-height, z,   color.r, color.g, color.b,   0,0,1,  1, 1 );
     
-    SubMesh subBuffer;
-    
-    subBuffer.vertexBuffer.push_back(vertex[0]);
-    subBuffer.vertexBuffer.push_back(vertex[1]);
-    subBuffer.vertexBuffer.push_back(vertex[2]);
-    subBuffer.vertexBuffer.push_back(vertex[3]);
-    
-    subBuffer.indexBuffer.push_back(0);
-    subBuffer.indexBuffer.push_back(1);
-    subBuffer.indexBuffer.push_back(2);
+    Index index[6] = {0, 1, 2,   0, 2, 3};
     
-    subBuffer.indexBuffer.push_back(0);
-    subBuffer.indexBuffer.push_back(2);
-    subBuffer.indexBuffer.push_back(3);
-    
-    AddSubMesh(x, y, x, subBuffer.vertexBuffer, subBuffer.indexBuffer, false);
+    AddSubMesh(x, y, x, vertex, 4, index, 6, false);
     return;
 }
 
@@ -131,21 +125,9 @@ int Mesh::AddQuad(float x, float y, float z, float width, float height, Color co
     vertex[2] = Vertex( x+width, y, z+height,  color.r, color.g, color.b,   0, 1, 0,  1, 1 );
     vertex[3] = Vertex( x, y,       z+height,  color.r, color.g, color.b,   0, 1, 0,  0, 1 );
     
-    SubMesh subBuffer;
-    subBuffer.vertexBuffer.push_back(vertex[0]);
-    subBuffer.vertexBuffer.push_back(vertex[1]);
-    subBuffer.vertexBuffer.push_back(vertex[2]);
-    subBuffer.vertexBuffer.push_back(vertex[3]);
-    
-    subBuffer.indexBuffer.push_back(0);
-    subBuffer.indexBuffer.push_back(2);
-    subBuffer.indexBuffer.push_back(1);
-    
-    subBuffer.indexBuffer.push_back(0);
-    subBuffer.indexBuffer.push_back(3);
-    subBuffer.indexBuffer.push_back(2);
+    Index index[6] = {0, 2, 1,   0, 3, 2};
     
-    return AddSubMesh(x, y, z, subBuffer.vertexBuffer, subBuffer.indexBuffer, false);
+    return AddSubMesh(x, y, z, vertex, 4, index, 6, false);
 }
 
 int Mesh::AddSubMesh(float x, float y, float z, SubMesh& mesh, bool doUploadToGpu) {
@@ -153,6 +135,10 @@ int Mesh::AddSubMesh(float x, float y, float z, SubMesh& mesh, bool doUploadToGp
 }
 
 int Mesh::AddSubMesh(float x, float y, float z, std::vector<Vertex>& vrtxBuffer, std::vector<Index>& indxBuffer, bool doUploadToGpu) {
+    return AddSubMesh(x, y, z, vrtxBuffer.data(), vrtxBuffer.size(), indxBuffer.data(), indxBuffer.size(), doUploadToGpu);
+}
+
+int Mesh::AddSubMesh(float x, float y, float z, Vertex* vrtxBuffer, unsigned int vertexCount, Index* indxBuffer, unsigned int indexCount, bool doUploadToGpu) {
     
     if (mFreeMesh.size() > 0) {
         
@@ -160,7 +146,7 @@ int Mesh::AddSubMesh(float x, float y, float z, std::vector<Vertex>& vrtxBuffer,
         for (std::vector<SubMesh>::iterator it = mFreeMesh.begin(); it != mFreeMesh.end(); ++it) {
             SubMesh freeMeshPtr = *it;
             
-            if (vrtxBuffer.size() != freeMeshPtr.vertexCount) 
+            if (vertexCount != freeMeshPtr.vertexCount) 
                 continue;
             
             mFreeMesh.erase(it);
@@ -202,24 +188,24 @@ int Mesh::AddSubMesh(float x, float y, float z, std::vector<Vertex>& vrtxBuffer,
     
     SubMesh newMesh;
     newMesh.vertexBegin = startVertex;
-    newMesh.vertexCount = vrtxBuffer.size();
+    newMesh.vertexCount = vertexCount;
     newMesh.indexBegin  = startIndex;
-    newMesh.indexCount  = indxBuffer.size();
+    newMesh.indexCount  = indexCount;
     newMesh.position    = glm::vec3(x, y, z);
     
     mSubMesh.push_back(newMesh);
     
     // Copy the buffers
-    for (std::vector<Vertex>::iterator it = vrtxBuffer.begin(); it != vrtxBuffer.end(); ++it) {
-        Vertex vertex = *it;
+    for (unsigned int i=0; i < vertexCount; i++) {
+        Vertex vertex = vrtxBuffer[i];
         vertex.x += x;
         vertex.y += y;
         vertex.z += z;
         mVertexBuffer.push_back(vertex);
     }
     
-    for (std::vector<Index>::iterator it = indxBuffer.begin(); it != indxBuffer.end(); ++it) {
-        Index index = *it;
+    for (unsigned int i=0; i < indexCount; i++) {
+        Index index = indxBuffer[i];
         index.index += startVertex;
         
         mIndexBuffer.push_back(index);
@@ -235,9 +221,11 @@ bool Mesh::RemoveSubMesh(unsigned int index) {
     if (index >= mSubMesh.size()) 
         return false;
     
-    std::vector<Vertex> destMesh;
     SubMesh sourceMesh = mSubMesh[index];
     
+    FrameVector<Vertex> destMesh;
+    destMesh.reserve(sourceMesh.vertexCount);
+    
     for (std::vector<Vertex>::iterator it = mVertexBuffer.begin() + sourceMesh.vertexBegin; it != mVertexBuffer.begin() + sourceMesh.vertexBegin + sourceMesh.vertexCount; ++it) {
         Vertex vertex;
         *it = vertex;
@@ -248,6 +236,9 @@ bool Mesh::RemoveSubMesh(unsigned int index) {
     
     mSubMesh.erase(mSubMesh.begin() + index);
     
+    if (Renderer.isHeadless) 
+        return true;
+    
     glBindVertexArray(mVertexArray);
     glBufferSubData(GL_ARRAY_BUFFER, sourceMesh.vertexBegin * sizeof(Vertex), sourceMesh.vertexCount * sizeof(Vertex), &destMesh[0]);
     
@@ -351,6 +342,7 @@ bool Mesh::ChangeSubMeshPoints(unsigned int index, std::vector<glm::vec3> points
 
 void Mesh::ClearSubMeshes(void) {
     mSubMesh.clear();
+    mFreeMesh.clear();
     mVertexBuffer.clear();
     mIndexBuffer.clear();
     return;
@@ -361,6 +353,9 @@ void Mesh::Load(void) {
     mVertexBufferSz = mVertexBuffer.size();
     mIndexBufferSz  = mIndexBuffer.size();
     
+    // Bounds are kept without a GPU for headless culling
+    CalculateBounds();
+    
     if (!mAreBuffersAllocated) {
         
         AllocateBuffers();
@@ -368,6 +363,8 @@ void Mesh::Load(void) {
         mAreBuffersAllocated = true;
     }
     
+    if (Renderer.isHeadless) 
+        return;
     
     glBindVertexArray(mVertexArray);
     
@@ -480,12 +477,83 @@ void Mesh::SetNormals(glm::vec3 normals) {
     return;
 }
 
+void Mesh::CalculateBounds(void) {
+    
+    mBoundsVersion++;
+    
+    unsigned int numberOfVertices = mVertexBuffer.size();
+    
+    mHasBounds = (numberOfVertices > 0);
+    
+    if (!mHasBounds) {
+        mBoundingBoxMin = glm::vec3(0);
+        mBoundingBoxMax = glm::vec3(0);
+        mBoundingSphereCenter = glm::vec3(0);
+        mBoundingSphereRadius = 0;
+        return;
+    }
+    
+    glm::vec3 boxMin(mVertexBuffer[0].x, mVertexBuffer[0].y, mVertexBuffer[0].z);
+    glm::vec3 boxMax(boxMin);
+    
+    for (unsigned int i=1; i < numberOfVertices; i++) {
+        
+        glm::vec3 position(mVertexBuffer[i].x, mVertexBuffer[i].y, mVertexBuffer[i].z);
+        
+        boxMin = glm::min(boxMin, position);
+        boxMax = glm::max(boxMax, position);
+    }
+    
+    mBoundingBoxMin = boxMin;
+    mBoundingBoxMax = boxMax;
+    
+    // Centered on the box and reaching the farthest vertex, which is
+    // tighter than the half diagonal for rounded meshes
+    glm::vec3 center = (boxMin + boxMax) * 0.5f;
+    
+    float radiusSq = 0;
+    
+    for (unsigned int i=0; i < numberOfVertices; i++) {
+        
+        glm::vec3 offset = glm::vec3(mVertexBuffer[i].x, mVertexBuffer[i].y, mVertexBuffer[i].z) - center;
+        
+        radiusSq = glm::max(radiusSq, glm::dot(offset, offset));
+    }
+    
+    mBoundingSphereCenter = center;
+    mBoundingSphereRadius = glm::sqrt(radiusSq);
+    
+    return;
+}
+
+bool Mesh::CheckHasBounds(void) {
+    return mHasBounds;
+}
+
+glm::vec3 Mesh::GetBoundingBoxMin(void) {
+    return mBoundingBoxMin;
+}
+
+glm::vec3 Mesh::GetBoundingBoxMax(void) {
+    return mBoundingBoxMax;
+}
+
+glm::vec3 Mesh::GetBoundingSphereCenter(void) {
+    return mBoundingSphereCenter;
+}
+
+float Mesh::GetBoundingSphereRadius(void) {
+    return mBoundingSphereRadius;
+}
+
 void Mesh::SetPrimitive(int primitiveType) {
     mPrimitive = primitiveType;
     return;
 }
 
 void Mesh::SetAttribute(int index, int attributeCount, int vertexSize, int byteOffset) {
+    if (Renderer.isHeadless) 
+        return;
     Bind();
     glEnableVertexAttribArray(index);
     GLintptr offset = byteOffset;
@@ -494,12 +562,45 @@ void Mesh::SetAttribute(int index, int attributeCount, int vertexSize, int byteO
 }
 
 void Mesh::DisableAttribute(int index) {
+    if (Renderer.isHeadless) 
+        return;
     Bind();
     glDisableVertexAttribArray(index);
     return;
 }
 
+void Mesh::SetInstanceBuffer(unsigned int instanceBuffer) {
+    if (Renderer.isHeadless) 
+        return;
+    
+    mInstanceBuffer = instanceBuffer;
+    
+    Bind();
+    
+    glBindBuffer(GL_ARRAY_BUFFER, mInstanceBuffer);
+    
+    // Model matrix columns
+    for (unsigned int i=0; i < 4; i++) 
+        SetAttribute(4 + i, 4, sizeof(Instance), offsetof(Instance, model) + i * 16);
+        
+    // Inverse transpose model matrix columns
+    for (unsigned int i=0; i < 3; i++) 
+        SetAttribute(8 + i, 3, sizeof(Instance), offsetof(Instance, normal) + i * 12);
+        
+    // Color
+    SetAttribute(11, 3, sizeof(Instance), offsetof(Instance, r));
+    
+    for (unsigned int i=4; i < 12; i++) 
+        glVertexAttribDivisor(i, 1);
+        
+    glBindBuffer(GL_ARRAY_BUFFER, mBufferVertex);
+    
+    return;
+}
+
 void Mesh::LoadVertexBuffer(Vertex* bufferData, int vertexCount) {
+    if (Renderer.isHeadless) 
+        return;
     glBindVertexArray(mVertexArray);
     glBindBuffer(GL_ARRAY_BUFFER, mBufferVertex);
     glBufferData(GL_ARRAY_BUFFER, vertexCount * sizeof(Vertex), &bufferData[0], GL_STATIC_DRAW);
@@ -507,6 +608,8 @@ void Mesh::LoadVertexBuffer(Vertex* bufferData, int vertexCount) {
 }
 
 void Mesh::LoadIndexBuffer(Index* bufferData, int indexCount) {
+    if (Renderer.isHeadless) 
+        return;
     glBindVertexArray(mVertexArray);
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mBufferIndex);
     glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexCount * sizeof(Index), &bufferData[0], GL_STATIC_DRAW);
@@ -523,6 +626,12 @@ void Mesh::AllocateBuffers(void) {
     mVertexBufferSz = mVertexBuffer.size();
     mIndexBufferSz  = mIndexBuffer.size();
     
+    // A new vertex array holds no instance attributes
+    mInstanceBuffer = 0;
+    
+    if (Renderer.isHeadless) 
+        return;
+    
     glGenVertexArrays(1, &mVertexArray);
     glBindVertexArray(mVertexArray);
     
@@ -538,6 +647,8 @@ void Mesh::AllocateBuffers(void) {
 }
 
 void Mesh::FreeBuffers(void) {
+    if (Renderer.isHeadless) 
+        return;
     glDeleteVertexArrays(1, &mVertexArray);
     glDeleteBuffers(1, &mBufferVertex);
     glDeleteBuffers(1, &mBufferIndex);
@@ -558,6 +669,13 @@ void Mesh::DrawIndexArray(void) {
     return;
 }
 
+void Mesh::DrawIndexArrayInstanced(unsigned int numberOfInstances) {
+    
+    glDrawElementsInstanced(mPrimitive, mIndexBufferSz, GL_UNSIGNED_INT, (void*)0, numberOfInstances);
+    
+    return;
+}
+
 unsigned int Mesh::GetSubMeshCount(void) {
     return mSubMesh.size();
 }
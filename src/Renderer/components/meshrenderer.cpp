@@ -1,11 +1,23 @@
 #include <GameEngineFramework/Renderer/components/meshrenderer.h>
+#include <GameEngineFramework/Renderer/BoundingVolumeHierarchy.h>
+
+#include <cfloat>
 
 
 MeshRenderer::MeshRenderer() : 
     isActive(true),
     mesh(nullptr),
     material(nullptr),
-    mDoCulling(false)
+    mDoCulling(false),
+    mDoInterpolation(true),
+    mInterpolationStep(0),
+    mPreviousMatrix(glm::mat4(1)),
+    mSortKey(0),
+    mBoundingBoxMin(-FLT_MAX),
+    mBoundingBoxMax(FLT_MAX),
+    mBoundsMesh(nullptr),
+    mBoundsVersion(0),
+    mStaticTree(nullptr)
 {
 }
 
@@ -18,3 +30,99 @@ void MeshRenderer::DisableFrustumCulling(void) {
     mDoCulling = false;
     return;
 }
+
+void MeshRenderer::EnableInterpolation(void) {
+    mDoInterpolation = true;
+    return;
+}
+
+void MeshRenderer::DisableInterpolation(void) {
+    mDoInterpolation = false;
+    return;
+}
+
+void MeshRenderer::UpdateBounds(void) {
+    
+    glm::vec3 boundsMin = mBoundingBoxMin;
+    glm::vec3 boundsMax = mBoundingBoxMax;
+    
+    mBoundsMesh    = mesh;
+    mBoundsVersion = (mesh != nullptr) ? mesh->mBoundsVersion : 0;
+    
+    // Without bounds the box covers everything so it is never culled
+    if ((mesh == nullptr) || (!mesh->mHasBounds)) {
+        
+        mBoundingBoxMin = glm::vec3(-FLT_MAX);
+        mBoundingBoxMax = glm::vec3(FLT_MAX);
+        
+    } else {
+        
+        mBoundingBoxMin = glm::vec3(FLT_MAX);
+        mBoundingBoxMax = glm::vec3(-FLT_MAX);
+        
+        GrowBounds(transform.matrix);
+    }
+    
+    NotifyBoundsChanged(boundsMin, boundsMax);
+    
+    return;
+}
+
+glm::vec3 MeshRenderer::GetBoundingBoxMin(void) {
+    return mBoundingBoxMin;
+}
+
+glm::vec3 MeshRenderer::GetBoundingBoxMax(void) {
+    return mBoundingBoxMax;
+}
+
+void MeshRenderer::ExpandBounds(const glm::mat4& matrix) {
+    
+    glm::vec3 boundsMin = mBoundingBoxMin;
+    glm::vec3 boundsMax = mBoundingBoxMax;
+    
+    GrowBounds(matrix);
+    
+    NotifyBoundsChanged(boundsMin, boundsMax);
+    
+    return;
+}
+
+void MeshRenderer::GrowBounds(const glm::mat4& matrix) {
+    
+    if ((mBoundsMesh == nullptr) || (!mBoundsMesh->mHasBounds)) 
+        return;
+        
+    glm::vec3 center = (mBoundsMesh->mBoundingBoxMin + mBoundsMesh->mBoundingBoxMax) * 0.5f;
+    glm::vec3 extent = (mBoundsMesh->mBoundingBoxMax - mBoundsMesh->mBoundingBoxMin) * 0.5f;
+    
+    // The extent along each world axis is the absolute projection of every local axis
+    glm::vec3 worldCenter = glm::vec3( matrix * glm::vec4(center, 1.0f) );
+    glm::vec3 worldExtent = glm::abs( glm::vec3(matrix[0]) ) * extent.x + 
+                            glm::abs( glm::vec3(matrix[1]) ) * extent.y + 
+                            glm::abs( glm::vec3(matrix[2]) ) * extent.z;
+                            
+    mBoundingBoxMin = glm::min(mBoundingBoxMin, worldCenter - worldExtent);
+    mBoundingBoxMax = glm::max(mBoundingBoxMax, worldCenter + worldExtent);
+    
+    return;
+}
+
+bool MeshRenderer::CheckBoundsAreStale(void) {
+    
+    if (mBoundsMesh != mesh) 
+        return true;
+        
+    return (mesh != nullptr) && (mBoundsVersion != mesh->mBoundsVersion);
+}
+
+void MeshRenderer::NotifyBoundsChanged(const glm::vec3& boundsMin, const glm::vec3& boundsMax) {
+    
+    if (mStaticTree == nullptr) 
+        return;
+        
+    if ((boundsMin != mBoundingBoxMin) || (boundsMax != mBoundingBoxMax)) 
+        mStaticTree->MarkBoundsChanged();
+        
+    return;
+}
@@ -49,6 +49,24 @@ bool Scene::RemoveMeshRendererFromSceneRoot(MeshRenderer* meshRenderer, int rend
     return false;    
 }
 
+void Scene::AddStaticMeshRendererToSceneRoot(MeshRenderer* meshRenderer, int renderQueueGroup) {
+    mStaticRenderQueue[ GetStaticQueueIndex(renderQueueGroup) ].Insert( meshRenderer );
+    return;
+}
+
+bool Scene::RemoveStaticMeshRendererFromSceneRoot(MeshRenderer* meshRenderer, int renderQueueGroup) {
+    return mStaticRenderQueue[ GetStaticQueueIndex(renderQueueGroup) ].Remove( meshRenderer );
+}
+
+unsigned int Scene::GetStaticQueueIndex(int renderQueueGroup) {
+    
+    // Unknown groups fall into the geometry queue
+    if ((renderQueueGroup < RENDER_QUEUE_SKY) | (renderQueueGroup > RENDER_QUEUE_OVERLAY)) 
+        renderQueueGroup = RENDER_QUEUE_GEOMETRY;
+        
+    return renderQueueGroup - RENDER_QUEUE_SKY;
+}
+
 void Scene::AddLightToSceneRoot(Light* light) {
     mLightList.push_back( light );
     return;
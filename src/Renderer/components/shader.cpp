@@ -1,10 +1,13 @@
 #include <GameEngineFramework/Renderer/components/shader.h>
+#include <GameEngineFramework/Renderer/RenderSystem.h>
 
 #define GLEW_STATIC
-#include <gl/glew.h>
+#include "../../../vendor/gl/glew.h"
 
 #include <iostream>
 
+extern RenderSystem Renderer;
+
 
 Shader::Shader() : 
     mShaderProgram(0),
@@ -28,7 +31,11 @@ Shader::Shader() :
     mLightAttenuation(0),
     mLightColor(0),
     
-    mIsShaderLoaded(false)
+    mIsShaderLoaded(false),
+    mIsInstanced(false),
+    
+    mUniformEpoch(0),
+    mUniformMaterial(nullptr)
 {
 }
 
@@ -159,6 +166,10 @@ void Shader::SetUniformLocations(void) {
 
 int Shader::CreateShaderProgram(std::string VertexScript, std::string FragmentScript) {
     
+    // Nothing to compile against without a render context
+    if (Renderer.isHeadless) 
+        return 1;
+    
     // Compile the scripts into a shader program
     unsigned int vs = CompileSource(GL_VERTEX_SHADER,   VertexScript);
     unsigned int fs = CompileSource(GL_FRAGMENT_SHADER, FragmentScript);
@@ -188,6 +199,9 @@ int Shader::CreateShaderProgram(std::string VertexScript, std::string FragmentSc
     
     SetUniformLocations();
     
+    // Programs taking the model matrix as an attribute are drawn instanced
+    mIsInstanced = glGetAttribLocation(mShaderProgram, "l_instance_model") >= 0;
+    
     mIsShaderLoaded = true;
     return 1;
 }
@@ -196,6 +210,10 @@ unsigned int Shader::GetProgram(void) {
     return mShaderProgram;
 }
 
+bool Shader::CheckIsInstanced(void) {
+    return mIsInstanced;
+}
+
 unsigned int Shader::CompileSource(unsigned int Type, std::string Script) {
     
     unsigned int ShaderID = glCreateShader(Type);
@@ -1,20 +1,29 @@
 #include <GameEngineFramework/Renderer/components/texture.h>
+#include <GameEngineFramework/Renderer/RenderSystem.h>
 
 #define GLEW_STATIC
-#include <gl/glew.h>
+#include "../../../vendor/gl/glew.h"
+
+extern RenderSystem Renderer;
 
 
 Texture::Texture() : 
+    mTextureBuffer(0),
     mWidth(0),
     mHeight(0),
     mFiltration(GL_LINEAR_MIPMAP_LINEAR)
 {
+    if (Renderer.isHeadless) 
+        return;
+    
     glGenTextures(1, &mTextureBuffer);
     
     return;
 }
 
 Texture::~Texture() {
+    if (Renderer.isHeadless) 
+        return;
     glDeleteTextures(1, &mTextureBuffer);
     return;
 }
@@ -43,6 +52,13 @@ void Texture::BindTextureSlot(unsigned int slot) {
 
 void Texture::UploadTextureToGPU(void* textureData, unsigned int width, unsigned int height, int filtrationType) {
     
+    mWidth      = width;
+    mHeight     = height;
+    mFiltration = filtrationType;
+    
+    if (Renderer.isHeadless) 
+        return;
+    
     glBindTexture(GL_TEXTURE_2D, mTextureBuffer);
     
     glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, textureData);
@@ -53,10 +69,6 @@ void Texture::UploadTextureToGPU(void* textureData, unsigned int width, unsigned
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, filtrationType);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
     
-    mWidth      = width;
-    mHeight     = height;
-    mFiltration = filtrationType;
-    
     glGenerateMipmap(GL_TEXTURE_2D);
     
     return;
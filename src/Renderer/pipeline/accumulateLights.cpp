@@ -1,7 +1,7 @@
-#include <GameEngineFramework/Renderer/rendersystem.h>
+#include <GameEngineFramework/Renderer/RenderSystem.h>
 #include <GameEngineFramework/Logging/Logging.h>
 
-#include <GameEngineFramework/Types/types.h>
+#include <GameEngineFramework/Types/Types.h>
 
 
 unsigned int RenderSystem::accumulateSceneLights(Scene* currentScene, glm::vec3 eye) {
@@ -1,7 +1,7 @@
-#include <GameEngineFramework/Renderer/rendersystem.h>
+#include <GameEngineFramework/Renderer/RenderSystem.h>
 #include <GameEngineFramework/Logging/Logging.h>
 
-#include <GameEngineFramework/Types/types.h>
+#include <GameEngineFramework/Types/Types.h>
 
 
 bool RenderSystem::BindMaterial(Material* materialPtr) {
@@ -14,6 +14,8 @@ bool RenderSystem::BindMaterial(Material* materialPtr) {
     mCurrentMaterial->texture.Bind();
     mCurrentMaterial->texture.BindTextureSlot(0);
     
+    mNumberOfMaterialBinds++;
+    
     // Depth testing
     
     if (mCurrentMaterial->mDoDepthTest) {
@@ -1,7 +1,7 @@
-#include <GameEngineFramework/Renderer/rendersystem.h>
+#include <GameEngineFramework/Renderer/RenderSystem.h>
 #include <GameEngineFramework/Logging/Logging.h>
 
-#include <GameEngineFramework/Types/types.h>
+#include <GameEngineFramework/Types/Types.h>
 
 
 bool RenderSystem::BindMesh(Mesh* meshPtr) {
@@ -13,6 +13,8 @@ bool RenderSystem::BindMesh(Mesh* meshPtr) {
     
     mCurrentMesh->Bind();
     
+    mNumberOfMeshBinds++;
+    
     return true;
 }
 
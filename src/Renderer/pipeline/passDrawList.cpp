@@ -0,0 +1,122 @@
+#include <GameEngineFramework/Renderer/RenderSystem.h>
+#include <GameEngineFramework/Logging/Logging.h>
+
+#include <GameEngineFramework/Types/Types.h>
+
+
+unsigned int RenderSystem::DrawListPass(std::vector<MeshRenderer*>* renderQueueGroup, FrameVector<MeshRenderer*>& staticRenderers, unsigned int queueGroupIndex, FrameVector<RenderQueueSort::Entry>& drawList) {
+    
+    unsigned int numberOfRenderers = renderQueueGroup->size();
+    
+    drawList.clear();
+    drawList.reserve( numberOfRenderers + staticRenderers.size() );
+    
+    FrameVector<MeshRenderer*> candidates;
+    candidates.reserve( numberOfRenderers );
+    
+    // World bounds of the renderers being culled
+    FrameVector<float> boundsMinX;
+    FrameVector<float> boundsMinY;
+    FrameVector<float> boundsMinZ;
+    FrameVector<float> boundsMaxX;
+    FrameVector<float> boundsMaxY;
+    FrameVector<float> boundsMaxZ;
+    
+    for (unsigned int i=0; i < numberOfRenderers; i++) {
+        
+        MeshRenderer* currentEntity = (*renderQueueGroup)[i];
+        
+        if (!currentEntity->isActive) 
+            continue;
+            
+        if ((currentEntity->mesh == nullptr) | (currentEntity->material == nullptr)) 
+            continue;
+            
+        if (currentEntity->material->shader == nullptr) 
+            continue;
+            
+        candidates.push_back( currentEntity );
+        
+        if (!currentEntity->mDoCulling) 
+            continue;
+            
+        if (currentEntity->CheckBoundsAreStale()) 
+            currentEntity->UpdateBounds();
+            
+        boundsMinX.push_back( currentEntity->mBoundingBoxMin.x );
+        boundsMinY.push_back( currentEntity->mBoundingBoxMin.y );
+        boundsMinZ.push_back( currentEntity->mBoundingBoxMin.z );
+        boundsMaxX.push_back( currentEntity->mBoundingBoxMax.x );
+        boundsMaxY.push_back( currentEntity->mBoundingBoxMax.y );
+        boundsMaxZ.push_back( currentEntity->mBoundingBoxMax.z );
+    }
+    
+    // Test the culled renderers against the frustum several at a time
+    unsigned int numberOfCulled = boundsMinX.size();
+    
+    FrameVector<unsigned char> visible( numberOfCulled );
+    
+    Frustum::BoxArrays boxes;
+    boxes.minX = boundsMinX.data();
+    boxes.minY = boundsMinY.data();
+    boxes.minZ = boundsMinZ.data();
+    boxes.maxX = boundsMaxX.data();
+    boxes.maxY = boundsMaxY.data();
+    boxes.maxZ = boundsMaxZ.data();
+    
+    mFrustum.CheckBoxes( boxes, numberOfCulled, visible.data() );
+    
+    unsigned int cullIndex = 0;
+    
+    for (unsigned int i=0; i < candidates.size(); i++) {
+        
+        MeshRenderer* currentEntity = candidates[i];
+        
+        if (currentEntity->mDoCulling) 
+            if (visible[cullIndex++] == 0) 
+                continue;
+                
+        RenderQueueSort::Entry entry;
+        entry.key      = currentEntity->mSortKey;
+        entry.renderer = currentEntity;
+        
+        drawList.push_back( entry );
+    }
+    
+    unsigned int numberOfDynamic = drawList.size();
+    
+    // Static renderers were culled by the scene hierarchy
+    for (unsigned int i=0; i < staticRenderers.size(); i++) {
+        
+        MeshRenderer* currentEntity = staticRenderers[i];
+        
+        if (!currentEntity->isActive) 
+            continue;
+            
+        if ((currentEntity->mesh == nullptr) | (currentEntity->material == nullptr)) 
+            continue;
+            
+        if (currentEntity->material->shader == nullptr) 
+            continue;
+            
+        RenderQueueSort::Entry entry;
+        entry.key      = currentEntity->mSortKey;
+        entry.renderer = currentEntity;
+        
+        drawList.push_back( entry );
+    }
+    
+    unsigned int queueGroup = queueGroupIndex + RENDER_QUEUE_SKY;
+    
+    FrameVector<RenderQueueSort::Entry> scratch( drawList.size() );
+    
+    // Queues sorted by depth keep that order across the static renderers.
+    // Opaque geometry is then grouped by shader, material and mesh while
+    // other queues are drawn in queue order
+    bool doMergeByDepth = (queueGroup >= RENDER_QUEUE_PREGEOMETRY) & (queueGroup <= RENDER_QUEUE_POSTGEOMETRY);
+    bool doGroupByState = (queueGroup == RENDER_QUEUE_PREGEOMETRY) | (queueGroup == RENDER_QUEUE_GEOMETRY);
+    
+    RenderQueueSort::SortDrawList( drawList.data(), scratch.data(), numberOfDynamic, drawList.size(), doMergeByDepth, doGroupByState );
+    
+    return drawList.size();
+}
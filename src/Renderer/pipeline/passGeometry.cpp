@@ -1,7 +1,7 @@
-#include <GameEngineFramework/Renderer/rendersystem.h>
+#include <GameEngineFramework/Renderer/RenderSystem.h>
 #include <GameEngineFramework/Logging/Logging.h>
 
-#include <GameEngineFramework/Types/types.h>
+#include <GameEngineFramework/Types/Types.h>
 
 
 bool RenderSystem::GeometryPass(MeshRenderer* currentEntity, glm::vec3& eye, glm::vec3 cameraAngle, glm::mat4& viewProjection) {
@@ -36,23 +36,21 @@ bool RenderSystem::GeometryPass(MeshRenderer* currentEntity, glm::vec3& eye, glm
     
     BindShader( shaderPtr );
     
-    // Set the projection
+    SetShaderUniforms( eye, cameraAngle, viewProjection );
     
-    mCurrentShader->SetProjectionMatrix( viewProjection );
-    mCurrentShader->SetModelMatrix( currentEntity->transform.matrix );
+    // Model matrix between the last two simulation steps
+    glm::mat4 modelMatrix;
+    glm::mat3 normalMatrix;
     
-    // Inverse transpose model matrix for lighting with non linear scaling
-    glm::mat3 invTransposeMatrix = glm::transpose( glm::inverse( currentEntity->transform.matrix ) );
+    InterpolationPass( currentEntity, modelMatrix, normalMatrix );
     
-    mCurrentShader->SetInverseModelMatrix( invTransposeMatrix );
+    mCurrentShader->SetModelMatrix( modelMatrix );
     
-    mCurrentShader->SetCameraPosition(eye);
-    mCurrentShader->SetCameraAngle(cameraAngle);
+    // Inverse transpose model matrix for lighting with non linear scaling.
+    // Built alongside the model matrix by the transform update
+    mCurrentShader->SetInverseModelMatrix( normalMatrix );
     
-    // Set the material
-    mCurrentShader->SetMaterialAmbient(mCurrentMaterial->ambient);
-    mCurrentShader->SetMaterialDiffuse(mCurrentMaterial->diffuse);
-    mCurrentShader->SetMaterialSpecular(mCurrentMaterial->specular);
+    mNumberOfUniformUploads += 2;
     
     // Render the geometry
     currentEntity->mesh->DrawIndexArray();
@@ -0,0 +1,114 @@
+#include <GameEngineFramework/Renderer/RenderSystem.h>
+#include <GameEngineFramework/Logging/Logging.h>
+
+#include <GameEngineFramework/Types/Types.h>
+
+#include <cstring>
+
+
+unsigned int RenderSystem::InstancingPass(RenderQueueSort::Entry* drawList, unsigned int numberOfDraws, glm::vec3& eye, glm::vec3 cameraAngle, glm::mat4& viewProjection) {
+    
+    MeshRenderer* firstEntity = drawList[0].renderer;
+    
+    Mesh*     meshPtr     = firstEntity->mesh;
+    Material* materialPtr = firstEntity->material;
+    Shader*   shaderPtr   = materialPtr->shader;
+    
+    // Run of renderers which differ only by their transform and diffuse color
+    unsigned int numberOfInstances = 1;
+    
+    while (numberOfInstances < numberOfDraws) {
+        
+        MeshRenderer* currentEntity = drawList[numberOfInstances].renderer;
+        
+        if ((currentEntity->mesh != meshPtr) | (currentEntity->material->shader != shaderPtr)) 
+            break;
+            
+        if (!CheckMaterialStateMatches(materialPtr, currentEntity->material)) 
+            break;
+            
+        numberOfInstances++;
+    }
+    
+    BindMesh( meshPtr );
+    BindMaterial( materialPtr );
+    BindShader( shaderPtr );
+    
+    SetShaderUniforms( eye, cameraAngle, viewProjection );
+    
+    // Gather the instance attributes
+    FrameVector<Instance> instances( numberOfInstances );
+    
+    for (unsigned int i=0; i < numberOfInstances; i++) {
+        
+        MeshRenderer* currentEntity = drawList[i].renderer;
+        
+        // Model matrix between the last two simulation steps
+        glm::mat4 modelMatrix;
+        glm::mat3 normalMatrix;
+        
+        InterpolationPass( currentEntity, modelMatrix, normalMatrix );
+        
+        std::memcpy(instances[i].model,  &modelMatrix[0][0],  sizeof(instances[i].model));
+        std::memcpy(instances[i].normal, &normalMatrix[0][0], sizeof(instances[i].normal));
+        
+        instances[i].r = currentEntity->material->diffuse.r;
+        instances[i].g = currentEntity->material->diffuse.g;
+        instances[i].b = currentEntity->material->diffuse.b;
+    }
+    
+    // Orphan the previous contents rather than wait on draws still reading them
+    glBindBuffer(GL_ARRAY_BUFFER, mInstanceBuffer);
+    glBufferData(GL_ARRAY_BUFFER, numberOfInstances * sizeof(Instance), instances.data(), GL_STREAM_DRAW);
+    
+    // The vertex array keeps pointing into the instance buffer once set
+    if (meshPtr->mInstanceBuffer != mInstanceBuffer) 
+        meshPtr->SetInstanceBuffer( mInstanceBuffer );
+        
+    // Render the geometry
+    meshPtr->DrawIndexArrayInstanced( numberOfInstances );
+    
+    mNumberOfDrawCalls++;
+    mNumberOfInstances += numberOfInstances;
+    
+    return numberOfInstances;
+}
+
+bool RenderSystem::CheckMaterialStateMatches(Material* materialA, Material* materialB) {
+    
+    if (materialA == materialB) 
+        return true;
+        
+    if (materialA->texture.mTextureBuffer != materialB->texture.mTextureBuffer) 
+        return false;
+        
+    // Colors sent through uniforms
+    if ((materialA->ambient.r != materialB->ambient.r) |
+        (materialA->ambient.g != materialB->ambient.g) |
+        (materialA->ambient.b != materialB->ambient.b)) 
+        return false;
+        
+    if ((materialA->specular.r != materialB->specular.r) |
+        (materialA->specular.g != materialB->specular.g) |
+        (materialA->specular.b != materialB->specular.b)) 
+        return false;
+        
+    // Render state
+    if ((materialA->mDoDepthTest   != materialB->mDoDepthTest) |
+        (materialA->mDoBlending    != materialB->mDoBlending) |
+        (materialA->mDoFaceCulling != materialB->mDoFaceCulling)) 
+        return false;
+        
+    if ((materialA->mDepthFunc != materialB->mDepthFunc) |
+        (materialA->mFaceWinding != materialB->mFaceWinding) |
+        (materialA->mFaceCullSide != materialB->mFaceCullSide)) 
+        return false;
+        
+    if ((materialA->mBlendSource != materialB->mBlendSource) |
+        (materialA->mBlendDestination != materialB->mBlendDestination) |
+        (materialA->mBlendAlphaSource != materialB->mBlendAlphaSource) |
+        (materialA->mBlendAlphaDestination != materialB->mBlendAlphaDestination)) 
+        return false;
+        
+    return true;
+}
@@ -0,0 +1,25 @@
+#include <GameEngineFramework/Renderer/RenderSystem.h>
+#include <GameEngineFramework/Math/TransformBatch.h>
+
+#include <cstring>
+
+
+bool RenderSystem::InterpolationPass(MeshRenderer* currentEntity, glm::mat4& matrix, glm::mat3& normalMatrix) {
+    
+    // Only renderers moved by the latest simulation step have a previous matrix to blend from
+    if ((!currentEntity->mDoInterpolation) | 
+        (currentEntity->mInterpolationStep != mInterpolationStep) | 
+        (mInterpolationFactor >= 1.0f) | 
+        (std::memcmp(&currentEntity->mPreviousMatrix, &currentEntity->transform.matrix, sizeof(glm::mat4)) == 0)) {
+        
+        matrix       = currentEntity->transform.matrix;
+        normalMatrix = currentEntity->transform.normalMatrix;
+        
+        return false;
+    }
+    
+    matrix       = TransformBatch::InterpolateMatrix(currentEntity->mPreviousMatrix, currentEntity->transform.matrix, mInterpolationFactor);
+    normalMatrix = TransformBatch::CalculateNormalMatrix(matrix);
+    
+    return true;
+}
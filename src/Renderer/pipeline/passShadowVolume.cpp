@@ -1,7 +1,7 @@
-#include <GameEngineFramework/Renderer/rendersystem.h>
+#include <GameEngineFramework/Renderer/RenderSystem.h>
 #include <GameEngineFramework/Logging/Logging.h>
 
-#include <GameEngineFramework/Types/types.h>
+#include <GameEngineFramework/Types/Types.h>
 
 
 bool RenderSystem::ShadowVolumePass(MeshRenderer* currentEntity, glm::vec3& eye, glm::vec3 cameraAngle, glm::mat4& viewProjection) {
@@ -18,9 +18,18 @@ bool RenderSystem::ShadowVolumePass(MeshRenderer* currentEntity, glm::vec3& eye,
     if (shadowDistance > mShadowDistance) 
         return false;
     
+    // Follow the renderer between the last two simulation steps
+    glm::vec3 position = currentEntity->transform.position;
+    
+    glm::mat4 interpolatedMatrix;
+    glm::mat3 interpolatedNormalMatrix;
+    
+    if (InterpolationPass( currentEntity, interpolatedMatrix, interpolatedNormalMatrix )) 
+        position += glm::vec3( interpolatedMatrix[3] ) - glm::vec3( currentEntity->transform.matrix[3] );
+    
     // Strip out model rotation to prevent shadow rotation
     glm::mat4 modelMatrix = glm::identity<glm::mat4>();
-    modelMatrix = glm::translate(modelMatrix, currentEntity->transform.position);
+    modelMatrix = glm::translate(modelMatrix, position);
     modelMatrix = glm::scale(modelMatrix, currentEntity->transform.scale);
     
     shaders.shadowCaster->SetProjectionMatrix( viewProjection );
@@ -33,27 +42,26 @@ bool RenderSystem::ShadowVolumePass(MeshRenderer* currentEntity, glm::vec3& eye,
     
     glEnable( GL_CULL_FACE );
     
+    // The entity rotation, offset and length do not depend
+    // on the light so they are composed once for every shadow
+    float shadowLength = currentEntity->material->mShadowVolumeLength;
+    
+    // Rotate by the inverse light angle
+    glm::vec3 angles = glm::radians( currentEntity->transform.EulerAngles() );
+    
+    glm::mat4 entityMatrix = glm::rotate(glm::mat4(1), angles.x, glm::vec3(1, 0, 0));
+    entityMatrix = glm::rotate(entityMatrix, angles.y, glm::vec3(0, 1, 0));
+    entityMatrix = glm::rotate(entityMatrix, angles.z, glm::vec3(0, 0, 1));
+    
+    // Offset by half the distance
+    entityMatrix = glm::translate(entityMatrix, glm::vec3(0, -1, 0) * shadowLength);
+    
+    // Scale the length of the shadow
+    entityMatrix = glm::scale(entityMatrix, glm::vec3(1, shadowLength * 2, 1));
+    
     for (unsigned int s=0; s < mNumberOfShadows; s++) {
         
-        float shadowLength = currentEntity->material->mShadowVolumeLength;
-        
-        mShadowTransform.SetIdentity();
-        
-        mShadowTransform.RotateWorldAxis( 180, mShadowDirection[s], Vector3(0, 0, 0) );
-        
-        // Rotate by the inverse light angle
-        glm::vec3 angles = currentEntity->transform.EulerAngles();
-        
-        mShadowTransform.RotateWorldAxis( angles.x, glm::vec3(1, 0, 0), Vector3(0, 0, 0) );
-        mShadowTransform.RotateWorldAxis( angles.y, glm::vec3(0, 1, 0), Vector3(0, 0, 0) );
-        mShadowTransform.RotateWorldAxis( angles.z, glm::vec3(0, 0, 1), Vector3(0, 0, 0) );
-        
-        // Offset by half the distance
-        glm::vec3 shadowTranslation = (glm::vec3(0, -1, 0) * shadowLength);
-        mShadowTransform.Translate( shadowTranslation );
-        
-        // Scale the length of the shadow
-        mShadowTransform.Scale( glm::vec3(1, shadowLength * 2, 1) );
+        glm::mat4 shadowMatrix = glm::rotate(glm::mat4(1), glm::radians(180.0f), glm::normalize( mShadowDirection[s] )) * entityMatrix;
         
         glm::vec3 shadowPosition[1];
         glm::vec3 shadowDirection[1];
@@ -81,7 +89,7 @@ bool RenderSystem::ShadowVolumePass(MeshRenderer* currentEntity, glm::vec3& eye,
         shaders.shadowCaster->SetLightAttenuation(1, shadowAttenuation);
         shaders.shadowCaster->SetLightColors(1,      shadowColor);
         
-        shaders.shadowCaster->SetShadowMatrix( mShadowTransform.matrix );
+        shaders.shadowCaster->SetShadowMatrix( shadowMatrix );
         
         // Render the shadow pass
         mNumberOfDrawCalls++;
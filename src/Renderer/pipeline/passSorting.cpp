@@ -1,80 +1,67 @@
-#include <GameEngineFramework/Renderer/rendersystem.h>
+#include <GameEngineFramework/Renderer/RenderSystem.h>
+#include <GameEngineFramework/Renderer/RenderQueueSort.h>
 #include <GameEngineFramework/Logging/Logging.h>
 
-#include <GameEngineFramework/Types/types.h>
+#include <GameEngineFramework/Types/Types.h>
+#include <GameEngineFramework/MemoryAllocation/FrameArena.h>
 
 
-bool RenderSystem::SortingPass(glm::vec3& eye, std::vector<MeshRenderer*>* renderQueueGroup, unsigned int queueGroupIndex) {
+bool RenderSystem::SortingPass(glm::vec3& eye, MeshRenderer** renderers, unsigned int numberOfRenderers, unsigned int queueGroupIndex) {
     
-    std::vector<std::pair<float, MeshRenderer*>> sortList;
+    // Queue groups are indexed from the sky queue
+    unsigned int queueGroup = queueGroupIndex + RENDER_QUEUE_SKY;
     
-    std::vector<MeshRenderer*> renderQueue = *renderQueueGroup;
+    // Opaque geometry is drawn front to back to save overdraw and
+    // blended geometry back to front. The other queues keep the order
+    // they were submitted in
+    bool isBackToFront;
     
-    for (unsigned int i=0; i < renderQueue.size(); i++) {
+    switch (queueGroup) {
         
-        std::pair<float, MeshRenderer*> renderPair;
+        case RENDER_QUEUE_PREGEOMETRY: 
+        case RENDER_QUEUE_GEOMETRY:     isBackToFront = false; break;
+        case RENDER_QUEUE_POSTGEOMETRY: isBackToFront = true;  break;
         
-        renderPair.first = glm::distance( eye, renderQueue[i]->transform.position );
-        renderPair.second = renderQueue[i];
-        
-        sortList.push_back( renderPair );
-        
-    }
-    
-    std::sort(sortList.begin(), sortList.end(), [](std::pair<float, MeshRenderer*> a, std::pair<float, MeshRenderer*> b) {
-        return a.first < b.first;
-    });
-    
-    for (unsigned int i=0; i < renderQueue.size(); i++) {
-        renderQueue[i] = sortList[i].second;
+        default: return false;
     }
     
-    /*
-    
-    // Synchronize the sorting list
-    if (mRenderQueueSorter[queueGroupIndex].size() != renderQueueGroup->size()) {
+    // A lone renderer still needs its key to be merged with other lists
+    if (numberOfRenderers == 0) 
+        return false;
         
-        mRenderQueueSorter[queueGroupIndex].clear();
+    FrameArena& arena = FrameArena::GetThreadArena();
+    FrameArenaMarker marker = arena.GetMarker();
+    
+    {
+        // Sort buffers are drawn from the frame arena to avoid heap traffic every frame
+        FrameVector<RenderQueueSort::Entry> entries( numberOfRenderers );
+        FrameVector<RenderQueueSort::Entry> scratch( numberOfRenderers );
         
-        for (unsigned int i=0; i < renderQueueGroup->size(); i++) {
+        for (unsigned int i=0; i < numberOfRenderers; i++) {
+            
+            MeshRenderer* meshRenderer = renderers[i];
             
-            MeshRenderer* meshRenderer = *(renderQueueGroup->data() + i);
+            glm::vec3 offset = meshRenderer->transform.position - eye;
             
-            std::pair<float, MeshRenderer*> distancePair;
+            unsigned int depthBucket = RenderQueueSort::GetDepthBucket( glm::dot(offset, offset), isBackToFront );
             
-            distancePair.first  = 0;
-            distancePair.second = meshRenderer;
+            Material* materialPtr = meshRenderer->material;
+            Shader*   shaderPtr   = (materialPtr != nullptr) ? materialPtr->shader : nullptr;
             
-            mRenderQueueSorter[queueGroupIndex].push_back( distancePair );
+            meshRenderer->mSortKey = RenderQueueSort::BuildKey(queueGroup, depthBucket, shaderPtr, materialPtr, meshRenderer->mesh);
             
-            continue;
+            entries[i].key      = meshRenderer->mSortKey;
+            entries[i].renderer = meshRenderer;
         }
         
-    }
-    
-    // Sort them out
-    for (unsigned int i=0; i < renderQueueGroup->size(); i++) 
-        mRenderQueueSorter[queueGroupIndex][i].first = glm::distance( eye, mRenderQueueSorter[queueGroupIndex][i].second->transform.position );
-     
-    std::sort(mRenderQueueSorter[queueGroupIndex].begin(), 
-              mRenderQueueSorter[queueGroupIndex].end(), 
-              [](std::pair<float, MeshRenderer*> a, std::pair<float, MeshRenderer*> b) {
-        return a.first > b.first;
-    });
-    
-    // Restore the sorted renderers
-    renderQueueGroup->clear();
-    
-    for (unsigned int i=0; i < mRenderQueueSorter[queueGroupIndex].size(); i++) {
-        
-        renderQueueGroup->push_back( mRenderQueueSorter[queueGroupIndex][i].second );
-        
-        //*(renderQueueGroup->data() + i) = mRenderQueueSorter[queueGroupIndex][i].second;
+        RenderQueueSort::Sort( entries.data(), scratch.data(), numberOfRenderers );
         
+        // Keep the order so the next frame starts nearly sorted
+        for (unsigned int i=0; i < numberOfRenderers; i++) 
+            renderers[i] = entries[i].renderer;
     }
     
-    */
+    arena.Rewind( marker );
     
     return true;
 }
-
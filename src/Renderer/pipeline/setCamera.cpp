@@ -1,7 +1,7 @@
-#include <GameEngineFramework/Renderer/rendersystem.h>
+#include <GameEngineFramework/Renderer/RenderSystem.h>
 #include <GameEngineFramework/Logging/Logging.h>
 
-#include <GameEngineFramework/Types/types.h>
+#include <GameEngineFramework/Types/Types.h>
 extern MathCore  Math;
 
 
@@ -20,6 +20,10 @@ bool RenderSystem::setTargetCamera(Camera* currentCamera, glm::vec3& eye, glm::m
     eye.y = currentCamera->transform.position.y;
     eye.z = currentCamera->transform.position.z;
     
+    // Between the last two simulation steps
+    if (currentCamera->mInterpolationStep == mInterpolationStep) 
+        eye = glm::mix(currentCamera->mPreviousPosition, eye, mInterpolationFactor);
+    
     // Forward looking angle
     currentCamera->forward.x = cos( (currentCamera->transform.rotation.x * 180) / glm::pi<float>() );
     currentCamera->forward.y = tan( (currentCamera->transform.rotation.y * 180) / glm::pi<float>() );
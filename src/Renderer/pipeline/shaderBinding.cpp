@@ -1,7 +1,7 @@
-#include <GameEngineFramework/Renderer/rendersystem.h>
+#include <GameEngineFramework/Renderer/RenderSystem.h>
 #include <GameEngineFramework/Logging/Logging.h>
 
-#include <GameEngineFramework/Types/types.h>
+#include <GameEngineFramework/Types/Types.h>
 
 
 bool RenderSystem::BindShader(Shader* shaderPtr) {
@@ -13,15 +13,49 @@ bool RenderSystem::BindShader(Shader* shaderPtr) {
     
     mCurrentShader->Bind();
     
-    mCurrentShader->SetTextureSampler(0);
-    
-    // Send in the light list
-    mCurrentShader->SetLightCount(mNumberOfLights);
-    mCurrentShader->SetLightPositions(mNumberOfLights, mLightPosition);
-    mCurrentShader->SetLightDirections(mNumberOfLights, mLightDirection);
-    mCurrentShader->SetLightAttenuation(mNumberOfLights, mLightAttenuation);
-    mCurrentShader->SetLightColors(mNumberOfLights, mLightColor);
+    mNumberOfShaderBinds++;
     
     return true;
 }
 
+void RenderSystem::SetShaderUniforms(glm::vec3& eye, glm::vec3 cameraAngle, glm::mat4& viewProjection) {
+    
+    // Uniforms stay with the program between binds so the camera,
+    // sampler and light list are only sent once for every scene
+    if (mCurrentShader->mUniformEpoch != mUniformEpoch) {
+        
+        mCurrentShader->mUniformEpoch    = mUniformEpoch;
+        mCurrentShader->mUniformMaterial = nullptr;
+        
+        // Set the projection
+        mCurrentShader->SetProjectionMatrix( viewProjection );
+        mCurrentShader->SetCameraPosition(eye);
+        mCurrentShader->SetCameraAngle(cameraAngle);
+        
+        mCurrentShader->SetTextureSampler(0);
+        
+        // Send in the light list
+        mCurrentShader->SetLightCount(mNumberOfLights);
+        mCurrentShader->SetLightPositions(mNumberOfLights, mLightPosition);
+        mCurrentShader->SetLightDirections(mNumberOfLights, mLightDirection);
+        mCurrentShader->SetLightAttenuation(mNumberOfLights, mLightAttenuation);
+        mCurrentShader->SetLightColors(mNumberOfLights, mLightColor);
+        
+        mNumberOfUniformUploads += 9;
+    }
+    
+    // Set the material once for every run of draws sharing it
+    if (mCurrentShader->mUniformMaterial != mCurrentMaterial) {
+        
+        mCurrentShader->mUniformMaterial = mCurrentMaterial;
+        
+        mCurrentShader->SetMaterialAmbient(mCurrentMaterial->ambient);
+        mCurrentShader->SetMaterialDiffuse(mCurrentMaterial->diffuse);
+        mCurrentShader->SetMaterialSpecular(mCurrentMaterial->specular);
+        
+        mNumberOfUniformUploads += 3;
+    }
+    
+    return;
+}
+
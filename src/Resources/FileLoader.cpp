@@ -1,6 +1,6 @@
 #include <GameEngineFramework/Resources/FileLoader.h>
 
-#include <GameEngineFramework/Types/types.h>
+#include <GameEngineFramework/Types/Types.h>
 
 extern StringType String;
 
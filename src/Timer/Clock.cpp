@@ -0,0 +1,197 @@
+#include <GameEngineFramework/Timer/Clock.h>
+
+#include <atomic>
+#include <mutex>
+
+#ifdef _WIN32
+  #ifndef _WIN32_WINNT
+    #define _WIN32_WINNT 0x500
+  #endif
+
+  #define WIN32_LEAN_AND_MEAN
+
+  #include <sdkddkver.h>
+  #include <windows.h>
+#else
+  #include <time.h>
+#endif
+
+// The counter is converted with a 128 bit multiply
+#if defined(__GNUC__) && defined(__x86_64__) && defined(__SIZEOF_INT128__)
+  #define CLOCK_TSC_X86
+  #include <x86intrin.h>
+  #include <cpuid.h>
+#endif
+
+// Time the counter is measured against the system clock when calibrating
+#define CLOCK_TSC_CALIBRATION_NS  20000000ULL
+
+
+namespace {
+
+// Written once before the counter is first enabled
+struct CounterCalibration {
+    
+    unsigned long long int baseCounter;
+    unsigned long long int baseTime;
+    
+    // Nanoseconds per tick as 32.32 fixed point
+    unsigned long long int multiplier;
+    
+    bool isCalibrated;
+};
+
+CounterCalibration counterCalibration = {0, 0, 0, false};
+
+// Ticks per second once calibrated
+std::atomic<unsigned long long int> counterFrequency(0);
+
+std::once_flag counterCalibrationFlag;
+
+std::atomic<bool> clockUseCounter(false);
+
+
+#ifdef CLOCK_TSC_X86
+
+bool CheckInvariantCounter(void) {
+    
+    unsigned int eax, ebx, ecx, edx;
+    
+    if (__get_cpuid(0x80000000, &eax, &ebx, &ecx, &edx) == 0) 
+        return false;
+        
+    if (eax < 0x80000007) 
+        return false;
+        
+    __get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx);
+    
+    // Invariant TSC
+    return (edx & (1 << 8)) != 0;
+}
+
+void CalibrateCounter(void) {
+    
+    if (!CheckInvariantCounter()) 
+        return;
+        
+    unsigned long long int beginTime    = Clock::GetSystemClockTime();
+    unsigned long long int beginCounter = __rdtsc();
+    
+    unsigned long long int endTime = beginTime;
+    while (endTime - beginTime < CLOCK_TSC_CALIBRATION_NS) 
+        endTime = Clock::GetSystemClockTime();
+        
+    unsigned long long int endCounter = __rdtsc();
+    
+    unsigned long long int elapsedTime    = endTime - beginTime;
+    unsigned long long int elapsedCounter = endCounter - beginCounter;
+    
+    if (elapsedCounter == 0) 
+        return;
+        
+    counterCalibration.baseCounter  = endCounter;
+    counterCalibration.baseTime     = endTime;
+    counterCalibration.multiplier   = (elapsedTime << 32) / elapsedCounter;
+    counterCalibration.isCalibrated = true;
+    
+    counterFrequency.store( (unsigned long long int)(((unsigned __int128)elapsedCounter * 1000000000ULL) / elapsedTime) );
+    
+    return;
+}
+
+inline unsigned long long int GetCounterTime(void) {
+    
+    unsigned long long int elapsed = __rdtsc() - counterCalibration.baseCounter;
+    
+    return counterCalibration.baseTime + (unsigned long long int)(((unsigned __int128)elapsed * counterCalibration.multiplier) >> 32);
+}
+
+#else
+
+void CalibrateCounter(void) {
+    return;
+}
+
+inline unsigned long long int GetCounterTime(void) {
+    return Clock::GetSystemClockTime();
+}
+
+#endif
+
+}
+
+
+unsigned long long int Clock::GetTime(void) {
+    
+    if (clockUseCounter.load(std::memory_order_acquire)) 
+        return GetCounterTime();
+        
+    return GetSystemClockTime();
+}
+
+unsigned long long int Clock::GetSystemClockTime(void) {
+    
+#ifdef _WIN32
+    static const unsigned long long int frequency = []() {
+        LARGE_INTEGER counterFrequency;
+        QueryPerformanceFrequency(&counterFrequency);
+        return (unsigned long long int)counterFrequency.QuadPart;
+    }();
+    
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    
+    unsigned long long int ticks = counter.QuadPart;
+    
+    // Split the conversion so the multiply cannot overflow
+    return (ticks / frequency) * 1000000000ULL + ((ticks % frequency) * 1000000000ULL) / frequency;
+#else
+    timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    
+    return (unsigned long long int)time.tv_sec * 1000000000ULL + time.tv_nsec;
+#endif
+}
+
+bool Clock::EnableTSC(void) {
+    
+    std::call_once(counterCalibrationFlag, CalibrateCounter);
+    
+    if (!counterCalibration.isCalibrated) 
+        return false;
+        
+    clockUseCounter.store(true, std::memory_order_release);
+    
+    return true;
+}
+
+void Clock::DisableTSC(void) {
+    clockUseCounter.store(false, std::memory_order_release);
+    return;
+}
+
+Clock::Source Clock::GetSource(void) {
+    return clockUseCounter.load(std::memory_order_acquire) ? Source::TSC : Source::System;
+}
+
+unsigned long long int Clock::GetTSCFrequency(void) {
+    return counterFrequency.load();
+}
+
+double Clock::MeasureReadCost(unsigned int numberOfReads) {
+    
+    if (numberOfReads == 0) 
+        return 0.0;
+        
+    unsigned long long int begin = GetTime();
+    
+    // Accumulate the reads so they are not optimized away
+    volatile unsigned long long int sink = 0;
+    
+    for (unsigned int i=0; i < numberOfReads; i++) 
+        sink = sink + GetTime();
+        
+    unsigned long long int end = GetTime();
+    
+    return (double)(end - begin) / numberOfReads;
+}
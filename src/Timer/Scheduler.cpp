@@ -0,0 +1,159 @@
+#include <GameEngineFramework/Timer/Scheduler.h>
+#include <GameEngineFramework/Timer/Clock.h>
+
+#include <cassert>
+
+
+Scheduler::Scheduler() : 
+    mLastTime(Clock::GetTime())
+{
+}
+
+unsigned int Scheduler::AddSystem(std::string name, double updatesPerSecond, SchedulerFunction function, unsigned int maxStepsPerUpdate) {
+    
+    ScheduledSystem system;
+    
+    system.name     = name;
+    system.function = function;
+    
+    system.accumulator = 0;
+    
+    system.maxStepsPerUpdate = (maxStepsPerUpdate > 0) ? maxStepsPerUpdate : 1;
+    
+    system.numberOfSteps        = 0;
+    system.numberOfDroppedSteps = 0;
+    
+    mSystems.push_back(system);
+    
+    unsigned int index = mSystems.size() - 1;
+    
+    SetRate(index, updatesPerSecond);
+    
+    return index;
+}
+
+void Scheduler::Update(void) {
+    
+    unsigned long long int currentTime = Clock::GetTime();
+    
+    unsigned long long int elapsed = currentTime - mLastTime;
+    
+    mLastTime = currentTime;
+    
+    AdvanceTime(elapsed);
+    
+    return;
+}
+
+void Scheduler::Advance(double milliseconds) {
+    
+    if (milliseconds <= 0.0) 
+        return;
+        
+    AdvanceTime( (unsigned long long int)(milliseconds * 1000000.0) );
+    
+    return;
+}
+
+void Scheduler::AdvanceTime(unsigned long long int elapsed) {
+    
+    for (unsigned int i=0; i < mSystems.size(); i++) {
+        
+        ScheduledSystem& system = mSystems[i];
+        
+        system.accumulator += elapsed;
+        
+        float timeStep = system.step / 1000000000.0f;
+        
+        unsigned int numberOfSteps = 0;
+        
+        while (system.accumulator >= system.step) {
+            
+            // Drop the whole steps beyond the limit and keep the remainder
+            if (numberOfSteps == system.maxStepsPerUpdate) {
+                
+                unsigned long long int numberOfDropped = system.accumulator / system.step;
+                
+                system.accumulator -= numberOfDropped * system.step;
+                
+                system.numberOfDroppedSteps += numberOfDropped;
+                
+                break;
+            }
+            
+            system.function(timeStep);
+            
+            system.accumulator -= system.step;
+            
+            system.numberOfSteps++;
+            
+            numberOfSteps++;
+        }
+        
+    }
+    
+    return;
+}
+
+void Scheduler::Reset(void) {
+    
+    for (unsigned int i=0; i < mSystems.size(); i++) 
+        mSystems[i].accumulator = 0;
+        
+    mLastTime = Clock::GetTime();
+    
+    return;
+}
+
+float Scheduler::GetInterpolationFactor(unsigned int index) {
+    assert(index < mSystems.size());
+    return (float)((double)mSystems[index].accumulator / (double)mSystems[index].step);
+}
+
+float Scheduler::GetTimeStep(unsigned int index) {
+    assert(index < mSystems.size());
+    return mSystems[index].step / 1000000000.0f;
+}
+
+void Scheduler::SetRate(unsigned int index, double updatesPerSecond) {
+    assert(index < mSystems.size());
+    assert(updatesPerSecond > 0.0);
+    
+    mSystems[index].rate = updatesPerSecond;
+    mSystems[index].step = (unsigned long long int)(1000000000.0 / updatesPerSecond + 0.5);
+    
+    if (mSystems[index].step == 0) 
+        mSystems[index].step = 1;
+        
+    return;
+}
+
+double Scheduler::GetRate(unsigned int index) {
+    assert(index < mSystems.size());
+    return mSystems[index].rate;
+}
+
+void Scheduler::SetMaxStepsPerUpdate(unsigned int index, unsigned int maxStepsPerUpdate) {
+    assert(index < mSystems.size());
+    mSystems[index].maxStepsPerUpdate = (maxStepsPerUpdate > 0) ? maxStepsPerUpdate : 1;
+    return;
+}
+
+unsigned long long int Scheduler::GetNumberOfSteps(unsigned int index) {
+    assert(index < mSystems.size());
+    return mSystems[index].numberOfSteps;
+}
+
+unsigned long long int Scheduler::GetNumberOfDroppedSteps(unsigned int index) {
+    assert(index < mSystems.size());
+    return mSystems[index].numberOfDroppedSteps;
+}
+
+std::string Scheduler::GetName(unsigned int index) {
+    assert(index < mSystems.size());
+    return mSystems[index].name;
+}
+
+unsigned int Scheduler::GetNumberOfSystems(void) {
+    return mSystems.size();
+}
@@ -1,13 +1,6 @@
-#include <GameEngineFramework/Timer/timer.h>
+#include <GameEngineFramework/Timer/Timer.h>
 
-#ifndef _WIN32_WINNT
-  #define _WIN32_WINNT 0x500
-#endif
-
-#define WIN32_LEAN_AND_MEAN
-
-#include <sdkddkver.h>
-#include <windows.h>
+#include <GameEngineFramework/Timer/Clock.h>
 
 
 Timer::Timer() {
@@ -21,41 +14,24 @@ Timer::Timer() {
     
     interpolationFactor = 0;
     
-    LARGE_INTEGER tFrequency;
-    
-    QueryPerformanceFrequency(&tFrequency);
-    timeFrequency = tFrequency.QuadPart / 1000.0;
-    
-    LARGE_INTEGER integerLarge;
-    integerLarge.QuadPart = tLast;
-    
-    QueryPerformanceCounter(&integerLarge);
+    tLast = Clock::GetTime();
     return;
 }
 
 
 double Timer::GetCurrentDelta(void) {
     
-    LARGE_INTEGER tCurrent;
-    QueryPerformanceCounter(&tCurrent);
-    
-    LARGE_INTEGER integerLarge;
-    integerLarge.QuadPart = tLast;
-    
-    return (tCurrent.QuadPart - integerLarge.QuadPart) / timeFrequency;
+    // Nanoseconds to milliseconds
+    return (Clock::GetTime() - tLast) / 1000000.0;
 }
 
 
 bool Timer::Update(void) {
     
-    LARGE_INTEGER tCurrent;
-    QueryPerformanceCounter(&tCurrent);
-    
-    LARGE_INTEGER integerLarge;
-    integerLarge.QuadPart = tLast;
+    unsigned long long int tCurrent = Clock::GetTime();
     
-    delta = (tCurrent.QuadPart - integerLarge.QuadPart) / timeFrequency;
-    tLast = tCurrent.QuadPart;
+    delta = (tCurrent - tLast) / 1000000.0;
+    tLast = tCurrent;
     
     accumulator += delta;
     
@@ -77,9 +53,7 @@ bool Timer::Update(void) {
 }
 
 double Timer::Current(void) {
-    LARGE_INTEGER tCurrent;
-    QueryPerformanceCounter(&tCurrent);
-    return tCurrent.QuadPart;
+    return Clock::GetTime() / 1000000.0;
 }
 
 void Timer::SetRefreshRate(int rate) {
@@ -1,4 +1,5 @@
 #include <GameEngineFramework/Transform/Transform.h>
+#include <GameEngineFramework/Math/TransformBatch.h>
 
 
 Transform::Transform() : 
@@ -11,11 +12,30 @@ Transform::Transform() :
     localScale(glm::vec3(1.0f, 1.0f, 1.0f)),
     
     matrix(glm::mat4(0.0f)),
+    normalMatrix(glm::mat3(1.0f)),
     
     parent(nullptr),
     
     inheritParentRotation(true),
-    inheritParentScale(true)
+    inheritParentScale(true),
+    
+    mIsDirty(true),
+    mHasChanged(false),
+    mIsMatrixCurrent(false),
+    
+    mLastPosition(glm::vec3(0.0f, 0.0f, 0.0f)),
+    mLastRotation(glm::identity<glm::quat>()),
+    mLastScale(glm::vec3(1.0f, 1.0f, 1.0f)),
+    mLastParent(nullptr),
+    mLastInheritRotation(true),
+    mLastInheritScale(true),
+    
+    mWorldPosition(glm::vec3(0.0f, 0.0f, 0.0f)),
+    mWorldRotation(glm::identity<glm::quat>()),
+    mWorldScale(glm::vec3(1.0f, 1.0f, 1.0f)),
+    
+    mChainRotation(glm::identity<glm::quat>()),
+    mChainScale(glm::vec3(1.0f, 1.0f, 1.0f))
 {
 }
 
@@ -24,6 +44,7 @@ void Transform::operator= (const Transform& transform) {
     this->rotation  = transform.rotation;
     this->scale     = transform.scale;
     this->matrix    = transform.matrix;
+    this->mIsDirty  = true;
     return;
 }
 
@@ -89,18 +110,21 @@ glm::vec3 Transform::GetScale(void){
 void Transform::Translate(glm::vec3 translation) {
     matrix = glm::translate(matrix, translation);
     position += translation;
+    mIsDirty = true;
     return;
 }
 
 void Transform::Translate(float x, float y, float z) {
     matrix = glm::translate( matrix, glm::vec3(x, y, z) );
     position += glm::vec3(x, y, z);
+    mIsDirty = true;
     return;
 }
 
 void Transform::RotateAxis(float angle, glm::vec3 axis) {
     matrix = glm::rotate( matrix, glm::radians(angle), glm::normalize(axis) );
     rotation = glm::quat_cast( matrix );
+    mIsDirty = true;
     return;
 }
 
@@ -108,6 +132,7 @@ void Transform::RotateWorldAxis(float angle, glm::vec3 axis, glm::vec3 worldPosi
     matrix = glm::rotate( matrix, glm::radians(angle), glm::normalize(axis) );
     matrix = glm::translate( matrix, worldPosition );
     rotation = glm::quat_cast( matrix );
+    mIsDirty = true;
     return;
 }
 
@@ -119,6 +144,7 @@ void Transform::RotateEuler(glm::vec3 eulerAngle) {
 void Transform::RotateEuler(float yaw, float pitch, float roll) {
     rotation *= glm::quat( glm::radians( glm::vec3(yaw, pitch, roll) ) );
     matrix *= glm::toMat4( rotation );
+    mIsDirty = true;
     return;
 }
 
@@ -130,6 +156,7 @@ void Transform::Scale(glm::vec3 scaler) {
 void Transform::Scale(float x, float y, float z) {
     matrix = glm::scale(matrix, glm::vec3(x, y, z) );
     scale *= glm::vec3(x, y, z);
+    mIsDirty = true;
     return;
 }
 
@@ -142,12 +169,100 @@ void Transform::SetIdentity(void) {
     rotation   = glm::identity<glm::quat>();
     scale      = glm::vec3(1, 1, 1);
     matrix     = glm::mat4(1);
+    normalMatrix = glm::mat3(1);
+    mIsDirty   = true;
     return;
 }
 
 void Transform::UpdateMatrix(void) {
-    matrix = glm::translate(glm::mat4(1), glm::vec3( position.x, position.y, position.z )) * 
-             glm::toMat4(rotation) * 
-             glm::scale(glm::mat4(1), glm::vec3( scale.x, scale.y, scale.z ));
+    TransformBatch::ComposeMatrix(position, rotation, scale, false, matrix, normalMatrix);
+    return;
+}
+
+void Transform::MarkDirty(void) {
+    mIsDirty = true;
     return;
 }
+
+bool Transform::CheckHasChanged(void) {
+    return mHasChanged;
+}
+
+bool Transform::UpdateWorldCache(bool doUpdateMatrix) {
+    
+    if (UpdateWorldValues(doUpdateMatrix)) 
+        TransformBatch::ComposeMatrix(mWorldPosition, mWorldRotation, mWorldScale, inheritParentRotation, matrix, normalMatrix);
+        
+    return mHasChanged;
+}
+
+bool Transform::UpdateWorldValues(bool doUpdateMatrix) {
+    
+    // The public values may be written directly so they are compared against the last update
+    bool hasChanged = mIsDirty | 
+                      (position != mLastPosition) | 
+                      (rotation != mLastRotation) | 
+                      (scale    != mLastScale) | 
+                      (parent   != mLastParent) | 
+                      (inheritParentRotation != mLastInheritRotation) | 
+                      (inheritParentScale    != mLastInheritScale);
+    
+    if (parent != nullptr) 
+        hasChanged |= parent->mHasChanged;
+        
+    mIsDirty    = false;
+    mHasChanged = hasChanged;
+    
+    if (hasChanged) {
+        
+        mLastPosition        = position;
+        mLastRotation        = rotation;
+        mLastScale           = scale;
+        mLastParent          = parent;
+        mLastInheritRotation = inheritParentRotation;
+        mLastInheritScale    = inheritParentScale;
+        
+        mWorldPosition = position;
+        mWorldRotation = rotation;
+        mWorldScale    = scale;
+        
+        glm::quat parentRotation = glm::identity<glm::quat>();
+        glm::vec3 parentScale(1.0f, 1.0f, 1.0f);
+        
+        if (parent != nullptr) {
+            
+            mWorldPosition += parent->mWorldPosition;
+            mWorldRotation *= parent->mChainRotation;
+            mWorldScale    *= parent->mChainScale;
+            
+            parentRotation = parent->mChainRotation;
+            parentScale    = parent->mChainScale;
+        }
+        
+        // Children only pick up the rotation and scale this transform passes on
+        mChainRotation = inheritParentRotation ? mWorldRotation : parentRotation;
+        mChainScale    = inheritParentScale    ? mWorldScale    : parentScale;
+        
+        mIsMatrixCurrent = false;
+    }
+    
+    if ((!doUpdateMatrix) | mIsMatrixCurrent) 
+        return false;
+        
+    // The caller composes the matrix from the world values
+    mIsMatrixCurrent = true;
+    
+    return true;
+}
+
+glm::vec3 Transform::GetWorldPosition(void) {
+    return mWorldPosition;
+}
+
+glm::quat Transform::GetWorldRotation(void) {
+    return mWorldRotation;
+}
+
+glm::vec3 Transform::GetWorldScale(void) {
+    return mWorldScale;
+}
@@ -1,6 +1,7 @@
-#include <GameEngineFramework/Types/types.h>
+#include <GameEngineFramework/Types/Types.h>
 
 #include <sstream>
+#include <cstdlib>
 
 float StringType::ToFloat(std::string value) {
     float output;
@@ -8,6 +9,10 @@ float StringType::ToFloat(std::string value) {
     return output;
 }
 
+float StringType::ToFloat(const char* value) {
+    return std::strtof(value, nullptr);
+}
+
 double StringType::ToDouble(std::string value) {
     double output;
     std::stringstream(value) >> output;
@@ -26,17 +31,40 @@ unsigned int StringType::ToUint(std::string value) {
     return output;
 }
 
-std::vector<std::string> StringType::Explode(std::string value, const char character) {
-	std::vector<std::string> result;
-    std::istringstream iss(value);
+// Split the characters by the delimiter skipping empty tokens
+template<typename VectorType, typename TokenType> void ExplodeString(const char* value, std::size_t length, const char character, VectorType& result) {
+    
+    std::size_t tokenBegin = 0;
     
-    for (std::string token; std::getline(iss, token, character); ) {
+    for (std::size_t i=0; i <= length; i++) {
         
-        if (std::move(token) == "") 
+        if ((i < length) && (value[i] != character)) 
             continue;
         
-        result.push_back(std::move(token));
+        if (i > tokenBegin) 
+            result.push_back( TokenType(value + tokenBegin, i - tokenBegin) );
+        
+        tokenBegin = i + 1;
     }
+    
+    return;
+}
+
+std::vector<std::string> StringType::Explode(std::string value, const char character) {
+    std::vector<std::string> result;
+    ExplodeString<std::vector<std::string>, std::string>(value.data(), value.size(), character, result);
+    return result;
+}
+
+FrameVector<FrameString> StringType::ExplodeFrame(const std::string& value, const char character) {
+    FrameVector<FrameString> result;
+    ExplodeString<FrameVector<FrameString>, FrameString>(value.data(), value.size(), character, result);
+    return result;
+}
+
+FrameVector<FrameString> StringType::ExplodeFrame(const FrameString& value, const char character) {
+    FrameVector<FrameString> result;
+    ExplodeString<FrameVector<FrameString>, FrameString>(value.data(), value.size(), character, result);
     return result;
 }
 
@@ -136,26 +136,35 @@ void FuncSeed(std::vector<std::string> args) {
 // Summon an actor
 void FuncSummon(std::vector<std::string> args) {
     
-    for (uint8_t i=0; i < 100; i++) {
-        
-        unsigned int entityType = 0;
+    unsigned int entityType = 0;
+    
+    if (args[0] == "Sheep")   {entityType = 1;}
+    if (args[0] == "Bear")    {entityType = 2;}
+    
+    if (entityType == 0) {
         
-        if (args[0] == "Sheep")   {entityType = 1;}
-        if (args[0] == "Bear")    {entityType = 2;}
+        Engine.Print("Unknown actor type");
         
-        if (entityType == 0) {
-            
-            Engine.Print("Unknown actor type");
-            
-            return;
-        }
+        return;
+    }
+    
+    std::vector<glm::vec3> positions;
+    
+    for (uint8_t i=0; i < 100; i++) {
         
         glm::vec3 randomOffset(Random.Range(0, 50) - Random.Range(0, 50), 
                                0, 
                                Random.Range(0, 50) - Random.Range(0, 50));
         
-        GameObject* newActorObject = Engine.CreateAIActor( Engine.sceneMain->camera->transform.GetPosition() - randomOffset );
-        Actor* newActor = newActorObject->GetComponent<Actor>();
+        positions.push_back( Engine.sceneMain->camera->transform.GetPosition() - randomOffset );
+    }
+    
+    // Spawn the herd in a single pass
+    std::vector<GameObject*> actorObjects = Engine.CreateAIActors( positions );
+    
+    for (unsigned int i=0; i < actorObjects.size(); i++) {
+        
+        Actor* newActor = actorObjects[i]->GetComponent<Actor>();
         
         switch (entityType) {
             
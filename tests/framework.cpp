@@ -1,6 +1,6 @@
 #include "framework.h"
 
-#include <GameEngineFramework/Types/types.h>
+#include <GameEngineFramework/Types/Types.h>
 extern StringType String;
 extern IntType    Int;
 
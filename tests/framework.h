@@ -46,6 +46,19 @@ public:
     void TestScriptSystem(void);
     void TestPhysicsSystem(void);
     void TestTransform(void);
+    void TestPoolAllocator(void);
+    void TestFrameArena(void);
+    void TestJobSystem(void);
+    void TestTransformBatch(void);
+    void TestProfiler(void);
+    void TestClock(void);
+    void TestScheduler(void);
+    void TestRenderQueueSort(void);
+    void TestDrawListSort(void);
+    void TestFrustum(void);
+    void TestBoundingVolumeHierarchy(void);
+    void TestSpatialGrid(void);
+    void TestInstancing(void);
     
 private:
     
@@ -0,0 +1,186 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "../framework.h"
+#include <GameEngineFramework/Renderer/RenderSystem.h>
+#include <GameEngineFramework/Renderer/BoundingVolumeHierarchy.h>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+extern RenderSystem Renderer;
+
+void TestFramework::TestBoundingVolumeHierarchy(void) {
+    if (hasTestFailed) return;
+    
+    std::cout << "Bounding volume tree.... ";
+    
+    // Unit cube shared by every renderer
+    Mesh* meshPtr = Renderer.CreateMesh();
+    meshPtr->isShared = true;
+    
+    std::vector<Vertex> vertexBuffer;
+    std::vector<Index>  indexBuffer;
+    
+    for (unsigned int i=0; i < 8; i++) {
+        vertexBuffer.push_back( Vertex((i & 1) ? 0.5f : -0.5f, (i & 2) ? 0.5f : -0.5f, (i & 4) ? 0.5f : -0.5f,  1, 1, 1,  0, 1, 0,  0, 0) );
+        indexBuffer.push_back(i);
+    }
+    
+    meshPtr->AddSubMesh(0, 0, 0, vertexBuffer, indexBuffer, false);
+    meshPtr->Load();
+    
+    // Grid of renderers in front of the camera
+    std::vector<MeshRenderer*> renderers;
+    
+    BoundingVolumeHierarchy tree;
+    
+    for (unsigned int x=0; x < 16; x++) {
+        
+        for (unsigned int z=0; z < 16; z++) {
+            
+            MeshRenderer* meshRendererPtr = Renderer.CreateMeshRenderer();
+            
+            meshRendererPtr->mesh = meshPtr;
+            meshRendererPtr->transform.matrix = glm::translate(glm::mat4(1), glm::vec3(x * 10.0f - 75.0f, 0, z * -10.0f - 10.0f));
+            
+            meshRendererPtr->UpdateBounds();
+            
+            if (!tree.Insert(meshRendererPtr)) Throw(msgFailedObjectCreate, __FILE__, __LINE__);
+            
+            renderers.push_back(meshRendererPtr);
+        }
+        
+    }
+    
+    // A renderer may only be held by one tree
+    if (tree.Insert(renderers[0])) Throw(msgFailedObjectCreate, __FILE__, __LINE__);
+    
+    if (tree.GetNumberOfRenderers() != renderers.size()) Throw(msgFailedSetGet, __FILE__, __LINE__);
+    
+    // Camera at the origin looking down negative z
+    glm::mat4 projection = glm::perspective(glm::radians(90.0f), 1.0f, 0.1f, 1000.0f);
+    
+    Frustum frustum;
+    frustum.SetViewProjection(projection * glm::lookAt(glm::vec3(0), glm::vec3(0, 0, -1), glm::vec3(0, 1, 0)));
+    
+    FrameArena& arena = FrameArena::GetThreadArena();
+    FrameArenaMarker marker = arena.GetMarker();
+    
+    {
+        FrameVector<MeshRenderer*> visible;
+        
+        tree.Cull(frustum, visible);
+        
+        if (tree.GetNumberOfNodes() == 0) Throw(msgFailedObjectCreate, __FILE__, __LINE__);
+        
+        // The tree should find the same renderers as testing each one
+        std::vector<MeshRenderer*> expected;
+        
+        for (unsigned int i=0; i < renderers.size(); i++) 
+            if (frustum.CheckBox(renderers[i]->GetBoundingBoxMin(), renderers[i]->GetBoundingBoxMax())) 
+                expected.push_back(renderers[i]);
+                
+        std::vector<MeshRenderer*> found(visible.begin(), visible.end());
+        
+        std::sort(found.begin(), found.end());
+        std::sort(expected.begin(), expected.end());
+        
+        if ((expected.size() == 0) | (expected.size() == renderers.size())) Throw(msgFailedOperator, __FILE__, __LINE__);
+        if (found != expected) Throw(msgFailedOperator, __FILE__, __LINE__);
+        
+        // Looking away rejects the whole grid at the root
+        visible.clear();
+        
+        Frustum frustumAway;
+        frustumAway.SetViewProjection(projection * glm::lookAt(glm::vec3(0), glm::vec3(0, 0, 1), glm::vec3(0, 1, 0)));
+        
+        tree.Cull(frustumAway, visible);
+        
+        if (visible.size() != 0) Throw(msgFailedOperator, __FILE__, __LINE__);
+        if (tree.GetNumberOfTests() != 1) Throw(msgFailedOperator, __FILE__, __LINE__);
+        
+        // Move a renderer from outside the view into the middle of it
+        MeshRenderer* movedRenderer = nullptr;
+        
+        for (unsigned int i=0; i < renderers.size(); i++) {
+            
+            if (std::find(expected.begin(), expected.end(), renderers[i]) != expected.end()) 
+                continue;
+                
+            movedRenderer = renderers[i];
+            break;
+        }
+        
+        if (movedRenderer == nullptr) Throw(msgFailedNullptr, __FILE__, __LINE__);
+        
+        movedRenderer->transform.matrix = glm::translate(glm::mat4(1), glm::vec3(0, 0, -20));
+        movedRenderer->UpdateBounds();
+        
+        visible.clear();
+        
+        tree.Cull(frustum, visible);
+        
+        if (std::find(visible.begin(), visible.end(), movedRenderer) == visible.end()) Throw(msgFailedOperator, __FILE__, __LINE__);
+        
+        // Removed renderers are no longer found
+        if (!tree.Remove(movedRenderer)) Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+        if (tree.Remove(movedRenderer))  Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+        
+        visible.clear();
+        
+        tree.Cull(frustum, visible);
+        
+        if (std::find(visible.begin(), visible.end(), movedRenderer) != visible.end()) Throw(msgFailedOperator, __FILE__, __LINE__);
+        if (tree.GetNumberOfRenderers() != renderers.size() - 1) Throw(msgFailedSetGet, __FILE__, __LINE__);
+        
+        // A renderer without a mesh is never culled
+        movedRenderer->mesh = nullptr;
+        movedRenderer->UpdateBounds();
+        
+        tree.Insert(movedRenderer);
+        
+        visible.clear();
+        
+        tree.Cull(frustumAway, visible);
+        
+        if ((visible.size() != 1) || (visible[0] != movedRenderer)) Throw(msgFailedOperator, __FILE__, __LINE__);
+    }
+    
+    arena.Rewind(marker);
+    
+    // Destroying a renderer takes it out of its tree
+    unsigned int numberOfRenderers = tree.GetNumberOfRenderers();
+    
+    renderers[1]->mesh = nullptr;
+    
+    if (!Renderer.DestroyMeshRenderer(renderers[1])) Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    
+    if (tree.GetNumberOfRenderers() != numberOfRenderers - 1) Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    
+    renderers.erase(renderers.begin() + 1);
+    
+    tree.Clear();
+    
+    if (tree.GetNumberOfRenderers() != 0) Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    
+    // Static renderers through the scene
+    Scene* scenePtr = Renderer.CreateScene();
+    
+    scenePtr->AddStaticMeshRendererToSceneRoot(renderers[0], RENDER_QUEUE_GEOMETRY);
+    
+    if (!scenePtr->RemoveStaticMeshRendererFromSceneRoot(renderers[0], RENDER_QUEUE_GEOMETRY)) Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    if (scenePtr->RemoveStaticMeshRendererFromSceneRoot(renderers[0], RENDER_QUEUE_GEOMETRY))  Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    
+    if (!Renderer.DestroyScene(scenePtr)) Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    
+    for (unsigned int i=0; i < renderers.size(); i++) {
+        renderers[i]->mesh = nullptr;
+        Renderer.DestroyMeshRenderer(renderers[i]);
+    }
+    
+    if (!Renderer.DestroyMesh(meshPtr)) Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    
+    return;
+}
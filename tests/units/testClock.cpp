@@ -0,0 +1,76 @@
+#include <iostream>
+#include <string>
+#include <thread>
+#include <chrono>
+
+#include "../framework.h"
+#include <GameEngineFramework/Timer/Clock.h>
+#include <GameEngineFramework/Timer/Timer.h>
+
+void TestFramework::TestClock(void) {
+    if (hasTestFailed) return;
+    
+    std::cout << "Clock................... ";
+    
+    // Timestamps never move backwards
+    unsigned long long int last = Clock::GetSystemClockTime();
+    
+    for (unsigned int i=0; i < 10000; i++) {
+        
+        unsigned long long int current = Clock::GetSystemClockTime();
+        
+        if (current < last) Throw(msgFailedOperator, __FILE__, __LINE__);
+        
+        last = current;
+    }
+    
+    // Elapsed time should cover a sleep without running far past it
+    unsigned long long int begin = Clock::GetTime();
+    
+    Timer timer;
+    
+    std::this_thread::sleep_for( std::chrono::milliseconds(20) );
+    
+    unsigned long long int elapsed = Clock::GetTime() - begin;
+    
+    if ((elapsed < 19000000ULL) | (elapsed > 1000000000ULL)) Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    double delta = timer.GetCurrentDelta();
+    
+    if ((delta < 19.0) | (delta > 1000.0)) Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    if (Clock::MeasureReadCost(1000) <= 0.0) Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    // The time stamp counter should agree with the system clock
+    Clock::Source source = Clock::GetSource();
+    
+    if (Clock::EnableTSC()) {
+        
+        if (Clock::GetSource() != Clock::Source::TSC) Throw(msgFailedSetGet, __FILE__, __LINE__);
+        if (Clock::GetTSCFrequency() == 0) Throw(msgFailedSetGet, __FILE__, __LINE__);
+        
+        unsigned long long int systemBegin  = Clock::GetSystemClockTime();
+        unsigned long long int counterBegin = Clock::GetTime();
+        
+        std::this_thread::sleep_for( std::chrono::milliseconds(20) );
+        
+        unsigned long long int counterEnd = Clock::GetTime();
+        unsigned long long int systemEnd  = Clock::GetSystemClockTime();
+        
+        if (counterEnd < counterBegin) Throw(msgFailedOperator, __FILE__, __LINE__);
+        
+        long long int difference = (long long int)(counterEnd - counterBegin) - (long long int)(systemEnd - systemBegin);
+        
+        // Within a millisecond over the sleep
+        if ((difference > 1000000LL) | (difference < -1000000LL)) Throw(msgFailedOperator, __FILE__, __LINE__);
+        
+        Clock::DisableTSC();
+        
+        if (Clock::GetSource() != Clock::Source::System) Throw(msgFailedSetGet, __FILE__, __LINE__);
+        
+        if (source == Clock::Source::TSC) 
+            Clock::EnableTSC();
+    }
+    
+    return;
+}
@@ -0,0 +1,98 @@
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../framework.h"
+#include <GameEngineFramework/Renderer/RenderQueueSort.h>
+
+// Shader, material and mesh bits below the queue group and depth bucket
+static unsigned long long int BuildTestKey(unsigned long long int depthBucket, unsigned long long int state) {
+    return (5ULL << 60) | (depthBucket << 44) | state;
+}
+
+static bool CheckOrder(std::vector<RenderQueueSort::Entry>& entries, MeshRenderer** expected, unsigned long long int* expectedKeys) {
+    
+    for (unsigned int i=0; i < entries.size(); i++) 
+        if ((entries[i].renderer != expected[i]) | (entries[i].key != expectedKeys[i])) 
+            return false;
+            
+    return true;
+}
+
+void TestFramework::TestDrawListSort(void) {
+    if (hasTestFailed) return;
+    
+    std::cout << "Draw list sort.......... ";
+    
+    // Renderers are only carried along so any distinct address will do
+    std::vector<char> renderers(6);
+    
+    MeshRenderer* dynamic0 = (MeshRenderer*)&renderers[0];
+    MeshRenderer* dynamic1 = (MeshRenderer*)&renderers[1];
+    MeshRenderer* dynamic2 = (MeshRenderer*)&renderers[2];
+    MeshRenderer* static0  = (MeshRenderer*)&renderers[3];
+    MeshRenderer* static1  = (MeshRenderer*)&renderers[4];
+    MeshRenderer* static2  = (MeshRenderer*)&renderers[5];
+    
+    // Two runs each sorted front to back, alternating in depth. The state uses
+    // the top bit of the shader so a mask one bit short would be caught
+    unsigned long long int stateA = (1ULL << 43) | 1;
+    unsigned long long int stateB = 2;
+    
+    std::vector<RenderQueueSort::Entry> source(6);
+    
+    source[0].key = BuildTestKey(1, stateA);  source[0].renderer = dynamic0;
+    source[1].key = BuildTestKey(3, stateB);  source[1].renderer = dynamic1;
+    source[2].key = BuildTestKey(5, stateA);  source[2].renderer = dynamic2;
+    source[3].key = BuildTestKey(2, stateB);  source[3].renderer = static0;
+    source[4].key = BuildTestKey(4, stateA);  source[4].renderer = static1;
+    source[5].key = BuildTestKey(6, stateB);  source[5].renderer = static2;
+    
+    std::vector<RenderQueueSort::Entry> scratch( source.size() );
+    
+    // Opaque queues are merged by depth then grouped by state, front to back within each group
+    std::vector<RenderQueueSort::Entry> entries = source;
+    RenderQueueSort::SortDrawList(entries.data(), scratch.data(), 3, entries.size(), true, true);
+    
+    MeshRenderer* groupedOrder[] = {static0, dynamic1, static2, dynamic0, static1, dynamic2};
+    unsigned long long int groupedKeys[] = {stateB, stateB, stateB, stateA, stateA, stateA};
+    
+    if (!CheckOrder(entries, groupedOrder, groupedKeys)) Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    // Transparent queues keep the merged depth order
+    entries = source;
+    RenderQueueSort::SortDrawList(entries.data(), scratch.data(), 3, entries.size(), true, false);
+    
+    MeshRenderer* mergedOrder[] = {dynamic0, static0, dynamic1, static1, dynamic2, static2};
+    unsigned long long int mergedKeys[] = {stateA, stateB, stateB, stateA, stateA, stateB};
+    
+    if (!CheckOrder(entries, mergedOrder, mergedKeys)) Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    // Other queues are drawn in queue order
+    entries = source;
+    RenderQueueSort::SortDrawList(entries.data(), scratch.data(), 3, entries.size(), false, false);
+    
+    MeshRenderer* queueOrder[] = {dynamic0, dynamic1, dynamic2, static0, static1, static2};
+    unsigned long long int queueKeys[] = {stateA, stateB, stateA, stateB, stateA, stateB};
+    
+    if (!CheckOrder(entries, queueOrder, queueKeys)) Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    // Equal depths take the dynamic renderer first
+    entries = source;
+    entries[3].key = BuildTestKey(1, stateA);
+    RenderQueueSort::SortDrawList(entries.data(), scratch.data(), 3, entries.size(), true, false);
+    
+    if ((entries[0].renderer != dynamic0) | (entries[1].renderer != static0)) Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    // Without static renderers nothing is merged
+    entries = source;
+    entries.resize(3);
+    RenderQueueSort::SortDrawList(entries.data(), scratch.data(), 3, entries.size(), true, true);
+    
+    MeshRenderer* dynamicOrder[] = {dynamic1, dynamic0, dynamic2};
+    unsigned long long int dynamicKeys[] = {stateB, stateA, stateA};
+    
+    if (!CheckOrder(entries, dynamicOrder, dynamicKeys)) Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    return;
+}
@@ -1,5 +1,6 @@
 #include <iostream>
 #include <string>
+#include <vector>
 
 #include "../framework.h"
 #include <GameEngineFramework/Engine/Engine.h>
@@ -13,11 +14,45 @@ void TestFramework::TestEngineFunctionality(void) {
     std::cout << "Engine functionality.... ";
     
     // Test game object
+    unsigned int numberOfGameObjects = Engine.GetNumberOfGameObjects();
+    
     GameObject* gameObject = Engine.Create<GameObject>();
     if (gameObject == nullptr) Throw(msgFailedObjectCreate, __FILE__, __LINE__);
     if (!Engine.Destroy<GameObject>(gameObject)) Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
-    // Object is garbage collected and cant be tested in one frame
-    //if (Engine.GetNumberOfGameObjects() > 0) Throw(msgFailedAllocatorNotZero, __FILE__, __LINE__);
+    
+    // Object is garbage collected and cant be destroyed twice
+    if (Engine.Destroy<GameObject>(gameObject)) Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    
+    Engine.CollectAllGarbage();
+    if (Engine.GetNumberOfGameObjects() != numberOfGameObjects) Throw(msgFailedAllocatorNotZero, __FILE__, __LINE__);
+    
+    // Test garbage collection budget
+    unsigned int garbageBudget = Engine.GetGarbageCollectionBudget();
+    Engine.SetGarbageCollectionBudget(250);
+    if (Engine.GetGarbageCollectionBudget() != 250) Throw(msgFailedSetGet, __FILE__, __LINE__);
+    
+    // A tiny budget purges part of the queue each update. More objects are
+    // queued than fit in one batch so the queue can not empty in one update
+    unsigned int numberOfGarbage = GARBAGE_COLLECTION_BATCH_MAX * 2;
+    
+    std::vector<GameObject*> garbageObjects = Engine.CreateGameObjects(numberOfGarbage);
+    if (garbageObjects.size() != numberOfGarbage) Throw(msgFailedObjectCreate, __FILE__, __LINE__);
+    
+    Engine.DestroyGameObjects(garbageObjects);
+    
+    Engine.SetGarbageCollectionBudget(1);
+    Engine.Update();
+    
+    EngineSystemManager::GarbageCollectionStats garbageStats = Engine.GetGarbageCollectionStats();
+    
+    if (garbageStats.objectsDestroyed == 0)               Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    if (garbageStats.objectsDestroyed >= numberOfGarbage) Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    if (garbageStats.gameObjectBacklog != numberOfGarbage - garbageStats.objectsDestroyed) Throw(msgFailedSetGet, __FILE__, __LINE__);
+    
+    Engine.CollectAllGarbage();
+    if (Engine.GetNumberOfGameObjects() != numberOfGameObjects) Throw(msgFailedAllocatorNotZero, __FILE__, __LINE__);
+    
+    Engine.SetGarbageCollectionBudget(garbageBudget);
     
     // Test mesh renderer component
     Component* component = Engine.CreateComponentMeshRenderer(nullptr, nullptr);
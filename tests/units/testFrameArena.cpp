@@ -0,0 +1,45 @@
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../framework.h"
+#include <GameEngineFramework/MemoryAllocation/FrameArena.h>
+#include <GameEngineFramework/Transform/Transform.h>
+
+
+void TestFramework::TestFrameArena(void) {
+    if (hasTestFailed) return;
+    
+    std::cout << "Frame arena............. ";
+    
+    // Frame arena should stop allocating blocks once it has grown to fit a frame
+    FrameArena frameArena(1024);
+    unsigned int numberOfBlocks = 0;
+    
+    for (unsigned int frame=0; frame < 4; frame++) {
+        
+        {
+            FrameVector<Transform> frameObjects( (FrameAllocator<Transform>(frameArena)) );
+            
+            for (unsigned int i=0; i < 100; i++) 
+                frameObjects.push_back( Transform() );
+                
+            if (frameObjects[99].scale != glm::vec3(1, 1, 1)) Throw(msgFailedConstructor, __FILE__, __LINE__);
+        }
+        
+        frameArena.Reset();
+        
+        if (frame == 1) numberOfBlocks = frameArena.GetNumberOfBlockAllocations();
+        if (frame > 1 && frameArena.GetNumberOfBlockAllocations() != numberOfBlocks) Throw(msgFailedObjectCreate, __FILE__, __LINE__);
+    }
+    
+    // Rewinding to a marker should release everything allocated after it
+    FrameArenaMarker marker = frameArena.GetMarker();
+    frameArena.Allocate(256);
+    frameArena.Rewind(marker);
+    
+    if (frameArena.GetBytesUsed() != 0) Throw(msgFailedAllocatorNotZero, __FILE__, __LINE__);
+    
+    return;
+}
+
@@ -0,0 +1,175 @@
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../framework.h"
+#include <GameEngineFramework/Math/Frustum.h>
+#include <GameEngineFramework/Renderer/RenderSystem.h>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+extern RenderSystem Renderer;
+
+void TestFramework::TestFrustum(void) {
+    if (hasTestFailed) return;
+    
+    std::cout << "Frustum................. ";
+    
+    float margin = 0.001;
+    
+    // Camera at the origin looking down negative z with a ninety degree field of view
+    glm::mat4 projection = glm::perspective(glm::radians(90.0f), 1.0f, 0.1f, 100.0f);
+    glm::mat4 view       = glm::lookAt(glm::vec3(0), glm::vec3(0, 0, -1), glm::vec3(0, 1, 0));
+    
+    Frustum frustum;
+    frustum.SetViewProjection(projection * view);
+    
+    glm::vec3 halfSize(0.5f);
+    
+    // In front
+    if (!frustum.CheckBox(glm::vec3(0, 0, -10) - halfSize, glm::vec3(0, 0, -10) + halfSize)) Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    // Behind the camera
+    if (frustum.CheckBox(glm::vec3(0, 0, 10) - halfSize, glm::vec3(0, 0, 10) + halfSize)) Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    // Beside the field of view which reaches ten units to each side at this depth
+    if (frustum.CheckBox(glm::vec3(30, 0, -10) - halfSize, glm::vec3(30, 0, -10) + halfSize)) Throw(msgFailedOperator, __FILE__, __LINE__);
+    if (frustum.CheckBox(glm::vec3(0, -30, -10) - halfSize, glm::vec3(0, -30, -10) + halfSize)) Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    // Straddling the right plane
+    if (!frustum.CheckBox(glm::vec3(10.4f, 0, -10) - halfSize, glm::vec3(10.4f, 0, -10) + halfSize)) Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    // Past the far plane
+    if (frustum.CheckBox(glm::vec3(0, 0, -200) - halfSize, glm::vec3(0, 0, -200) + halfSize)) Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    // Large enough to reach into view from beside it
+    if (!frustum.CheckBox(glm::vec3(5, -1, -11), glm::vec3(60, 1, -9))) Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    // Spheres
+    if (!frustum.CheckSphere(glm::vec3(0, 0, -10), 1.0f)) Throw(msgFailedOperator, __FILE__, __LINE__);
+    if (frustum.CheckSphere(glm::vec3(0, 0, 10), 1.0f)) Throw(msgFailedOperator, __FILE__, __LINE__);
+    if (!frustum.CheckSphere(glm::vec3(11, 0, -10), 1.0f)) Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    // Pitching the camera up brings objects above into view
+    frustum.SetViewProjection(projection * glm::lookAt(glm::vec3(0), glm::vec3(0, 1, 0), glm::vec3(0, 0, -1)));
+    
+    if (!frustum.CheckBox(glm::vec3(0, 10, 0) - halfSize, glm::vec3(0, 10, 0) + halfSize)) Throw(msgFailedOperator, __FILE__, __LINE__);
+    if (frustum.CheckBox(glm::vec3(0, 0, -10) - halfSize, glm::vec3(0, 0, -10) + halfSize)) Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    frustum.SetViewProjection(projection * view);
+    
+    //
+    // Mesh and world bounds
+    
+    Mesh* meshPtr = Renderer.CreateMesh();
+    MeshRenderer* meshRendererPtr = Renderer.CreateMeshRenderer();
+    
+    if (meshPtr == nullptr)         Throw(msgFailedObjectCreate, __FILE__, __LINE__);
+    if (meshRendererPtr == nullptr) Throw(msgFailedObjectCreate, __FILE__, __LINE__);
+    
+    // Without a mesh the renderer is never culled
+    meshRendererPtr->UpdateBounds();
+    
+    if (!frustum.CheckBox(meshRendererPtr->GetBoundingBoxMin(), meshRendererPtr->GetBoundingBoxMax())) Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    // Unit cube corners
+    std::vector<Vertex> vertexBuffer;
+    std::vector<Index>  indexBuffer;
+    
+    for (unsigned int i=0; i < 8; i++) {
+        vertexBuffer.push_back( Vertex((i & 1) ? 0.5f : -0.5f, (i & 2) ? 0.5f : -0.5f, (i & 4) ? 0.5f : -0.5f,  1, 1, 1,  0, 1, 0,  0, 0) );
+        indexBuffer.push_back(i);
+    }
+    
+    meshPtr->AddSubMesh(0, 0, 0, vertexBuffer, indexBuffer, false);
+    meshPtr->Load();
+    
+    if (!meshPtr->CheckHasBounds()) Throw(msgFailedSetGet, __FILE__, __LINE__);
+    
+    if (glm::length(meshPtr->GetBoundingBoxMin() - glm::vec3(-0.5f)) > margin) Throw(msgFailedSetGet, __FILE__, __LINE__);
+    if (glm::length(meshPtr->GetBoundingBoxMax() - glm::vec3(0.5f)) > margin)  Throw(msgFailedSetGet, __FILE__, __LINE__);
+    
+    if (glm::length(meshPtr->GetBoundingSphereCenter()) > margin) Throw(msgFailedSetGet, __FILE__, __LINE__);
+    if (glm::abs(meshPtr->GetBoundingSphereRadius() - glm::sqrt(0.75f)) > margin) Throw(msgFailedSetGet, __FILE__, __LINE__);
+    
+    // Turned a quarter around the vertical and doubled in size
+    meshRendererPtr->mesh = meshPtr;
+    meshRendererPtr->transform.matrix = glm::translate(glm::mat4(1), glm::vec3(0, 0, -10)) * 
+                                        glm::rotate(glm::mat4(1), glm::radians(45.0f), glm::vec3(0, 1, 0)) * 
+                                        glm::scale(glm::mat4(1), glm::vec3(2));
+                                        
+    meshRendererPtr->UpdateBounds();
+    
+    float extent = glm::sqrt(2.0f);
+    
+    if (glm::length(meshRendererPtr->GetBoundingBoxMin() - glm::vec3(-extent, -1, -10 - extent)) > margin) Throw(msgFailedSetGet, __FILE__, __LINE__);
+    if (glm::length(meshRendererPtr->GetBoundingBoxMax() - glm::vec3(extent, 1, -10 + extent)) > margin)   Throw(msgFailedSetGet, __FILE__, __LINE__);
+    
+    if (!frustum.CheckBox(meshRendererPtr->GetBoundingBoxMin(), meshRendererPtr->GetBoundingBoxMax())) Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    // Moved behind the camera
+    meshRendererPtr->transform.matrix = glm::translate(glm::mat4(1), glm::vec3(0, 0, 10));
+    meshRendererPtr->UpdateBounds();
+    
+    if (frustum.CheckBox(meshRendererPtr->GetBoundingBoxMin(), meshRendererPtr->GetBoundingBoxMax())) Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    // Detached so the mesh is not destroyed with the renderer
+    meshRendererPtr->mesh = nullptr;
+    
+    if (!Renderer.DestroyMeshRenderer(meshRendererPtr)) Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    if (!Renderer.DestroyMesh(meshPtr))                 Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    
+    //
+    // Batches
+    
+    // Odd count so the wide kernels also run their remainder
+    const unsigned int count = 37;
+    
+    std::vector<float> boundsMin[3];
+    std::vector<float> boundsMax[3];
+    
+    std::vector<unsigned char> expected(count);
+    
+    for (unsigned int i=0; i < count; i++) {
+        
+        glm::vec3 center((i % 7) * 6.0f - 18.0f, (i % 3) * 4.0f - 4.0f, (i % 5) * -40.0f + 20.0f);
+        glm::vec3 size(0.5f + (i % 4));
+        
+        for (unsigned int a=0; a < 3; a++) {
+            boundsMin[a].push_back(center[a] - size[a]);
+            boundsMax[a].push_back(center[a] + size[a]);
+        }
+        
+        expected[i] = frustum.CheckBox(center - size, center + size) ? 1 : 0;
+    }
+    
+    Frustum::BoxArrays boxes;
+    boxes.minX = boundsMin[0].data();
+    boxes.minY = boundsMin[1].data();
+    boxes.minZ = boundsMin[2].data();
+    boxes.maxX = boundsMax[0].data();
+    boxes.maxY = boundsMax[1].data();
+    boxes.maxZ = boundsMax[2].data();
+    
+    // Every supported instruction set should agree with the single test
+    Frustum::InstructionSet selected  = Frustum::GetInstructionSet();
+    Frustum::InstructionSet supported = Frustum::GetSupportedInstructionSet();
+    
+    for (int set=0; set <= (int)supported; set++) {
+        
+        Frustum::SetInstructionSet( (Frustum::InstructionSet)set );
+        
+        if (Frustum::GetInstructionSet() != (Frustum::InstructionSet)set) Throw(msgFailedSetGet, __FILE__, __LINE__);
+        
+        std::vector<unsigned char> visible(count, 2);
+        
+        frustum.CheckBoxes(boxes, count, visible.data());
+        
+        for (unsigned int i=0; i < count; i++) 
+            if (visible[i] != expected[i]) Throw(msgFailedOperator, __FILE__, __LINE__);
+    }
+    
+    Frustum::SetInstructionSet(selected);
+    
+    return;
+}
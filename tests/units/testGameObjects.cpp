@@ -56,6 +56,12 @@ void TestFramework::TestGameObject(void) {
     gameObject2->SetAngularAxisLockFactor(2.0, 4.0, 6.0);
     if (rigidBody->getAngularLockAxisFactor() != rp3d::Vector3(2.0, 4.0, 6.0)) Throw(msgFailedSetGet, __FILE__, __LINE__);
     
+    // Test activation state
+    gameObject2->SetActive(false);
+    if (gameObject2->GetActive()) Throw(msgFailedSetGet, __FILE__, __LINE__);
+    gameObject2->SetRenderDistance(50.0f);
+    if (gameObject2->GetRenderDistance() != 50.0f) Throw(msgFailedSetGet, __FILE__, __LINE__);
+    
     Engine.Destroy<GameObject>(gameObject2);
     
     return;
@@ -0,0 +1,130 @@
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../framework.h"
+#include <GameEngineFramework/Renderer/RenderSystem.h>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+extern RenderSystem Renderer;
+
+void TestFramework::TestInstancing(void) {
+    if (hasTestFailed) return;
+    
+    std::cout << "Instancing.............. ";
+    
+    Shader* instancedShader = Renderer.shaders.colorInstanced;
+    Shader* colorShader     = Renderer.shaders.color;
+    
+    if ((instancedShader == nullptr) | (colorShader == nullptr)) {
+        Throw(msgFailedNullptr, __FILE__, __LINE__);
+        return;
+    }
+    
+    if (!instancedShader->CheckIsInstanced()) Throw(msgFailedSetGet, __FILE__, __LINE__);
+    if (colorShader->CheckIsInstanced())      Throw(msgFailedSetGet, __FILE__, __LINE__);
+    
+    // Draw only the test scene
+    std::vector<bool> sceneStates;
+    
+    for (unsigned int i=0; i < Renderer.GetRenderQueueSize(); i++) {
+        sceneStates.push_back( Renderer[i]->isActive );
+        Renderer[i]->isActive = false;
+    }
+    
+    Scene* scenePtr = Renderer.CreateScene();
+    Camera* cameraPtr = Renderer.CreateCamera();
+    
+    cameraPtr->viewport = Viewport(0, 0, 64, 64);
+    cameraPtr->aspect   = 1.0f;
+    
+    scenePtr->camera = cameraPtr;
+    
+    Renderer.AddSceneToRenderQueue(scenePtr);
+    
+    // Grid of cubes in front of the camera, each with its own color
+    std::vector<MeshRenderer*> renderers;
+    
+    for (unsigned int y=0; y < 4; y++) {
+        
+        for (unsigned int z=0; z < 4; z++) {
+            
+            Material* materialPtr = Renderer.CreateMaterial();
+            materialPtr->shader  = instancedShader;
+            materialPtr->ambient = Color(1, 1, 1);
+            materialPtr->diffuse = Color(0.2f + y * 0.2f, 0.2f + z * 0.2f, 0.5f);
+            
+            MeshRenderer* meshRendererPtr = Renderer.CreateMeshRenderer();
+            meshRendererPtr->mesh     = Renderer.meshes.cube;
+            meshRendererPtr->material = materialPtr;
+            
+            meshRendererPtr->transform.matrix = glm::translate(glm::mat4(1), glm::vec3(20.0f, y * 4.0f - 6.0f, z * 4.0f - 6.0f));
+            
+            scenePtr->AddMeshRendererToSceneRoot(meshRendererPtr, RENDER_QUEUE_GEOMETRY);
+            
+            renderers.push_back(meshRendererPtr);
+        }
+        
+    }
+    
+    // One instanced draw for every renderer
+    Renderer.RenderFrame();
+    
+    if (Renderer.GetNumberOfDrawCalls() != 1)                 Throw(msgFailedOperator, __FILE__, __LINE__);
+    if (Renderer.GetNumberOfInstances() != renderers.size())  Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    std::vector<unsigned char> instancedImage(64 * 64 * 4);
+    glReadPixels(0, 0, 64, 64, GL_RGBA, GL_UNSIGNED_BYTE, instancedImage.data());
+    
+    // One draw for each renderer
+    for (unsigned int i=0; i < renderers.size(); i++) 
+        renderers[i]->material->shader = colorShader;
+        
+    Renderer.RenderFrame();
+    
+    if (Renderer.GetNumberOfDrawCalls() != renderers.size())  Throw(msgFailedOperator, __FILE__, __LINE__);
+    if (Renderer.GetNumberOfInstances() != 0)                 Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    std::vector<unsigned char> image(64 * 64 * 4);
+    glReadPixels(0, 0, 64, 64, GL_RGBA, GL_UNSIGNED_BYTE, image.data());
+    
+    // Both paths should produce the same picture
+    unsigned int numberOfLitPixels = 0;
+    
+    for (unsigned int i=0; i < image.size(); i++) {
+        
+        int difference = (int)image[i] - (int)instancedImage[i];
+        
+        if ((difference > 1) | (difference < -1)) {
+            Throw(msgFailedOperator, __FILE__, __LINE__);
+            break;
+        }
+        
+        // Cleared to black
+        if (((i & 3) != 3) & (image[i] > 0)) 
+            numberOfLitPixels++;
+    }
+    
+    if (numberOfLitPixels == 0) Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    // The cube mesh is shared with the engine
+    for (unsigned int i=0; i < renderers.size(); i++) {
+        
+        scenePtr->RemoveMeshRendererFromSceneRoot(renderers[i], RENDER_QUEUE_GEOMETRY);
+        
+        renderers[i]->mesh = nullptr;
+        
+        Renderer.DestroyMeshRenderer(renderers[i]);
+    }
+    
+    Renderer.RemoveSceneFromRenderQueue(scenePtr);
+    
+    Renderer.DestroyScene(scenePtr);
+    Renderer.DestroyCamera(cameraPtr);
+    
+    for (unsigned int i=0; i < sceneStates.size(); i++) 
+        Renderer[i]->isActive = sceneStates[i];
+        
+    return;
+}
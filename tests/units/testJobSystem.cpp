@@ -0,0 +1,94 @@
+#include <atomic>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../framework.h"
+#include <GameEngineFramework/JobSystem/JobSystem.h>
+
+
+void TestFramework::TestJobSystem(void) {
+    if (hasTestFailed) return;
+    
+    std::cout << "Job system.............. ";
+    
+    JobSystem jobSystem;
+    jobSystem.Initiate(4);
+    
+    if (jobSystem.GetNumberOfWorkers() != 4) Throw(msgFailedConstructor, __FILE__, __LINE__);
+    
+    // Every element should be visited exactly once
+    std::vector<unsigned int> elements(10000);
+    
+    for (unsigned int pass=0; pass < 10; pass++) {
+        
+        jobSystem.ParallelFor(elements.size(), 64, [&elements](unsigned int begin, unsigned int end) {
+            
+            for (unsigned int i=begin; i < end; i++) 
+                elements[i]++;
+            
+        });
+        
+    }
+    
+    for (unsigned int i=0; i < elements.size(); i++) 
+        if (elements[i] != 10) Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    // Ranges smaller than a chunk run in place
+    unsigned int count = 0;
+    jobSystem.ParallelFor(10, 64, [&count](unsigned int begin, unsigned int end) {count += end - begin;});
+    
+    if (count != 10) Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    // An empty handle counts as complete
+    JobHandle emptyHandle;
+    
+    if (emptyHandle.CheckIsValid()) Throw(msgFailedConstructor, __FILE__, __LINE__);
+    if (!emptyHandle.CheckIsComplete()) Throw(msgFailedConstructor, __FILE__, __LINE__);
+    
+    // Dependent jobs run after the jobs they depend on
+    std::vector<unsigned int> order;
+    std::atomic<unsigned int> rangeCount(0);
+    
+    JobHandle first  = jobSystem.Schedule([&order]() {order.push_back(1);});
+    JobHandle second = jobSystem.Schedule([&order]() {order.push_back(2);}, first);
+    
+    JobHandle range = jobSystem.ScheduleParallelFor(1000, 64, [&rangeCount](unsigned int begin, unsigned int end) {rangeCount += end - begin;}, second);
+    
+    std::vector<JobHandle> dependencies;
+    dependencies.push_back(first);
+    dependencies.push_back(second);
+    dependencies.push_back(range);
+    
+    JobHandle third = jobSystem.Schedule([&order]() {order.push_back(3);}, dependencies);
+    
+    jobSystem.Wait(third);
+    
+    if (!third.CheckIsValid()) Throw(msgFailedSetGet, __FILE__, __LINE__);
+    if (!first.CheckIsComplete()) Throw(msgFailedSetGet, __FILE__, __LINE__);
+    if (!range.CheckIsComplete()) Throw(msgFailedSetGet, __FILE__, __LINE__);
+    if (rangeCount != 1000) Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    if (order.size() != 3) Throw(msgFailedOperator, __FILE__, __LINE__);
+    if ((order[0] != 1) | (order[1] != 2) | (order[2] != 3)) Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    // Main thread jobs are held until the main thread runs them
+    bool isMainThreadJobRun = false;
+    
+    JobHandle mainThreadJob = jobSystem.ScheduleMainThread([&isMainThreadJobRun]() {isMainThreadJobRun = !JobSystem::CheckIsWorkerThread();}, third);
+    
+    jobSystem.RunMainThreadJobs();
+    
+    if (!isMainThreadJobRun) Throw(msgFailedOperator, __FILE__, __LINE__);
+    if (!mainThreadJob.CheckIsComplete()) Throw(msgFailedSetGet, __FILE__, __LINE__);
+    
+    jobSystem.Shutdown();
+    
+    // Running without workers falls back to the calling thread
+    count = 0;
+    jobSystem.ParallelFor(1000, 64, [&count](unsigned int begin, unsigned int end) {count += end - begin;});
+    
+    if (count != 1000) Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    return;
+}
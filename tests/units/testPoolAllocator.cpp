@@ -0,0 +1,209 @@
+#include <iostream>
+#include <string>
+#include <thread>
+
+#include "../framework.h"
+#include <GameEngineFramework/MemoryAllocation/PoolAllocator.h>
+#include <GameEngineFramework/MemoryAllocation/ConcurrentPoolAllocator.h>
+#include <GameEngineFramework/Transform/Transform.h>
+
+
+void TestFramework::TestPoolAllocator(void) {
+    if (hasTestFailed) return;
+    
+    std::cout << "Pool allocator.......... ";
+    
+    PoolAllocator<Transform> allocator(8, 1);
+    
+    // Fill past the first pool to force a new pool allocation
+    std::vector<Transform*> objects;
+    for (unsigned int i=0; i < 20; i++) {
+        
+        Transform* objectPtr = allocator.Create();
+        if (objectPtr == nullptr) Throw(msgFailedObjectCreate, __FILE__, __LINE__);
+        
+        objects.push_back( objectPtr );
+    }
+    
+    if (allocator.Size() != 20) Throw(msgFailedObjectCreate, __FILE__, __LINE__);
+    
+    // Objects must be constructed on create
+    if (objects[19]->scale != glm::vec3(1, 1, 1)) Throw(msgFailedConstructor, __FILE__, __LINE__);
+    
+    // Destroy every other object
+    for (unsigned int i=0; i < 20; i += 2) 
+        if (!allocator.Destroy( objects[i] )) Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    
+    // Double destroy must be rejected
+    if (allocator.Destroy( objects[0] )) Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    
+    // The active list must only contain the remaining objects
+    if (allocator.Size() != 10) Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    
+    for (unsigned int i=0; i < allocator.Size(); i++) {
+        
+        bool isRemaining = false;
+        for (unsigned int a=1; a < 20; a += 2) 
+            if (allocator[i] == objects[a]) isRemaining = true;
+        
+        if (!isRemaining) Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    }
+    
+    // Freed slots should be reused before a new pool is allocated
+    unsigned int freeCount = allocator.GetFreeCount();
+    Transform* reusedPtr = allocator.Create();
+    if (allocator.GetFreeCount() != freeCount - 1) Throw(msgFailedObjectCreate, __FILE__, __LINE__);
+    
+    allocator.Destroy( reusedPtr );
+    
+    for (unsigned int i=1; i < 20; i += 2) 
+        allocator.Destroy( objects[i] );
+    
+    if (allocator.Size() != 0) Throw(msgFailedAllocatorNotZero, __FILE__, __LINE__);
+    
+    // Handles must resolve while the object is alive
+    PoolHandle<Transform> handle = allocator.CreateHandle();
+    if (!allocator.CheckIsValid(handle)) Throw(msgFailedObjectCreate, __FILE__, __LINE__);
+    if (allocator.Resolve(handle) == nullptr) Throw(msgFailedNullptr, __FILE__, __LINE__);
+    
+    // Handles must go stale once the object is destroyed
+    if (!allocator.Destroy(handle)) Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    if (allocator.Resolve(handle) != nullptr) Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    if (allocator.Destroy(handle)) Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    
+    // A reused slot must not revive an old handle
+    PoolHandle<Transform> handleReused = allocator.CreateHandle();
+    if (handleReused == handle) Throw(msgFailedObjectCreate, __FILE__, __LINE__);
+    if (allocator.CheckIsValid(handle)) Throw(msgFailedObjectCreate, __FILE__, __LINE__);
+    
+    allocator.Destroy(handleReused);
+    
+    // Empty pools must be released down to a single pool
+    for (unsigned int i=0; i < 40; i++) 
+        objects.push_back( allocator.Create() );
+    
+    if (allocator.GetPoolCount() < 2) Throw(msgFailedObjectCreate, __FILE__, __LINE__);
+    
+    while (allocator.Size() > 0) 
+        allocator.Destroy( allocator[0] );
+    
+    allocator.Shrink();
+    
+    if (allocator.GetPoolCount() != 1) Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    if (allocator.GetFreeCount() != allocator.GetCapacity()) Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    
+    // Compaction must keep handles resolving to the relocated objects
+    std::vector< PoolHandle<Transform> > handles;
+    for (unsigned int i=0; i < 40; i++) {
+        
+        PoolHandle<Transform> handleNew = allocator.CreateHandle();
+        allocator.Resolve(handleNew)->position.x = (float)i;
+        
+        handles.push_back( handleNew );
+    }
+    
+    for (unsigned int i=0; i < 40; i += 4) 
+        allocator.Destroy( handles[i] );
+    
+    if (!allocator.Compact()) Throw(msgFailedObjectCreate, __FILE__, __LINE__);
+    if (allocator.GetPoolCount() != 1) Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    if (allocator.Size() != 30) Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    
+    for (unsigned int i=0; i < 40; i++) {
+        
+        Transform* objectPtr = allocator.Resolve( handles[i] );
+        
+        if ((i % 4) == 0) {
+            if (objectPtr != nullptr) Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+            continue;
+        }
+        
+        if (objectPtr == nullptr) Throw(msgFailedNullptr, __FILE__, __LINE__);
+        if (objectPtr->position.x != (float)i) Throw(msgFailedObjectCreate, __FILE__, __LINE__);
+    }
+    
+    for (unsigned int i=0; i < 40; i++) 
+        allocator.Destroy( handles[i] );
+    
+    if (allocator.Size() != 0) Throw(msgFailedAllocatorNotZero, __FILE__, __LINE__);
+    
+    // Batches should be reserved in a single contiguous pool
+    Transform* batch[50];
+    unsigned int numberOfPools = allocator.GetPoolCount();
+    
+    if (allocator.CreateBatch(batch, 50) != 50) Throw(msgFailedObjectCreate, __FILE__, __LINE__);
+    if (allocator.GetPoolCount() > numberOfPools + 1) Throw(msgFailedObjectCreate, __FILE__, __LINE__);
+    if (allocator.Size() != 50) Throw(msgFailedObjectCreate, __FILE__, __LINE__);
+    
+    for (unsigned int i=0; i < 50; i++) 
+        if (batch[i] == nullptr) Throw(msgFailedNullptr, __FILE__, __LINE__);
+    
+    if (allocator.DestroyBatch(batch, 50) != 50) Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    if (allocator.DestroyBatch(batch, 50) != 0) Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    if (allocator.Size() != 0) Throw(msgFailedAllocatorNotZero, __FILE__, __LINE__);
+    
+    // Telemetry must track the live objects and high water mark
+    allocator.SetName("TestTransform");
+    
+    for (unsigned int i=0; i < 5; i++) 
+        allocator.Create();
+    
+    bool isRegistered = false;
+    std::vector<AllocatorStatistics> statisticsList = AllocatorRegistry::Get().GetStatistics();
+    for (unsigned int i=0; i < statisticsList.size(); i++) {
+        
+        if (statisticsList[i].name != "TestTransform") 
+            continue;
+        
+        if (statisticsList[i].liveCount != 5) Throw(msgFailedObjectCreate, __FILE__, __LINE__);
+        if (statisticsList[i].highWaterMark < 40) Throw(msgFailedObjectCreate, __FILE__, __LINE__);
+        if (statisticsList[i].capacity != allocator.GetCapacity()) Throw(msgFailedObjectCreate, __FILE__, __LINE__);
+        
+        isRegistered = true;
+    }
+    
+    if (!isRegistered) Throw(msgFailedNullptr, __FILE__, __LINE__);
+    
+    while (allocator.Size() > 0) 
+        allocator.Destroy( allocator[0] );
+    
+    // Objects created on other threads must appear after synchronizing
+    ConcurrentPoolAllocator<Transform> concurrentAllocator(8);
+    
+    std::thread workers[4];
+    for (unsigned int t=0; t < 4; t++) {
+        
+        workers[t] = std::thread( [&concurrentAllocator]() {
+            
+            for (unsigned int i=0; i < 100; i++) 
+                concurrentAllocator.Create();
+            
+            concurrentAllocator.FlushThreadCache();
+        } );
+    }
+    
+    for (unsigned int t=0; t < 4; t++) 
+        workers[t].join();
+    
+    if (concurrentAllocator.GetObjectCount() != 400) Throw(msgFailedObjectCreate, __FILE__, __LINE__);
+    
+    concurrentAllocator.Synchronize();
+    
+    if (concurrentAllocator.Size() != 400) Throw(msgFailedObjectCreate, __FILE__, __LINE__);
+    
+    // Destroyed objects remain listed until the next synchronization
+    PoolHandle<Transform> concurrentHandle = concurrentAllocator.GetHandle( concurrentAllocator[0] );
+    
+    for (unsigned int i=0; i < 400; i++) 
+        if (!concurrentAllocator.Destroy( concurrentAllocator[i] )) Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    
+    if (concurrentAllocator.Destroy( concurrentAllocator[0] )) Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    if (concurrentAllocator.CheckIsValid( concurrentHandle )) Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+    
+    concurrentAllocator.Synchronize();
+    
+    if (concurrentAllocator.Size() != 0) Throw(msgFailedAllocatorNotZero, __FILE__, __LINE__);
+    
+    return;
+}
+
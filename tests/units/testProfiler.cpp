@@ -0,0 +1,113 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cmath>
+#include <cstdio>
+#include <string>
+
+#include "../framework.h"
+#include <GameEngineFramework/Profiler/profiler.h>
+
+extern ProfilerTimer Profiler;
+
+
+void TestFramework::TestProfiler(void) {
+    if (hasTestFailed) return;
+    
+    std::cout << "Profiler................ ";
+    
+    bool wasCapturing = Profiler.CheckIsCapturing();
+    
+    // Zones outside a capture are not recorded
+    Profiler.DisableCapture();
+    Profiler.ClearTrace();
+    
+    {
+        PROFILE_ZONE("Test zone ignored");
+    }
+    
+    Profiler.EnableCapture();
+    if (!Profiler.CheckIsCapturing()) Throw(msgFailedSetGet, __FILE__, __LINE__);
+    
+    Profiler.MarkFrame();
+    
+    // Nested zones
+    {
+        PROFILE_ZONE("Test zone outer");
+        
+        {
+            PROFILE_ZONE("Test zone inner");
+        }
+        
+    }
+    
+    Profiler.MarkFrame();
+    
+    Profiler.DisableCapture();
+    
+    std::string filename = "profiler_test.json";
+    
+    if (!Profiler.ExportTrace(filename)) Throw(msgFailedSerialization, __FILE__, __LINE__);
+    
+    std::ifstream file(filename);
+    std::stringstream stream;
+    stream << file.rdbuf();
+    file.close();
+    
+    std::string trace = stream.str();
+    
+    if (trace.find("\"traceEvents\"") == std::string::npos)     Throw(msgFailedSerialization, __FILE__, __LINE__);
+    if (trace.find("Test zone outer") == std::string::npos)     Throw(msgFailedSerialization, __FILE__, __LINE__);
+    if (trace.find("Test zone inner") == std::string::npos)     Throw(msgFailedSerialization, __FILE__, __LINE__);
+    if (trace.find("Frame") == std::string::npos)               Throw(msgFailedSerialization, __FILE__, __LINE__);
+    if (trace.find("Test zone ignored") != std::string::npos)   Throw(msgFailedSerialization, __FILE__, __LINE__);
+    
+    // Cleared zones are not exported again
+    Profiler.ClearTrace();
+    
+    if (!Profiler.ExportTrace(filename)) Throw(msgFailedSerialization, __FILE__, __LINE__);
+    
+    file.open(filename);
+    stream.str("");
+    stream << file.rdbuf();
+    file.close();
+    
+    if (stream.str().find("Test zone outer") != std::string::npos) Throw(msgFailedSerialization, __FILE__, __LINE__);
+    
+    std::remove( filename.c_str() );
+    
+    if (wasCapturing) 
+        Profiler.EnableCapture();
+    
+    // Histogram percentiles over a rolling window
+    ProfilerHistogram histogram;
+    histogram.SetWindow(100);
+    
+    for (unsigned int i=1; i <= 100; i++) 
+        histogram.AddSample(i * 0.5f);
+    
+    float margin = PROFILER_HISTOGRAM_BUCKET_SIZE;
+    
+    if (histogram.GetNumberOfSamples() != 100) Throw(msgFailedSetGet, __FILE__, __LINE__);
+    if (histogram.GetMax() != 50.0f) Throw(msgFailedSetGet, __FILE__, __LINE__);
+    if (std::abs(histogram.GetPercentile(50.0f) - 25.0f) > margin) Throw(msgFailedOperator, __FILE__, __LINE__);
+    if (std::abs(histogram.GetPercentile(95.0f) - 47.5f) > margin) Throw(msgFailedOperator, __FILE__, __LINE__);
+    if (std::abs(histogram.GetPercentile(99.0f) - 49.5f) > margin) Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    // Older samples leave the window
+    for (unsigned int i=0; i < 100; i++) 
+        histogram.AddSample(10.0f);
+    
+    if (histogram.GetNumberOfSamples() != 100) Throw(msgFailedSetGet, __FILE__, __LINE__);
+    if (histogram.GetMax() != 10.0f) Throw(msgFailedOperator, __FILE__, __LINE__);
+    if (std::abs(histogram.GetPercentile(99.0f) - 10.0f) > margin) Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    // Samples past the last bucket report the largest sample
+    histogram.AddSample(500.0f);
+    if (histogram.GetPercentile(100.0f) != 500.0f) Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    histogram.Clear();
+    if (histogram.GetNumberOfSamples() != 0) Throw(msgFailedSetGet, __FILE__, __LINE__);
+        
+    return;
+}
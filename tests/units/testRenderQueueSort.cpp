@@ -0,0 +1,86 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "../framework.h"
+#include <GameEngineFramework/Renderer/RenderQueueSort.h>
+
+static bool CompareEntries(const RenderQueueSort::Entry& a, const RenderQueueSort::Entry& b) {
+    return a.key < b.key;
+}
+
+static bool CheckMatchesStableSort(std::vector<RenderQueueSort::Entry> entries) {
+    
+    std::vector<RenderQueueSort::Entry> expected = entries;
+    std::stable_sort(expected.begin(), expected.end(), CompareEntries);
+    
+    std::vector<RenderQueueSort::Entry> scratch( entries.size() );
+    RenderQueueSort::Sort(entries.data(), scratch.data(), entries.size());
+    
+    for (unsigned int i=0; i < entries.size(); i++) 
+        if ((entries[i].key != expected[i].key) | (entries[i].renderer != expected[i].renderer)) 
+            return false;
+            
+    return true;
+}
+
+void TestFramework::TestRenderQueueSort(void) {
+    if (hasTestFailed) return;
+    
+    std::cout << "Render queue sort....... ";
+    
+    // Renderers are only carried along so any distinct address will do
+    std::vector<char> renderers(2000);
+    
+    std::vector<RenderQueueSort::Entry> entries(2000);
+    
+    // Random keys with plenty of duplicates to check stability
+    unsigned long long int seed = 12345;
+    for (unsigned int i=0; i < entries.size(); i++) {
+        
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        
+        entries[i].key      = (seed >> 40) & 0x3ff;
+        entries[i].key     |= (seed & 0xf00000000000000ULL);
+        entries[i].renderer = (MeshRenderer*)&renderers[i];
+    }
+    
+    if (!CheckMatchesStableSort(entries)) Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    // Nearly sorted input takes the insertion path
+    std::vector<RenderQueueSort::Entry> nearlySorted = entries;
+    std::stable_sort(nearlySorted.begin(), nearlySorted.end(), CompareEntries);
+    std::swap(nearlySorted[10], nearlySorted[11]);
+    std::swap(nearlySorted[500], nearlySorted[900]);
+    
+    if (!CheckMatchesStableSort(nearlySorted)) Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    // Entries moved across the whole queue run out of insertion budget
+    std::vector<RenderQueueSort::Entry> rotated = nearlySorted;
+    std::stable_sort(rotated.begin(), rotated.end(), CompareEntries);
+    std::rotate(rotated.begin(), rotated.begin() + 10, rotated.end());
+    
+    if (!CheckMatchesStableSort(rotated)) Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    // Depth buckets follow the distance and flip for back to front
+    if (RenderQueueSort::GetDepthBucket(1.0f, false) >= RenderQueueSort::GetDepthBucket(4.0f, false)) Throw(msgFailedOperator, __FILE__, __LINE__);
+    if (RenderQueueSort::GetDepthBucket(1.0f, true)  <= RenderQueueSort::GetDepthBucket(4.0f, true))  Throw(msgFailedOperator, __FILE__, __LINE__);
+    if (RenderQueueSort::GetDepthBucket(-1.0f, false) != 0) Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    // Depth orders before state and the queue group before depth
+    int shaderA, shaderB;
+    
+    unsigned long long int nearKey = RenderQueueSort::BuildKey(5, 10, &shaderB, nullptr, nullptr);
+    unsigned long long int farKey  = RenderQueueSort::BuildKey(5, 11, &shaderA, nullptr, nullptr);
+    unsigned long long int nextKey = RenderQueueSort::BuildKey(6, 0,  nullptr, nullptr, nullptr);
+    
+    if ((nearKey >= farKey) | (farKey >= nextKey)) Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    // Same resources give the same key
+    if (RenderQueueSort::BuildKey(5, 10, &shaderB, nullptr, nullptr) != nearKey) Throw(msgFailedOperator, __FILE__, __LINE__);
+    if (RenderQueueSort::GetResourceId(nullptr, 15) != 0) Throw(msgFailedOperator, __FILE__, __LINE__);
+    if (RenderQueueSort::GetResourceId(&shaderA, 15) == 0) Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    return;
+}
@@ -0,0 +1,92 @@
+#include <iostream>
+#include <string>
+#include <cmath>
+
+#include "../framework.h"
+#include <GameEngineFramework/Timer/Scheduler.h>
+#include <GameEngineFramework/Math/TransformBatch.h>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+void TestFramework::TestScheduler(void) {
+    if (hasTestFailed) return;
+    
+    std::cout << "Scheduler............... ";
+    
+    Scheduler scheduler;
+    
+    unsigned int numberOfFastSteps = 0;
+    unsigned int numberOfSlowSteps = 0;
+    float fastTimeStep = 0.0f;
+    
+    unsigned int fastIndex = scheduler.AddSystem("Fast", 50.0, [&](float timeStep) {numberOfFastSteps++; fastTimeStep = timeStep;}, 10);
+    unsigned int slowIndex = scheduler.AddSystem("Slow", 10.0, [&](float timeStep) {numberOfSlowSteps++;}, 10);
+    
+    if (scheduler.GetNumberOfSystems() != 2) Throw(msgFailedObjectCreate, __FILE__, __LINE__);
+    if (scheduler.GetName(slowIndex) != "Slow") Throw(msgFailedSetGet, __FILE__, __LINE__);
+    
+    // Each system steps at its own rate
+    scheduler.Advance(100);
+    
+    if (numberOfFastSteps != 5) Throw(msgFailedOperator, __FILE__, __LINE__);
+    if (numberOfSlowSteps != 1) Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    // The step length is passed in seconds
+    if (std::fabs(fastTimeStep - 0.02f) > 0.00001f) Throw(msgFailedOperator, __FILE__, __LINE__);
+    if (std::fabs(scheduler.GetTimeStep(slowIndex) - 0.1f) > 0.00001f) Throw(msgFailedSetGet, __FILE__, __LINE__);
+    
+    // Left over time gives the interpolation factor
+    scheduler.Advance(110);
+    
+    if (numberOfFastSteps != 10) Throw(msgFailedOperator, __FILE__, __LINE__);
+    if (numberOfSlowSteps != 2)  Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    if (std::fabs(scheduler.GetInterpolationFactor(fastIndex) - 0.5f) > 0.001f) Throw(msgFailedOperator, __FILE__, __LINE__);
+    if (std::fabs(scheduler.GetInterpolationFactor(slowIndex) - 0.1f) > 0.001f) Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    // Steps beyond the limit are dropped rather than caught up
+    scheduler.Reset();
+    
+    if (scheduler.GetInterpolationFactor(fastIndex) != 0.0f) Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    scheduler.SetMaxStepsPerUpdate(fastIndex, 3);
+    
+    numberOfFastSteps = 0;
+    scheduler.Advance(200);
+    
+    if (numberOfFastSteps != 3) Throw(msgFailedOperator, __FILE__, __LINE__);
+    if (scheduler.GetNumberOfDroppedSteps(fastIndex) != 7) Throw(msgFailedOperator, __FILE__, __LINE__);
+    if (scheduler.GetNumberOfSteps(fastIndex) != 13) Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    // Rate changes take effect on the next update
+    scheduler.SetRate(slowIndex, 20.0);
+    
+    if (scheduler.GetRate(slowIndex) != 20.0) Throw(msgFailedSetGet, __FILE__, __LINE__);
+    
+    // Matrix interpolation between two transforms
+    glm::mat4 from = glm::translate(glm::mat4(1), glm::vec3(0, 0, 0));
+    glm::mat4 to   = glm::translate(glm::mat4(1), glm::vec3(10, 0, 0));
+    to = glm::rotate(to, glm::radians(90.0f), glm::vec3(0, 1, 0));
+    to = glm::scale(to, glm::vec3(3, 3, 3));
+    
+    glm::mat4 begin  = TransformBatch::InterpolateMatrix(from, to, 0.0f);
+    glm::mat4 middle = TransformBatch::InterpolateMatrix(from, to, 0.5f);
+    glm::mat4 end    = TransformBatch::InterpolateMatrix(from, to, 1.0f);
+    
+    glm::mat4 expected = glm::translate(glm::mat4(1), glm::vec3(5, 0, 0));
+    expected = glm::rotate(expected, glm::radians(45.0f), glm::vec3(0, 1, 0));
+    expected = glm::scale(expected, glm::vec3(2, 2, 2));
+    
+    for (unsigned int c=0; c < 4; c++) {
+        
+        for (unsigned int r=0; r < 4; r++) {
+            
+            if (std::fabs(begin[c][r]  - from[c][r])     > 0.001f) Throw(msgFailedOperator, __FILE__, __LINE__);
+            if (std::fabs(end[c][r]    - to[c][r])       > 0.001f) Throw(msgFailedOperator, __FILE__, __LINE__);
+            if (std::fabs(middle[c][r] - expected[c][r]) > 0.001f) Throw(msgFailedOperator, __FILE__, __LINE__);
+        }
+        
+    }
+    
+    return;
+}
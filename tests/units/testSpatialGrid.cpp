@@ -0,0 +1,129 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "../framework.h"
+#include <GameEngineFramework/Engine/Engine.h>
+
+extern EngineSystemManager  Engine;
+
+void TestFramework::TestSpatialGrid(void) {
+    if (hasTestFailed) return;
+    
+    std::cout << "Spatial grid............ ";
+    
+    SpatialGrid grid(32.0f);
+    
+    if (grid.GetCellSize() != 32.0f) Throw(msgFailedSetGet, __FILE__, __LINE__);
+    
+    GameObject* objectA = Engine.Create<GameObject>();
+    GameObject* objectB = Engine.Create<GameObject>();
+    GameObject* objectC = Engine.Create<GameObject>();
+    GameObject* objectD = Engine.Create<GameObject>();
+    
+    if ((objectA == nullptr) | (objectB == nullptr) | (objectC == nullptr) | (objectD == nullptr)) {
+        Throw(msgFailedObjectCreate, __FILE__, __LINE__);
+        return;
+    }
+    
+    // Either side of the boundary between the first two cells and the origin
+    if (!grid.Update(objectA, glm::vec3(31.75f, 0, 0)))  Throw(msgFailedOperator, __FILE__, __LINE__);
+    if (!grid.Update(objectB, glm::vec3(32.0f, 0, 0)))   Throw(msgFailedOperator, __FILE__, __LINE__);
+    if (!grid.Update(objectC, glm::vec3(-0.25f, 0, 0)))  Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    // Below the origin on every axis
+    if (!grid.Update(objectD, glm::vec3(-32.5f, -32.5f, -32.5f))) Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    if (grid.GetNumberOfObjects() != 4) Throw(msgFailedOperator, __FILE__, __LINE__);
+    if (grid.GetNumberOfCells() != 4)   Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    std::vector<GameObject*> results;
+    
+    // Box edges are inclusive
+    if (grid.QueryBox(glm::vec3(32, -1, -1), glm::vec3(40, 1, 1), results) != 1) Throw(msgFailedOperator, __FILE__, __LINE__);
+    if ((results.size() != 1) || (results[0] != objectB)) Throw(msgFailedOperator, __FILE__, __LINE__);
+    results.clear();
+    
+    if (grid.QueryBox(glm::vec3(0, -1, -1), glm::vec3(31.75f, 1, 1), results) != 1) Throw(msgFailedOperator, __FILE__, __LINE__);
+    if ((results.size() != 1) || (results[0] != objectA)) Throw(msgFailedOperator, __FILE__, __LINE__);
+    results.clear();
+    
+    // Spanning both cells
+    if (grid.QueryBox(glm::vec3(31, -1, -1), glm::vec3(33, 1, 1), results) != 2) Throw(msgFailedOperator, __FILE__, __LINE__);
+    if (std::find(results.begin(), results.end(), objectA) == results.end()) Throw(msgFailedOperator, __FILE__, __LINE__);
+    if (std::find(results.begin(), results.end(), objectB) == results.end()) Throw(msgFailedOperator, __FILE__, __LINE__);
+    results.clear();
+    
+    // Negative coordinates
+    if (grid.QueryBox(glm::vec3(-1, -1, -1), glm::vec3(1, 1, 1), results) != 1) Throw(msgFailedOperator, __FILE__, __LINE__);
+    if ((results.size() != 1) || (results[0] != objectC)) Throw(msgFailedOperator, __FILE__, __LINE__);
+    results.clear();
+    
+    if (grid.QueryBox(glm::vec3(-33), glm::vec3(-32), results) != 1) Throw(msgFailedOperator, __FILE__, __LINE__);
+    if ((results.size() != 1) || (results[0] != objectD)) Throw(msgFailedOperator, __FILE__, __LINE__);
+    results.clear();
+    
+    // Radius edge is inclusive
+    if (grid.QueryRadius(glm::vec3(0), 0.25f, results) != 1) Throw(msgFailedOperator, __FILE__, __LINE__);
+    if ((results.size() != 1) || (results[0] != objectC)) Throw(msgFailedOperator, __FILE__, __LINE__);
+    results.clear();
+    
+    if (grid.QueryRadius(glm::vec3(0), 0.125f, results) != 0) Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    // Reaching across the cell boundary
+    if (grid.QueryRadius(glm::vec3(32, 0, 0), 0.5f, results) != 2) Throw(msgFailedOperator, __FILE__, __LINE__);
+    results.clear();
+    
+    if (grid.QueryRadius(glm::vec3(-32), 1.0f, results) != 1) Throw(msgFailedOperator, __FILE__, __LINE__);
+    if ((results.size() != 1) || (results[0] != objectD)) Throw(msgFailedOperator, __FILE__, __LINE__);
+    results.clear();
+    
+    // Moving within a cell
+    if (grid.Update(objectB, glm::vec3(40, 0, 0))) Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    if (grid.QueryRadius(glm::vec3(40, 0, 0), 0.5f, results) != 1) Throw(msgFailedOperator, __FILE__, __LINE__);
+    if ((results.size() != 1) || (results[0] != objectB)) Throw(msgFailedOperator, __FILE__, __LINE__);
+    results.clear();
+    
+    // Moving into a new cell
+    if (!grid.Update(objectB, glm::vec3(-40, 0, 0))) Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    if (grid.QueryBox(glm::vec3(32, -1, -1), glm::vec3(64, 1, 1), results) != 0) Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    if (grid.QueryRadius(glm::vec3(-40, 0, 0), 0.5f, results) != 1) Throw(msgFailedOperator, __FILE__, __LINE__);
+    if ((results.size() != 1) || (results[0] != objectB)) Throw(msgFailedOperator, __FILE__, __LINE__);
+    results.clear();
+    
+    // The emptied cell is released
+    if (grid.GetNumberOfObjects() != 4) Throw(msgFailedOperator, __FILE__, __LINE__);
+    if (grid.GetNumberOfCells() != 4)   Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    // Removing
+    grid.Remove(objectA);
+    
+    if (grid.CheckContains(objectA)) Throw(msgFailedOperator, __FILE__, __LINE__);
+    if (!grid.CheckContains(objectC)) Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    if (grid.QueryBox(glm::vec3(0, -1, -1), glm::vec3(32, 1, 1), results) != 0) Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    if (grid.GetNumberOfObjects() != 3) Throw(msgFailedOperator, __FILE__, __LINE__);
+    if (grid.GetNumberOfCells() != 3)   Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    // Removing twice is ignored
+    grid.Remove(objectA);
+    
+    if (grid.GetNumberOfObjects() != 3) Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    grid.Clear();
+    
+    if (grid.GetNumberOfObjects() != 0) Throw(msgFailedOperator, __FILE__, __LINE__);
+    if (grid.GetNumberOfCells() != 0)   Throw(msgFailedOperator, __FILE__, __LINE__);
+    
+    Engine.Destroy<GameObject>(objectA);
+    Engine.Destroy<GameObject>(objectB);
+    Engine.Destroy<GameObject>(objectC);
+    Engine.Destroy<GameObject>(objectD);
+    
+    return;
+}
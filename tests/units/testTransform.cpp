@@ -91,6 +91,30 @@ void TestFramework::TestTransform(void) {
     transformA = transformC;
     if (transformA != transformC) Throw(msgFailedOperator, __FILE__, __LINE__);
     
+    // Test cached world matrix
+    Transform transformParent;
+    Transform transformChild;
+    transformParent.SetPosition(10.0, 0.0, 0.0);
+    transformChild.SetPosition(1.0, 2.0, 3.0);
+    transformChild.parent = &transformParent;
+    
+    transformParent.UpdateWorldCache(true);
+    transformChild.UpdateWorldCache(true);
+    
+    if (glm::vec3(transformChild.matrix[3]) != glm::vec3(11.0, 2.0, 3.0)) Throw(msgFailedSetGet, __FILE__, __LINE__);
+    
+    // Nothing has moved so nothing should be rebuilt
+    if (transformParent.UpdateWorldCache(true)) Throw(msgFailedSetGet, __FILE__, __LINE__);
+    if (transformChild.UpdateWorldCache(true))  Throw(msgFailedSetGet, __FILE__, __LINE__);
+    
+    // Moving the parent should carry down to the child
+    transformParent.position.x = 20.0;
+    
+    if (!transformParent.UpdateWorldCache(true)) Throw(msgFailedSetGet, __FILE__, __LINE__);
+    if (!transformChild.UpdateWorldCache(true))  Throw(msgFailedSetGet, __FILE__, __LINE__);
+    
+    if (glm::vec3(transformChild.matrix[3]) != glm::vec3(21.0, 2.0, 3.0)) Throw(msgFailedSetGet, __FILE__, __LINE__);
+    
     return;
 }
 
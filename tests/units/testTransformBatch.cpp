@@ -0,0 +1,106 @@
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../framework.h"
+#include <GameEngineFramework/Math/TransformBatch.h>
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtx/quaternion.hpp>
+
+void TestFramework::TestTransformBatch(void) {
+    if (hasTestFailed) return;
+    
+    std::cout << "Transform batch......... ";
+    
+    float margin = 0.001;
+    
+    // Odd count so the wide kernels also run their remainder
+    const unsigned int count = 27;
+    
+    std::vector<glm::vec3> positions(count);
+    std::vector<glm::quat> rotations(count);
+    std::vector<glm::vec3> scales(count);
+    
+    for (unsigned int i=0; i < count; i++) {
+        positions[i] = glm::vec3(i * 1.5f, 10.0f - i, i * -0.25f);
+        rotations[i] = glm::angleAxis( glm::radians(i * 13.0f), glm::normalize( glm::vec3(1.0f, i * 0.5f, 2.0f) ) );
+        scales[i]    = glm::vec3(1.0f + i * 0.1f, 2.0f, 0.5f + i * 0.05f);
+    }
+    
+    // Single composition should match the glm matrix chain in both orders
+    for (unsigned int i=0; i < count; i++) {
+        
+        bool rotateTranslation = (i % 2) == 0;
+        
+        glm::mat4 matrix;
+        glm::mat3 normalMatrix;
+        
+        TransformBatch::ComposeMatrix(positions[i], rotations[i], scales[i], rotateTranslation, matrix, normalMatrix);
+        
+        glm::mat4 expected;
+        
+        if (rotateTranslation) {
+            expected = glm::toMat4( rotations[i] ) * glm::translate( glm::mat4(1), positions[i] ) * glm::scale( glm::mat4(1), scales[i] );
+        } else {
+            expected = glm::translate( glm::mat4(1), positions[i] ) * glm::toMat4( rotations[i] ) * glm::scale( glm::mat4(1), scales[i] );
+        }
+        
+        glm::mat3 expectedNormal = glm::transpose( glm::inverse( glm::mat3(expected) ) );
+        
+        for (unsigned int c=0; c < 4; c++) 
+            for (unsigned int r=0; r < 4; r++) 
+                if (glm::abs(matrix[c][r] - expected[c][r]) > margin) Throw(msgFailedOperator, __FILE__, __LINE__);
+                
+        for (unsigned int c=0; c < 3; c++) 
+            for (unsigned int r=0; r < 3; r++) 
+                if (glm::abs(normalMatrix[c][r] - expectedNormal[c][r]) > margin) Throw(msgFailedOperator, __FILE__, __LINE__);
+    }
+    
+    // Every supported instruction set should produce the same result
+    TransformBatch::InstructionSet supported = TransformBatch::GetSupportedInstructionSet();
+    
+    for (int set=0; set <= (int)supported; set++) {
+        
+        TransformBatch::SetInstructionSet( (TransformBatch::InstructionSet)set );
+        
+        if (TransformBatch::GetInstructionSet() != (TransformBatch::InstructionSet)set) Throw(msgFailedSetGet, __FILE__, __LINE__);
+        
+        std::vector<glm::mat4> matrices(count);
+        std::vector<glm::mat3> normalMatrices(count);
+        
+        {
+            TransformBatch batch;
+            
+            for (unsigned int i=0; i < count; i++) 
+                batch.Add(positions[i], rotations[i], scales[i], (i % 2) == 0, &matrices[i], &normalMatrices[i]);
+                
+            if (batch.Size() != count) Throw(msgFailedObjectCreate, __FILE__, __LINE__);
+            
+            batch.Compose();
+            
+            if (batch.Size() != 0) Throw(msgFailedObjectDestroy, __FILE__, __LINE__);
+        }
+        
+        for (unsigned int i=0; i < count; i++) {
+            
+            glm::mat4 expected;
+            glm::mat3 expectedNormal;
+            
+            TransformBatch::ComposeMatrix(positions[i], rotations[i], scales[i], (i % 2) == 0, expected, expectedNormal);
+            
+            for (unsigned int c=0; c < 4; c++) 
+                for (unsigned int r=0; r < 4; r++) 
+                    if (glm::abs(matrices[i][c][r] - expected[c][r]) > margin) Throw(msgFailedOperator, __FILE__, __LINE__);
+                    
+            for (unsigned int c=0; c < 3; c++) 
+                for (unsigned int r=0; r < 3; r++) 
+                    if (glm::abs(normalMatrices[i][c][r] - expectedNormal[c][r]) > margin) Throw(msgFailedOperator, __FILE__, __LINE__);
+        }
+        
+    }
+    
+    TransformBatch::SetInstructionSet(supported);
+    
+    return;
+}